@@ -445,6 +445,15 @@ namespace storm {
             if (buildSettings.isExplorationChecksSet()) {
                 options.setExplorationChecks();
             }
+            if (buildSettings.isNoExpressionCompilationSet()) {
+                options.setCompileExpressions(false);
+            }
+            if (buildSettings.isNoGuardIndexSet()) {
+                options.setIndexGuards(false);
+            }
+            if (buildSettings.isCompositionalSet()) {
+                options.setBuildCompositionally();
+            }
             options.setReservedBitsForUnboundedVariables(options.getReservedBitsForUnboundedVariables());
 
             options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
@@ -470,7 +479,11 @@ namespace storm {
             } else if (ioSettings.isExplicitDRNSet()) {
                 storm::parser::DirectEncodingParserOptions options;
                 options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+                options.numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+            } else if (ioSettings.isExplicitBinarySet()) {
+                std::shared_ptr<storm::expressions::ExpressionManager> manager = buildSettings.isBuildStateValuationsSet() ? std::make_shared<storm::expressions::ExpressionManager>() : nullptr;
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename(), manager);
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -491,7 +504,7 @@ namespace storm {
                 } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
                     result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
             }
@@ -575,7 +588,11 @@ namespace storm {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             
             if (ioSettings.isExportExplicitSet()) {
-                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled());
+                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled(), storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads());
+            }
+
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
             }
 
             if (ioSettings.isExportDdSet()) {
@@ -595,6 +612,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drn format is only supported for sparse models.");
             }
 
+            if (ioSettings.isExportBinarySet()) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in the binary format is only supported for sparse models.");
+            }
+
             if (ioSettings.isExportDdSet()) {
                 storm::api::exportSparseModelAsDrdd(model, ioSettings.getExportDdFilename());
             }
@@ -0,0 +1,273 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/utility/BinaryModelFormat.h"
+#include "storm/utility/builder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            using storm::utility::binaryformat::SectionKind;
+
+            /*!
+             * Reads the components of the binary format from a memory region and checks that no read exceeds it.
+             */
+            class BinaryReader {
+            public:
+                BinaryReader(char const* begin, char const* end) : position(begin), end(end) {
+                    // Intentionally left empty.
+                }
+
+                uint64_t readNumber() {
+                    uint64_t result;
+                    std::memcpy(&result, advance(sizeof(result)), sizeof(result));
+                    return result;
+                }
+
+                template<typename T>
+                std::vector<T> readArray(uint64_t count) {
+                    STORM_LOG_THROW(count <= remaining() / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    std::vector<T> result(count);
+                    std::memcpy(static_cast<void*>(result.data()), advance(count * sizeof(T)), count * sizeof(T));
+                    skipPadding(count * sizeof(T));
+                    return result;
+                }
+
+                std::string readString() {
+                    uint64_t size = readNumber();
+                    STORM_LOG_THROW(size <= remaining(), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    std::string result(advance(size), size);
+                    skipPadding(size);
+                    return result;
+                }
+
+                storm::storage::BitVector readBitVector(uint64_t size) {
+                    storm::storage::BitVector result(size);
+                    for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+                        result.setFromInt(bitIndex, std::min<uint64_t>(64, size - bitIndex), readNumber());
+                    }
+                    return result;
+                }
+
+                char const* advance(uint64_t size) {
+                    STORM_LOG_THROW(size <= remaining(), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    char const* result = position;
+                    position += size;
+                    return result;
+                }
+
+                uint64_t remaining() const {
+                    return end - position;
+                }
+
+            private:
+                void skipPadding(uint64_t size) {
+                    advance((size + 7) / 8 * 8 - size);
+                }
+
+                char const* position;
+                char const* end;
+            };
+
+            /*!
+             * Checks that the given indices start at zero, are nondecreasing and end with the given number.
+             */
+            void checkIndices(std::vector<storm::storage::SparseMatrixIndexType> const& indices, uint64_t last, std::string const& description, std::string const& filename) {
+                STORM_LOG_THROW(!indices.empty() && indices.front() == 0 && indices.back() == last, storm::exceptions::WrongFormatException, "The " << description << " in binary model file " << filename << " do not range from 0 to " << last << ".");
+                STORM_LOG_THROW(std::is_sorted(indices.begin(), indices.end()), storm::exceptions::WrongFormatException, "The " << description << " in binary model file " << filename << " are not monotonic.");
+            }
+
+            void readStateValuations(BinaryReader& reader, uint64_t numberOfStates, storm::expressions::ExpressionManager& manager, storm::storage::sparse::ModelComponents<double>& components) {
+                uint64_t numberOfVariables = reader.readNumber();
+                std::vector<std::pair<std::string, bool>> variableNamesAndTypes;
+                for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+                    std::string name = reader.readString();
+                    variableNamesAndTypes.emplace_back(name, reader.readNumber() == 0);
+                }
+                storm::storage::BitVector nonEmptyStates = reader.readBitVector(numberOfStates);
+
+                std::vector<storm::expressions::Variable> booleanVariables;
+                std::vector<std::vector<int64_t>> booleanValues;
+                std::vector<storm::expressions::Variable> integerVariables;
+                std::vector<std::vector<int64_t>> integerValues;
+                for (auto const& nameAndType : variableNamesAndTypes) {
+                    storm::expressions::Variable variable;
+                    if (manager.hasVariable(nameAndType.first)) {
+                        variable = manager.getVariable(nameAndType.first);
+                    } else if (nameAndType.second) {
+                        variable = manager.declareBooleanVariable(nameAndType.first);
+                    } else {
+                        variable = manager.declareIntegerVariable(nameAndType.first);
+                    }
+                    STORM_LOG_THROW(nameAndType.second ? variable.hasBooleanType() : variable.hasIntegerType(), storm::exceptions::WrongFormatException, "The type of variable '" << nameAndType.first << "' does not match the type of the existing variable with that name.");
+                    if (nameAndType.second) {
+                        booleanVariables.push_back(variable);
+                        booleanValues.push_back(reader.readArray<int64_t>(numberOfStates));
+                    } else {
+                        integerVariables.push_back(variable);
+                        integerValues.push_back(reader.readArray<int64_t>(numberOfStates));
+                    }
+                }
+
+                storm::storage::sparse::StateValuationsBuilder builder;
+                for (auto const& variable : booleanVariables) {
+                    builder.addVariable(variable);
+                }
+                for (uint64_t variableIndex = 0; variableIndex < integerVariables.size(); ++variableIndex) {
+                    std::vector<int64_t> const& values = integerValues[variableIndex];
+                    if (values.empty()) {
+                        builder.addVariable(integerVariables[variableIndex]);
+                    } else {
+                        auto minMax = std::minmax_element(values.begin(), values.end());
+                        builder.addVariable(integerVariables[variableIndex], *minMax.first, *minMax.second);
+                    }
+                }
+                for (auto const& state : nonEmptyStates) {
+                    std::vector<bool> stateBooleanValues;
+                    stateBooleanValues.reserve(booleanValues.size());
+                    for (auto const& values : booleanValues) {
+                        stateBooleanValues.push_back(values[state] != 0);
+                    }
+                    std::vector<int64_t> stateIntegerValues;
+                    stateIntegerValues.reserve(integerValues.size());
+                    for (auto const& values : integerValues) {
+                        stateIntegerValues.push_back(values[state]);
+                    }
+                    builder.addState(state, std::move(stateBooleanValues), std::move(stateIntegerValues));
+                }
+                components.stateValuations = builder.build(numberOfStates);
+            }
+        }
+
+        std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename, std::shared_ptr<storm::expressions::ExpressionManager> const& manager) {
+            MappedFile file(filename.c_str());
+            BinaryReader reader(file.getData(), file.getDataEnd());
+
+            // Read the header.
+            STORM_LOG_THROW(std::memcmp(reader.advance(sizeof(storm::utility::binaryformat::magic)), storm::utility::binaryformat::magic, sizeof(storm::utility::binaryformat::magic)) == 0, storm::exceptions::WrongFormatException, "The file " << filename << " is not a binary model file.");
+            uint64_t version = reader.readNumber();
+            STORM_LOG_THROW(version == storm::utility::binaryformat::version, storm::exceptions::WrongFormatException, "The binary model file " << filename << " has version " << version << ", but only version " << storm::utility::binaryformat::version << " is supported.");
+            STORM_LOG_THROW(reader.readNumber() == storm::utility::binaryformat::byteOrderMark, storm::exceptions::WrongFormatException, "The binary model file " << filename << " was written on a machine with a different byte order.");
+            uint64_t typeNumber = reader.readNumber();
+            STORM_LOG_THROW(typeNumber <= static_cast<uint64_t>(storm::models::ModelType::Pomdp) && typeNumber != static_cast<uint64_t>(storm::models::ModelType::S2pg), storm::exceptions::WrongFormatException, "Unsupported model type in binary model file " << filename << ".");
+            storm::models::ModelType type = static_cast<storm::models::ModelType>(typeNumber);
+            uint64_t numberOfStates = reader.readNumber();
+            uint64_t numberOfChoices = reader.readNumber();
+            reader.readNumber(); // The number of transitions is only informative.
+
+            storm::storage::sparse::ModelComponents<double> components;
+            components.stateLabeling = storm::models::sparse::StateLabeling(numberOfStates);
+            components.rateTransitions = type == storm::models::ModelType::Ctmc;
+            std::unordered_map<std::string, std::pair<boost::optional<std::vector<double>>, boost::optional<std::vector<double>>>> rewardVectors;
+            typedef storm::storage::SparseMatrixIndexType IndexType;
+            typedef storm::storage::MatrixEntry<IndexType, double> EntryType;
+            static_assert(sizeof(IndexType) == 8 && sizeof(EntryType) == 16, "The binary format requires 64-bit indices and entries of 16 bytes.");
+            boost::optional<std::vector<IndexType>> rowGroupIndices;
+            boost::optional<std::vector<IndexType>> rowIndications;
+            boost::optional<std::vector<EntryType>> entries;
+
+            // Read the sections. Every section is read from a reader that is restricted to its payload, so that no
+            // section can read beyond its declared size.
+            bool sawEnd = false;
+            while (!sawEnd) {
+                SectionKind kind = static_cast<SectionKind>(reader.readNumber());
+                uint64_t payloadSize = reader.readNumber();
+                STORM_LOG_THROW(payloadSize <= reader.remaining() && payloadSize % 8 == 0, storm::exceptions::WrongFormatException, "Invalid payload size " << payloadSize << " of section of kind " << static_cast<uint64_t>(kind) << " in binary model file " << filename << ".");
+                char const* payload = reader.advance(payloadSize);
+                BinaryReader section(payload, payload + payloadSize);
+                switch (kind) {
+                    case SectionKind::RowGroupIndices:
+                        rowGroupIndices = section.readArray<IndexType>(numberOfStates + 1);
+                        break;
+                    case SectionKind::RowIndications:
+                        rowIndications = section.readArray<IndexType>(numberOfChoices + 1);
+                        break;
+                    case SectionKind::Entries:
+                        entries = section.readArray<EntryType>(payloadSize / sizeof(EntryType));
+                        break;
+                    case SectionKind::StateLabel: {
+                        std::string label = section.readString();
+                        components.stateLabeling.addLabel(label, section.readBitVector(numberOfStates));
+                        break;
+                    }
+                    case SectionKind::ChoiceLabel: {
+                        if (!components.choiceLabeling) {
+                            components.choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfChoices);
+                        }
+                        std::string label = section.readString();
+                        components.choiceLabeling->addLabel(label, section.readBitVector(numberOfChoices));
+                        break;
+                    }
+                    case SectionKind::StateRewards: {
+                        std::string name = section.readString();
+                        rewardVectors[name].first = section.readArray<double>(numberOfStates);
+                        break;
+                    }
+                    case SectionKind::StateActionRewards: {
+                        std::string name = section.readString();
+                        rewardVectors[name].second = section.readArray<double>(numberOfChoices);
+                        break;
+                    }
+                    case SectionKind::ExitRates:
+                        components.exitRates = section.readArray<double>(numberOfStates);
+                        break;
+                    case SectionKind::MarkovianStates:
+                        components.markovianStates = section.readBitVector(numberOfStates);
+                        break;
+                    case SectionKind::Observations: {
+                        std::vector<uint64_t> observations = section.readArray<uint64_t>(numberOfStates);
+                        components.observabilityClasses = std::vector<uint32_t>(observations.begin(), observations.end());
+                        break;
+                    }
+                    case SectionKind::StateValuations:
+                        if (manager) {
+                            readStateValuations(section, numberOfStates, *manager, components);
+                        } else {
+                            section.advance(payloadSize);
+                        }
+                        break;
+                    case SectionKind::End:
+                        sawEnd = true;
+                        break;
+                    default:
+                        // Sections that are unknown to this version are skipped.
+                        STORM_LOG_WARN("Skipping unknown section of kind " << static_cast<uint64_t>(kind) << " in binary model file " << filename << ".");
+                        section.advance(payloadSize);
+                }
+                STORM_LOG_THROW(section.remaining() == 0, storm::exceptions::WrongFormatException, "The payload size " << payloadSize << " of section of kind " << static_cast<uint64_t>(kind) << " in binary model file " << filename << " does not match its contents.");
+            }
+
+            // Check the transition matrix before handing it over, as the matrix itself does not validate its contents.
+            STORM_LOG_THROW(rowIndications && entries, storm::exceptions::WrongFormatException, "The binary model file " << filename << " does not contain a transition matrix.");
+            bool deterministic = type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc;
+            if (deterministic) {
+                STORM_LOG_THROW(!rowGroupIndices && numberOfChoices == numberOfStates, storm::exceptions::WrongFormatException, "The deterministic model in binary model file " << filename << " has " << numberOfChoices << " choices for " << numberOfStates << " states.");
+            } else {
+                STORM_LOG_THROW(rowGroupIndices, storm::exceptions::WrongFormatException, "The nondeterministic model in binary model file " << filename << " does not contain row group indices.");
+                checkIndices(*rowGroupIndices, numberOfChoices, "row group indices", filename);
+            }
+            checkIndices(*rowIndications, entries->size(), "row indications", filename);
+            for (auto const& entry : *entries) {
+                STORM_LOG_THROW(entry.getColumn() < numberOfStates, storm::exceptions::WrongFormatException, "Column index " << entry.getColumn() << " in binary model file " << filename << " is out of bounds.");
+            }
+            components.transitionMatrix = storm::storage::SparseMatrix<double>(numberOfStates, std::move(*rowIndications), std::move(*entries), std::move(rowGroupIndices));
+            for (auto& rewardVector : rewardVectors) {
+                components.rewardModels.emplace(rewardVector.first, storm::models::sparse::StandardRewardModel<double>(std::move(rewardVector.second.first), std::move(rewardVector.second.second)));
+            }
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+
+    } // namespace parser
+} // namespace storm
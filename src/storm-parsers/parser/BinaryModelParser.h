@@ -0,0 +1,37 @@
+#ifndef STORM_PARSER_BINARYMODELPARSER_H_
+#define STORM_PARSER_BINARYMODELPARSER_H_
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for models in the binary format written by storm::exporter::exportSparseModelAsBinary. The file is
+         * mapped into memory and every array of the model is copied from it exactly once into its final place. The
+         * sizes of all sections and the structure of the transition matrix are validated before the model is built.
+         */
+        class BinaryModelParser {
+        public:
+
+            /*!
+             * Load a model in the binary format from a file.
+             *
+             * @param filename The file to load.
+             * @param manager If given, the state valuations stored in the file are loaded. Their variables are taken
+             * from the manager or declared in it if it does not contain them yet. Otherwise, state valuations are skipped.
+             *
+             * @return A sparse model
+             * @throws WrongFormatException If the file is not a valid binary model file.
+             */
+            static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename, std::shared_ptr<storm::expressions::ExpressionManager> const& manager = nullptr);
+        };
+
+    } // namespace parser
+} // namespace storm
+
+#endif /* STORM_PARSER_BINARYMODELPARSER_H_ */
@@ -1,11 +1,19 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <regex>
+#include <type_traits>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/utility/GzipInputStreamBuffer.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -26,6 +34,7 @@
 #include "storm/utility/file.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 
 
 namespace storm {
@@ -38,6 +47,13 @@ namespace storm {
             STORM_LOG_INFO("Reading from file " << filename);
             std::ifstream file;
             storm::utility::openFile(filename, file);
+            // Files whose name ends with '.gz' are decompressed while reading.
+            bool compressed = storm::utility::isGzipFile(filename);
+            std::unique_ptr<storm::utility::GzipInputStreamBuffer> decompressor;
+            if (compressed) {
+                decompressor = std::make_unique<storm::utility::GzipInputStreamBuffer>(file);
+            }
+            std::istream input(compressed ? static_cast<std::streambuf*>(decompressor.get()) : file.rdbuf());
             std::string line;
 
             // Initialize
@@ -52,7 +68,7 @@ namespace storm {
             std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
 
             // Parse header
-            while (storm::utility::getline(file, line)) {
+            while (storm::utility::getline(input, line)) {
                 if (line.empty() || boost::starts_with(line, "//")) {
                     continue;
                 }
@@ -69,7 +85,7 @@ namespace storm {
                 } else if (line == "@parameters") {
                     // Parse parameters
                     STORM_LOG_THROW(!sawParameters, storm::exceptions::WrongFormatException, "Parameters declared twice");
-                    storm::utility::getline(file, line);
+                    storm::utility::getline(input, line);
                     if (line != "") {
                         std::vector<std::string> parameters;
                         boost::split(parameters, line, boost::is_any_of(" "));
@@ -82,7 +98,7 @@ namespace storm {
 
                 } else if (line == "@placeholders") {
                     // Parse placeholders
-                    while (storm::utility::getline(file, line)) {
+                    while (storm::utility::getline(input, line)) {
                         size_t posColon = line.find(':');
                         STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found.");
                         std::string placeName = line.substr(0, posColon - 1);
@@ -92,7 +108,7 @@ namespace storm {
                         STORM_LOG_TRACE("Placeholder " << placeName << " for value " << value);
                         auto ret = placeholders.insert(std::make_pair(placeName.substr(1), value));
                         STORM_LOG_THROW(ret.second, storm::exceptions::WrongFormatException, "Placeholder '$" << placeName << "' was already defined before.");
-                        if (file.peek() == '@') {
+                        if (input.peek() == '@') {
                             // Next character is @ -> placeholder definitions ended
                             break;
                         }
@@ -100,16 +116,16 @@ namespace storm {
                 } else if (line == "@reward_models") {
                     // Parse reward models
                     STORM_LOG_THROW(rewardModelNames.empty(), storm::exceptions::WrongFormatException, "Reward model names declared twice");
-                    storm::utility::getline(file, line);
+                    storm::utility::getline(input, line);
                     boost::split(rewardModelNames, line, boost::is_any_of("\t "));
                 } else if (line == "@nr_states") {
                     // Parse no. of states
                     STORM_LOG_THROW(nrStates == 0, storm::exceptions::WrongFormatException, "Number states declared twice");
-                    storm::utility::getline(file, line);
+                    storm::utility::getline(input, line);
                     nrStates = parseNumber<size_t>(line);
                 } else if (line == "@nr_choices") {
                     STORM_LOG_THROW(nrChoices == 0, storm::exceptions::WrongFormatException, "Number of actions declared twice");
-                    storm::utility::getline(file, line);
+                    storm::utility::getline(input, line);
                     nrChoices = parseNumber<size_t>(line);
                 } else if (line == "@model") {
                     // Parse rest of the model
@@ -119,7 +135,15 @@ namespace storm {
                     STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException, "No. of actions (@nr_choices) has to be declared before model.");
                     STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
                     // Construct model components
-                    modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    // The states are parsed in parallel from the mapped file, which is impossible for compressed files.
+                    STORM_LOG_INFO_COND(!compressed || options.numberOfThreads <= 1, "Parsing the states of the compressed file " << filename << " sequentially.");
+                    if (options.numberOfThreads > 1 && std::is_same<ValueType, double>::value && !compressed) {
+                        uint64_t offset = static_cast<uint64_t>(input.tellg());
+                        storm::utility::closeFile(file);
+                        modelComponents = parseStatesParallel(filename, offset, type, nrStates, nrChoices, placeholders, rewardModelNames, options);
+                        return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
+                    }
+                    modelComponents = parseStates(input, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
                     break;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -395,6 +419,456 @@ namespace storm {
             return modelComponents;
         }
 
+        namespace {
+            typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double> DrnMatrixEntry;
+
+            // The result of parsing a chunk of consecutive states of a DRN file. States and rows are numbered relative
+            // to the first state (row) of the chunk.
+            struct DrnChunk {
+                char const* begin;
+                char const* end;
+
+                uint64_t firstState = 0;
+                uint64_t numberOfStates = 0;
+                // The number of rows of every state and the number of entries of every row.
+                std::vector<uint64_t> rowGroupSizes;
+                std::vector<uint64_t> rowSizes;
+                std::vector<DrnMatrixEntry> entries;
+                std::vector<double> exitRates;
+                std::vector<uint32_t> observations;
+                // The rewards for every reward model. A vector ends after the last non-zero reward of the chunk.
+                std::vector<std::vector<double>> stateRewards;
+                std::vector<std::vector<double>> actionRewards;
+                std::unordered_map<std::string, std::vector<uint64_t>> stateLabels;
+                std::unordered_map<std::string, std::vector<uint64_t>> choiceLabels;
+            };
+
+            bool startsWith(char const* begin, char const* end, char const* prefix) {
+                uint64_t length = std::strlen(prefix);
+                return static_cast<uint64_t>(end - begin) >= length && std::memcmp(begin, prefix, length) == 0;
+            }
+
+            char const* skipBlanks(char const* position, char const* end) {
+                while (position != end && (*position == ' ' || *position == '\t')) {
+                    ++position;
+                }
+                return position;
+            }
+
+            char const* findCharacter(char const* position, char const* end, char character) {
+                char const* result = static_cast<char const*>(std::memchr(position, character, end - position));
+                return result == nullptr ? end : result;
+            }
+
+            uint64_t parseIndex(char const*& position, char const* end) {
+                char const* start = position;
+                uint64_t result = 0;
+                while (position != end && *position >= '0' && *position <= '9') {
+                    result = result * 10 + (*position - '0');
+                    ++position;
+                }
+                STORM_LOG_THROW(position != start, storm::exceptions::WrongFormatException, "Expected a number, but found '" << std::string(start, std::min<char const*>(end, start + 16)) << "'.");
+                return result;
+            }
+
+            double parseDoubleValue(char const* begin, char const* end, std::unordered_map<std::string, double> const& placeholders) {
+                begin = skipBlanks(begin, end);
+                while (end != begin && std::isspace(static_cast<unsigned char>(*(end - 1)))) {
+                    --end;
+                }
+                if (begin != end && *begin == '$') {
+                    auto it = placeholders.find(std::string(begin + 1, end));
+                    STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << std::string(begin, end) << " unknown.");
+                    return it->second;
+                }
+
+                // As the mapped file is not null-terminated, the number is copied to a buffer before calling strtod.
+                char buffer[64];
+                uint64_t length = end - begin;
+                if (length > 0 && length < sizeof(buffer)) {
+                    std::memcpy(buffer, begin, length);
+                    buffer[length] = '\0';
+                    char* parsedEnd;
+                    double result = std::strtod(buffer, &parsedEnd);
+                    if (parsedEnd == buffer + length) {
+                        return result;
+                    }
+                }
+                // Use the default parser for everything else, e.g. fractions.
+                return parseNumber<double>(std::string(begin, end));
+            }
+
+            char const* parseRewards(char const* position, char const* end, std::vector<std::vector<double>>& rewards, uint64_t index, std::unordered_map<std::string, double> const& placeholders) {
+                char const* rewardsEnd = findCharacter(position, end, ']');
+                STORM_LOG_THROW(rewardsEnd != end, storm::exceptions::WrongFormatException, "] missing.");
+                ++position;
+                for (uint64_t rewardModel = 0; ; ++rewardModel) {
+                    char const* valueEnd = findCharacter(position, rewardsEnd, ',');
+                    double value = parseDoubleValue(position, valueEnd, placeholders);
+                    if (rewards.size() <= rewardModel) {
+                        rewards.resize(rewardModel + 1);
+                    }
+                    if (!storm::utility::isZero(value)) {
+                        if (rewards[rewardModel].size() <= index) {
+                            rewards[rewardModel].resize(index + 1, storm::utility::zero<double>());
+                        }
+                        rewards[rewardModel][index] = value;
+                    }
+                    if (valueEnd == rewardsEnd) {
+                        break;
+                    }
+                    position = valueEnd + 1;
+                }
+                return rewardsEnd + 1;
+            }
+
+            void parseLabels(char const* position, char const* end, uint64_t state, std::unordered_map<std::string, std::vector<uint64_t>>& labels) {
+                // Labels are separated by whitespace and can optionally be enclosed in quotation marks.
+                while ((position = skipBlanks(position, end)) != end) {
+                    char const* labelEnd;
+                    if (*position == '"') {
+                        ++position;
+                        labelEnd = findCharacter(position, end, '"');
+                        STORM_LOG_THROW(labelEnd != end, storm::exceptions::WrongFormatException, "Closing quotation mark missing.");
+                        labels[std::string(position, labelEnd)].push_back(state);
+                        position = labelEnd + 1;
+                    } else {
+                        labelEnd = position;
+                        while (labelEnd != end && !std::isspace(static_cast<unsigned char>(*labelEnd))) {
+                            ++labelEnd;
+                        }
+                        labels[std::string(position, labelEnd)].push_back(state);
+                        position = labelEnd;
+                    }
+                }
+            }
+
+            /*!
+             * Sorts the entries of the last row of the chunk by their column and adds up entries with the same column.
+             */
+            void normalizeLastRow(DrnChunk& chunk) {
+                auto rowBegin = chunk.entries.end() - chunk.rowSizes.back();
+                std::sort(rowBegin, chunk.entries.end(), [] (DrnMatrixEntry const& a, DrnMatrixEntry const& b) {
+                    return a.getColumn() < b.getColumn();
+                });
+                auto last = rowBegin;
+                for (auto it = rowBegin + 1; it != chunk.entries.end(); ++it) {
+                    if (it->getColumn() == last->getColumn()) {
+                        last->setValue(last->getValue() + it->getValue());
+                    } else {
+                        *(++last) = *it;
+                    }
+                }
+                chunk.entries.erase(last + 1, chunk.entries.end());
+                chunk.rowSizes.back() = chunk.entries.end() - rowBegin;
+            }
+
+            void parseChunk(DrnChunk& chunk, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, double> const& placeholders, bool buildChoiceLabeling) {
+                bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+                bool firstActionForState = true;
+                bool rowNeedsNormalization = false;
+                auto finishRow = [&] () {
+                    if (rowNeedsNormalization) {
+                        normalizeLastRow(chunk);
+                        rowNeedsNormalization = false;
+                    }
+                };
+
+                char const* position = chunk.begin;
+                while (position != chunk.end) {
+                    char const* lineEnd = findCharacter(position, chunk.end, '\n');
+                    char const* nextLine = lineEnd == chunk.end ? lineEnd : lineEnd + 1;
+                    while (lineEnd != position && *(lineEnd - 1) == '\r') {
+                        --lineEnd;
+                    }
+                    if (position == lineEnd || startsWith(position, lineEnd, "//")) {
+                        position = nextLine;
+                        continue;
+                    }
+
+                    if (startsWith(position, lineEnd, "state ")) {
+                        // New state
+                        if (chunk.numberOfStates > 0) {
+                            finishRow();
+                        }
+                        char const* current = position + 6;
+                        uint64_t state = parseIndex(current, lineEnd);
+                        if (chunk.numberOfStates == 0) {
+                            chunk.firstState = state;
+                        } else {
+                            STORM_LOG_THROW(state == chunk.firstState + chunk.numberOfStates, storm::exceptions::WrongFormatException, "State ids do not correspond.");
+                        }
+                        uint64_t localState = chunk.numberOfStates++;
+                        chunk.rowGroupSizes.push_back(1);
+                        chunk.rowSizes.push_back(0);
+                        firstActionForState = true;
+                        current = skipBlanks(current, lineEnd);
+
+                        if (continuousTime) {
+                            STORM_LOG_THROW(current != lineEnd && *current == '!', storm::exceptions::WrongFormatException, "Exit rate missing.");
+                            char const* rateEnd = findCharacter(current, lineEnd, ' ');
+                            chunk.exitRates.push_back(parseDoubleValue(current + 1, rateEnd, placeholders));
+                            current = skipBlanks(rateEnd, lineEnd);
+                        }
+                        if (current != lineEnd && *current == '[') {
+                            current = skipBlanks(parseRewards(current, lineEnd, chunk.stateRewards, localState, placeholders), lineEnd);
+                        }
+                        if (type == storm::models::ModelType::Pomdp) {
+                            STORM_LOG_THROW(current != lineEnd && *current == '{', storm::exceptions::WrongFormatException, "Expected an observation for state " << state << ".");
+                            ++current;
+                            chunk.observations.push_back(parseIndex(current, lineEnd));
+                            current = findCharacter(current, lineEnd, '}');
+                            STORM_LOG_THROW(current != lineEnd, storm::exceptions::WrongFormatException, "} missing.");
+                            ++current;
+                        }
+                        parseLabels(current, lineEnd, localState, chunk.stateLabels);
+
+                    } else if (startsWith(position, lineEnd, "\taction ")) {
+                        // New action
+                        STORM_LOG_THROW(chunk.numberOfStates > 0, storm::exceptions::WrongFormatException, "Action declared before the first state.");
+                        if (firstActionForState) {
+                            firstActionForState = false;
+                        } else {
+                            finishRow();
+                            ++chunk.rowGroupSizes.back();
+                            chunk.rowSizes.push_back(0);
+                        }
+                        uint64_t row = chunk.rowSizes.size() - 1;
+                        char const* current = position + 8;
+                        char const* nameEnd = findCharacter(current, lineEnd, ' ');
+                        if (buildChoiceLabeling && !(nameEnd - current == 11 && startsWith(current, nameEnd, "__NOLABEL__"))) {
+                            chunk.choiceLabels[std::string(current, nameEnd)].push_back(row);
+                        }
+                        current = skipBlanks(nameEnd, lineEnd);
+                        if (current != lineEnd && *current == '[') {
+                            parseRewards(current, lineEnd, chunk.actionRewards, row, placeholders);
+                        }
+
+                    } else {
+                        // New transition
+                        STORM_LOG_THROW(chunk.numberOfStates > 0, storm::exceptions::WrongFormatException, "Transition declared before the first state.");
+                        char const* colon = findCharacter(position, lineEnd, ':');
+                        STORM_LOG_THROW(colon != lineEnd, storm::exceptions::WrongFormatException, "':' not found in '" << std::string(position, lineEnd) << "'.");
+                        char const* current = skipBlanks(position, colon);
+                        uint64_t target = parseIndex(current, colon);
+                        STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException, "Target state " << target << " is greater than state size " << stateSize);
+                        double value = parseDoubleValue(colon + 1, lineEnd, placeholders);
+                        if (chunk.rowSizes.back() > 0 && target <= chunk.entries.back().getColumn()) {
+                            rowNeedsNormalization = true;
+                        }
+                        chunk.entries.emplace_back(target, value);
+                        ++chunk.rowSizes.back();
+                    }
+                    position = nextLine;
+                }
+                if (chunk.numberOfStates > 0) {
+                    finishRow();
+                }
+            }
+
+            /*!
+             * Copies the values of the chunk-local vector to the given position of the global vector.
+             */
+            template<typename T>
+            void copyToOffset(std::vector<T> const& source, std::vector<T>& target, uint64_t offset) {
+                std::copy(source.begin(), source.end(), target.begin() + offset);
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+        DirectEncodingParser<ValueType, RewardModelType>::parseStatesParallel(std::string const&, uint64_t, storm::models::ModelType, size_t, size_t, std::unordered_map<std::string, ValueType> const&, std::vector<std::string> const&, DirectEncodingParserOptions const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel parsing of DRN files is only supported for double.");
+        }
+
+        template<>
+        std::shared_ptr<storm::storage::sparse::ModelComponents<double>>
+        DirectEncodingParser<double>::parseStatesParallel(std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t,
+                                                          std::unordered_map<std::string, double> const& placeholders, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+            MappedFile file(filename.c_str());
+            STORM_LOG_THROW(offset <= file.getDataSize(), storm::exceptions::FileIoException, "Error while reading " << filename << ".");
+            char const* begin = file.getData() + offset;
+            char const* end = file.getDataEnd();
+
+            // Split the states into chunks that begin with a state declaration.
+            uint64_t numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(options.numberOfThreads * 4, (end - begin) / std::max<uint64_t>(1, options.minimalChunkSize)));
+            std::vector<char const*> boundaries = {begin};
+            for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+                char const* position = std::max(boundaries.back(), begin + (end - begin) * chunk / numberOfChunks);
+                do {
+                    position = findCharacter(position, end, '\n');
+                    if (position != end) {
+                        ++position;
+                    }
+                } while (position != end && !startsWith(position, end, "state "));
+                if (position != end && position != boundaries.back()) {
+                    boundaries.push_back(position);
+                }
+            }
+            boundaries.push_back(end);
+            std::vector<DrnChunk> chunks(boundaries.size() - 1);
+            STORM_LOG_INFO("Parsing the states in " << chunks.size() << " chunks with " << options.numberOfThreads << " threads.");
+
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalInstance(options.numberOfThreads);
+            pool.execute(chunks.size(), [&] (uint64_t index) {
+                if (storm::utility::resources::isTerminate()) {
+                    return;
+                }
+                chunks[index].begin = boundaries[index];
+                chunks[index].end = boundaries[index + 1];
+                parseChunk(chunks[index], type, stateSize, placeholders, options.buildChoiceLabeling);
+            });
+            STORM_LOG_THROW(!storm::utility::resources::isTerminate(), storm::exceptions::AbortException, "Aborted while parsing the states.");
+
+            // Compute the positions of the chunks in the merged model.
+            bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+            bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+            std::vector<uint64_t> stateOffsets, rowOffsets, entryOffsets;
+            uint64_t numberOfStates = 0;
+            uint64_t numberOfRows = 0;
+            uint64_t numberOfEntries = 0;
+            uint64_t numberOfStateRewardModels = 0;
+            uint64_t numberOfActionRewardModels = 0;
+            for (auto const& chunk : chunks) {
+                STORM_LOG_THROW(chunk.numberOfStates == 0 || chunk.firstState == numberOfStates, storm::exceptions::WrongFormatException, "State ids do not correspond.");
+                stateOffsets.push_back(numberOfStates);
+                rowOffsets.push_back(numberOfRows);
+                entryOffsets.push_back(numberOfEntries);
+                numberOfStates += chunk.numberOfStates;
+                numberOfRows += chunk.rowSizes.size();
+                numberOfEntries += chunk.entries.size();
+                numberOfStateRewardModels = std::max<uint64_t>(numberOfStateRewardModels, chunk.stateRewards.size());
+                numberOfActionRewardModels = std::max<uint64_t>(numberOfActionRewardModels, chunk.actionRewards.size());
+            }
+            STORM_LOG_THROW(numberOfStates == stateSize, storm::exceptions::WrongFormatException, "Expected " << stateSize << " states, but found " << numberOfStates << ".");
+            STORM_LOG_THROW(nonDeterministic || numberOfRows == numberOfStates, storm::exceptions::WrongFormatException, "States of deterministic models must not have multiple actions.");
+
+            // Allocate the merged components. Reward vectors are only created if some chunk has a non-zero reward.
+            std::vector<storm::storage::SparseMatrixIndexType> rowIndications(numberOfRows + 1);
+            std::vector<DrnMatrixEntry> columnsAndValues(numberOfEntries);
+            boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> rowGroupIndices;
+            if (nonDeterministic) {
+                rowGroupIndices = std::vector<storm::storage::SparseMatrixIndexType>(numberOfStates + 1);
+            }
+            auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<double>>();
+            modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
+            if (continuousTime) {
+                modelComponents->exitRates = std::vector<double>(stateSize);
+            }
+            std::vector<std::vector<double>> stateRewards(numberOfStateRewardModels);
+            std::vector<std::vector<double>> actionRewards(numberOfActionRewardModels);
+            for (auto const& chunk : chunks) {
+                for (uint64_t rewardModel = 0; rewardModel < chunk.stateRewards.size(); ++rewardModel) {
+                    if (!chunk.stateRewards[rewardModel].empty() && stateRewards[rewardModel].empty()) {
+                        stateRewards[rewardModel].resize(stateSize, storm::utility::zero<double>());
+                    }
+                }
+                for (uint64_t rewardModel = 0; rewardModel < chunk.actionRewards.size(); ++rewardModel) {
+                    if (!chunk.actionRewards[rewardModel].empty() && actionRewards[rewardModel].empty()) {
+                        actionRewards[rewardModel].resize(numberOfRows, storm::utility::zero<double>());
+                    }
+                }
+            }
+
+            // Copy the chunks into the merged components.
+            pool.execute(chunks.size(), [&] (uint64_t index) {
+                DrnChunk& chunk = chunks[index];
+                copyToOffset(chunk.entries, columnsAndValues, entryOffsets[index]);
+                uint64_t entry = entryOffsets[index];
+                for (uint64_t row = 0; row < chunk.rowSizes.size(); ++row) {
+                    rowIndications[rowOffsets[index] + row] = entry;
+                    entry += chunk.rowSizes[row];
+                }
+                if (rowGroupIndices) {
+                    uint64_t row = rowOffsets[index];
+                    for (uint64_t state = 0; state < chunk.numberOfStates; ++state) {
+                        rowGroupIndices.get()[stateOffsets[index] + state] = row;
+                        row += chunk.rowGroupSizes[state];
+                    }
+                }
+                if (continuousTime) {
+                    copyToOffset(chunk.exitRates, modelComponents->exitRates.get(), stateOffsets[index]);
+                }
+                if (type == storm::models::ModelType::Pomdp) {
+                    copyToOffset(chunk.observations, modelComponents->observabilityClasses.get(), stateOffsets[index]);
+                }
+                for (uint64_t rewardModel = 0; rewardModel < chunk.stateRewards.size(); ++rewardModel) {
+                    copyToOffset(chunk.stateRewards[rewardModel], stateRewards[rewardModel], stateOffsets[index]);
+                }
+                for (uint64_t rewardModel = 0; rewardModel < chunk.actionRewards.size(); ++rewardModel) {
+                    copyToOffset(chunk.actionRewards[rewardModel], actionRewards[rewardModel], rowOffsets[index]);
+                }
+                std::vector<DrnMatrixEntry>().swap(chunk.entries);
+            });
+            rowIndications.back() = numberOfEntries;
+            if (rowGroupIndices) {
+                rowGroupIndices.get().back() = numberOfRows;
+            }
+            modelComponents->transitionMatrix = storm::storage::SparseMatrix<double>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+            STORM_LOG_TRACE("Built matrix");
+
+            if (type == storm::models::ModelType::Ctmc) {
+                // We parse rates for continuous time models.
+                modelComponents->rateTransitions = true;
+            } else if (type == storm::models::ModelType::MarkovAutomaton) {
+                modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+                for (uint64_t state = 0; state < stateSize; ++state) {
+                    if (!storm::utility::isZero(modelComponents->exitRates.get()[state])) {
+                        modelComponents->markovianStates.get().set(state);
+                    }
+                }
+            }
+
+            // Merge the labels.
+            std::unordered_map<std::string, storm::storage::BitVector> stateLabels;
+            std::unordered_map<std::string, storm::storage::BitVector> choiceLabels;
+            for (uint64_t index = 0; index < chunks.size(); ++index) {
+                for (auto const& labelStates : chunks[index].stateLabels) {
+                    auto labelIt = stateLabels.emplace(labelStates.first, storm::storage::BitVector(stateSize)).first;
+                    for (auto const& state : labelStates.second) {
+                        labelIt->second.set(stateOffsets[index] + state);
+                    }
+                }
+                for (auto const& labelRows : chunks[index].choiceLabels) {
+                    auto labelIt = choiceLabels.emplace(labelRows.first, storm::storage::BitVector(numberOfRows)).first;
+                    for (auto const& row : labelRows.second) {
+                        labelIt->second.set(rowOffsets[index] + row);
+                    }
+                }
+            }
+            modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+            for (auto& label : stateLabels) {
+                modelComponents->stateLabeling.addLabel(label.first, std::move(label.second));
+            }
+            if (options.buildChoiceLabeling) {
+                modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfRows);
+                for (auto& label : choiceLabels) {
+                    modelComponents->choiceLabeling.get().addLabel(label.first, std::move(label.second));
+                }
+            }
+
+            // Build reward models
+            uint64_t numRewardModels = std::max(numberOfStateRewardModels, numberOfActionRewardModels);
+            for (uint64_t i = 0; i < numRewardModels; ++i) {
+                std::string rewardModelName;
+                if (rewardModelNames.size() <= i) {
+                    rewardModelName = "rew" + std::to_string(i);
+                } else {
+                    rewardModelName = rewardModelNames[i];
+                }
+                boost::optional<std::vector<double>> stateRewardVector, actionRewardVector;
+                if (i < stateRewards.size() && !stateRewards[i].empty()) {
+                    stateRewardVector = std::move(stateRewards[i]);
+                }
+                if (i < actionRewards.size() && !actionRewards[i].empty()) {
+                    actionRewardVector = std::move(actionRewards[i]);
+                }
+                modelComponents->rewardModels.emplace(rewardModelName, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewardVector), std::move(actionRewardVector)));
+            }
+            STORM_LOG_TRACE("Built reward models");
+            return modelComponents;
+        }
+
         template<typename ValueType, typename RewardModelType>
         ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
                                                                                ValueParser<ValueType> const& valueParser) {
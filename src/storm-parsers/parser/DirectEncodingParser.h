@@ -11,6 +11,10 @@ namespace storm {
 
         struct DirectEncodingParserOptions {
             bool buildChoiceLabeling = false;
+            // The number of threads that parse the states (only supported for double).
+            uint64_t numberOfThreads = 1;
+            // The minimal number of bytes of the state section that are parsed by one task when parsing in parallel.
+            uint64_t minimalChunkSize = 1ull << 20;
         };
         /*!
          *	Parser for models in the DRN format with explicit encoding.
@@ -20,7 +24,9 @@ namespace storm {
         public:
 
             /*!
-             * Load a model in DRN format from a file and create the model.
+             * Load a model in DRN format from a file and create the model. Files whose name ends with '.gz' are
+             * decompressed while reading (which requires that storm was built with zlib) and their states are always
+             * parsed sequentially.
              *
              * @param file The DRN file to be parsed.
              *
@@ -46,6 +52,25 @@ namespace storm {
             parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
                         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+            /*!
+             * Parse states in parallel. The part of the file that contains the states is split into chunks at the
+             * beginning of state declarations, the chunks are parsed concurrently and the results are then merged.
+             *
+             * @param filename The DRN file.
+             * @param offset The position in the file at which the states begin.
+             * @param type Model type.
+             * @param stateSize No. of states
+             * @param nrChoices No. of choices
+             * @param placeholders Placeholders for values.
+             * @param rewardModelNames Names of reward models.
+             * @param options The options of the parser.
+             *
+             * @return The model components.
+             */
+            static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+            parseStatesParallel(std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
+                                std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
             /*!
              * Parse value from string while using placeholders.
              * @param valueStr String.
@@ -41,6 +41,22 @@ namespace storm {
             
             return result;
         }
+        
+        template<typename T>
+        std::unique_ptr<gmm::csr_matrix<T>> GmmxxAdapter<T>::toGmmxxSparseMatrix(storm::storage::CompactSparseMatrix<T> const& matrix) {
+            STORM_LOG_TRACE("Converting compact " << matrix.getRowCount() << "x" << matrix.getColumnCount() << " matrix with " << matrix.getEntryCount() << " non-zeros to gmm++ format.");
+            
+            // Prepare the resulting matrix.
+            std::unique_ptr<gmm::csr_matrix<T>> result(new gmm::csr_matrix<T>(matrix.getRowCount(), matrix.getColumnCount()));
+            
+            std::copy(matrix.getRowIndications().begin(), matrix.getRowIndications().end(), result->jc.begin());
+            result->ir.assign(matrix.getColumns().begin(), matrix.getColumns().end());
+            result->pr.assign(matrix.getValues().begin(), matrix.getValues().end());
+            
+            STORM_LOG_TRACE("Done converting matrix to gmm++ format.");
+            
+            return result;
+        }
 
         template class GmmxxAdapter<double>;
         
@@ -5,6 +5,7 @@
 #include "storm/utility/gmm.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 namespace storm {
     namespace adapters {
@@ -17,6 +18,13 @@ namespace storm {
              * @return A pointer to a row-major sparse matrix in gmm++ format.
              */
             static std::unique_ptr<gmm::csr_matrix<T>> toGmmxxSparseMatrix(storm::storage::SparseMatrix<T> const& matrix);
+            
+            /*!
+             * Converts a compact sparse matrix into a sparse matrix in the gmm++ format. As both formats store the
+             * columns and values in separate arrays, this amounts to copying the arrays.
+             * @return A pointer to a row-major sparse matrix in gmm++ format.
+             */
+            static std::unique_ptr<gmm::csr_matrix<T>> toGmmxxSparseMatrix(storm::storage::CompactSparseMatrix<T> const& matrix);
         };
         
     }
@@ -2,6 +2,7 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -24,6 +25,7 @@
 #include "storm/generator/JaniNextStateGenerator.h"
 
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/CompositionalModelBuilder.h"
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
 #include "storm/utility/macros.h"
@@ -92,6 +94,14 @@ namespace storm {
 
                 return builder.build();
             } else {
+                if (options.isBuildCompositionallySet() && model.isPrismProgram()) {
+                    storm::builder::CompositionalModelBuilder<ValueType> builder(model.asPrismProgram(), options);
+                    if (builder.isSupported()) {
+                        return builder.build();
+                    }
+                    STORM_LOG_WARN("Building the model monolithically, because it can not be built compositionally.");
+                }
+
                 std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
                 if (model.isPrismProgram()) {
                     generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options);
@@ -145,6 +155,16 @@ namespace storm {
             return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const&, std::shared_ptr<storm::expressions::ExpressionManager> const& = nullptr) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models in the binary format are not supported.");
+        }
+        
+        template<>
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& binaryFile, std::shared_ptr<storm::expressions::ExpressionManager> const& manager) {
+            return storm::parser::BinaryModelParser::parseModel(binaryFile, manager);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
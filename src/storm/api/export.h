@@ -3,10 +3,13 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/BinaryModelExporter.h"
 #include "storm/utility/DDEncodingExporter.h"
 #include "storm/utility/file.h"
+#include "storm/utility/GzipOutputStreamBuffer.h"
 #include "storm/utility/macros.h"
 #include "storm/storage/Scheduler.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     
@@ -19,15 +22,34 @@ namespace storm {
         void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& filename);
 
         template <typename ValueType>
-        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders=true) {
+        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders=true, uint64_t numberOfThreads = 1) {
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
             storm::exporter::DirectEncodingOptions options;
             options.allowPlaceholders = allowPlaceholders;
-            storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+            options.numberOfThreads = numberOfThreads;
+            if (storm::utility::isGzipFile(filename)) {
+                storm::utility::GzipOutputStreamBuffer buffer(stream);
+                std::ostream compressedStream(&buffer);
+                compressedStream.precision(stream.precision());
+                storm::exporter::explicitExportSparseModel(compressedStream, model, parameterNames, options);
+                buffer.finish();
+            } else {
+                storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+            }
             storm::utility::closeFile(stream);
         }
 
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models can not be exported in the binary format.");
+        }
+
+        template <>
+        inline void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            storm::exporter::exportSparseModelAsBinary(filename, model);
+        }
+
         template<storm::dd::DdType Type, typename ValueType>
         void exportSparseModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type,ValueType>> const& model, std::string const& filename) {
             storm::exporter::explicitExportSymbolicModel(filename, model);
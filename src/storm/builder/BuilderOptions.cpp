@@ -39,7 +39,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), compileExpressions(true), indexGuards(true), buildCompositionally(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -173,6 +173,18 @@ namespace storm {
         bool BuilderOptions::isExplorationChecksSet() const {
             return explorationChecks;
         }
+
+        bool BuilderOptions::isCompileExpressionsSet() const {
+            return compileExpressions;
+        }
+
+        bool BuilderOptions::isIndexGuardsSet() const {
+            return indexGuards;
+        }
+
+        bool BuilderOptions::isBuildCompositionallySet() const {
+            return buildCompositionally;
+        }
         
         bool BuilderOptions::isShowProgressSet() const {
             return showProgress;
@@ -186,6 +198,21 @@ namespace storm {
             explorationChecks = newValue;
             return *this;
         }
+
+        BuilderOptions& BuilderOptions::setCompileExpressions(bool newValue) {
+            compileExpressions = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setIndexGuards(bool newValue) {
+            indexGuards = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setBuildCompositionally(bool newValue) {
+            buildCompositionally = newValue;
+            return *this;
+        }
         
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
@@ -110,6 +110,9 @@ namespace storm {
             bool isBuildAllRewardModelsSet() const;
             bool isBuildAllLabelsSet() const;
             bool isExplorationChecksSet() const;
+            bool isCompileExpressionsSet() const;
+            bool isIndexGuardsSet() const;
+            bool isBuildCompositionallySet() const;
             bool isInferObservationsFromActionsSet() const;
             bool isShowProgressSet() const;
             bool isScaleAndLiftTransitionRewardsSet() const;
@@ -171,6 +174,25 @@ namespace storm {
              * @return this
              */
             BuilderOptions& setExplorationChecks(bool newValue = true);
+            /**
+             * Should guards and updates be compiled to bytecode that is evaluated directly on the compressed states
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setCompileExpressions(bool newValue = true);
+            /**
+             * Should the commands of PRISM programs be indexed by the values their guards require, so that commands that
+             * are certainly disabled in a state are skipped without evaluating their guards
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setIndexGuards(bool newValue = true);
+            /**
+             * Should the modules of PRISM programs be built and minimized one after the other (if possible)
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setBuildCompositionally(bool newValue = true);
 
 
 
@@ -247,6 +269,15 @@ namespace storm {
             /// A flag that stores whether exploration checks are to be performed.
             bool explorationChecks;
 
+            /// A flag that stores whether guards and updates are to be compiled to bytecode.
+            bool compileExpressions;
+
+            /// A flag that stores whether the commands of PRISM programs are to be indexed by their guards.
+            bool indexGuards;
+
+            /// A flag that stores whether the modules are to be built and minimized one after the other.
+            bool buildCompositionally;
+
             /// For POMDPs, should we allow inference of observation classes from different enabled actions.
             bool inferObservationsFromActions;
 
@@ -0,0 +1,209 @@
+#include "storm/builder/CompositionalModelBuilder.h"
+
+#include <set>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace builder {
+
+        namespace {
+            template<typename ValueType>
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> minimize(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc) {
+                typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>>::Options bisimulationOptions;
+                storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>> decomposition(*ctmc, bisimulationOptions);
+                decomposition.computeBisimulationDecomposition();
+                return decomposition.getQuotient();
+            }
+        }
+
+        template<typename ValueType>
+        CompositionalModelBuilder<ValueType>::CompositionalModelBuilder(storm::prism::Program const& program, BuilderOptions const& options) : program(program.substituteConstantsFormulas()), options(options), supported(false) {
+            std::string reason = analyzeProgram();
+            supported = reason.empty();
+            STORM_LOG_INFO_COND(supported, "The program can not be built compositionally, because " << reason << ".");
+        }
+
+        template<typename ValueType>
+        bool CompositionalModelBuilder<ValueType>::isSupported() const {
+            return supported;
+        }
+
+        template<typename ValueType>
+        std::string CompositionalModelBuilder<ValueType>::analyzeProgram() {
+            if (program.getModelType() != storm::prism::Program::ModelType::CTMC) {
+                return "it is not a CTMC";
+            }
+            if (program.getNumberOfGlobalBooleanVariables() > 0 || program.getNumberOfGlobalIntegerVariables() > 0) {
+                return "it has global variables";
+            }
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet()) {
+                return "deadlocks are not to be fixed, but the deadlocks of a module need not be deadlocks of the program";
+            }
+            if (program.hasInitialConstruct()) {
+                return "the initial states are given by an expression";
+            }
+            if (program.specifiesSystemComposition()) {
+                return "it specifies a system composition";
+            }
+            if ((options.isBuildAllRewardModelsSet() && program.getNumberOfRewardModels() > 0) || !options.getRewardModelNames().empty()) {
+                return "reward models are to be built";
+            }
+            if (options.isBuildChoiceLabelsSet() || options.isBuildStateValuationsSet() || options.isBuildChoiceOriginsSet()) {
+                return "choice labels, state valuations or choice origins are to be built";
+            }
+            if (options.hasTerminalStates() || options.isAddOutOfBoundsStateSet() || options.isAddOverlappingGuardLabelSet()) {
+                return "terminal states, an out-of-bounds state or the overlapping guards label are requested";
+            }
+            for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
+                if (program.getModuleIndicesByActionIndex(actionIndex).size() > 1) {
+                    return "the modules synchronize on action '" + program.getActionName(actionIndex) + "'";
+                }
+            }
+
+            // Check that every module only refers to its own variables.
+            for (auto const& module : program.getModules()) {
+                std::set<storm::expressions::Variable> moduleVariables = module.getAllExpressionVariables();
+                std::set<storm::expressions::Variable> usedVariables;
+                for (auto const& command : module.getCommands()) {
+                    command.getGuardExpression().gatherVariables(usedVariables);
+                    for (auto const& update : command.getUpdates()) {
+                        update.getLikelihoodExpression().gatherVariables(usedVariables);
+                        for (auto const& assignment : update.getAssignments()) {
+                            assignment.getExpression().gatherVariables(usedVariables);
+                        }
+                    }
+                }
+                for (auto const& variable : usedVariables) {
+                    if (moduleVariables.count(variable) == 0) {
+                        return "module '" + module.getName() + "' refers to variable '" + variable.getName() + "' of another module";
+                    }
+                }
+            }
+
+            // Assign every label to the module whose variables it refers to. Labels without variables are assigned to
+            // all modules, which is fine, because labels are joined disjunctively upon composition.
+            moduleLabels.assign(program.getNumberOfModules(), {});
+            moduleExpressionLabels.assign(program.getNumberOfModules(), {});
+            auto getModuleIndices = [this] (storm::expressions::Expression const& expression) {
+                std::set<uint64_t> result;
+                for (auto const& variable : expression.getVariables()) {
+                    result.insert(program.getModuleIndexByVariable(variable.getName()));
+                }
+                if (result.empty()) {
+                    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                        result.insert(moduleIndex);
+                    }
+                }
+                return result;
+            };
+            for (auto const& label : program.getLabels()) {
+                if (!options.isBuildAllLabelsSet() && options.getLabelNames().count(label.getName()) == 0) {
+                    continue;
+                }
+                std::set<uint64_t> moduleIndices = getModuleIndices(label.getStatePredicateExpression());
+                if (moduleIndices.size() > 1 && !label.getStatePredicateExpression().getVariables().empty()) {
+                    return "label '" + label.getName() + "' refers to the variables of several modules";
+                }
+                for (auto const& moduleIndex : moduleIndices) {
+                    moduleLabels[moduleIndex].push_back(label);
+                }
+            }
+            for (auto const& expressionLabel : options.getExpressionLabels()) {
+                std::set<uint64_t> moduleIndices = getModuleIndices(expressionLabel.second);
+                if (moduleIndices.size() > 1 && !expressionLabel.second.getVariables().empty()) {
+                    return "the expression '" + expressionLabel.first + "' refers to the variables of several modules";
+                }
+                for (auto const& moduleIndex : moduleIndices) {
+                    moduleExpressionLabels[moduleIndex].push_back(expressionLabel);
+                }
+            }
+
+            return "";
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> CompositionalModelBuilder<ValueType>::buildModule(uint64_t moduleIndex) const {
+            // Create the program that only consists of the module.
+            storm::prism::Program moduleProgram(program.getManager().getSharedPointer(), program.getModelType(), program.getConstants(), {}, {}, {}, {program.getModule(moduleIndex)}, program.getActionNameToIndexMapping(), {}, moduleLabels[moduleIndex], {}, boost::none, boost::none, false);
+
+            BuilderOptions moduleOptions;
+            for (auto const& label : moduleLabels[moduleIndex]) {
+                moduleOptions.addLabel(label.getName());
+            }
+            for (auto const& expressionLabel : moduleExpressionLabels[moduleIndex]) {
+                moduleOptions.addLabel(expressionLabel.second);
+            }
+            moduleOptions.setExplorationChecks(options.isExplorationChecksSet());
+            moduleOptions.setCompileExpressions(options.isCompileExpressionsSet());
+            moduleOptions.setIndexGuards(options.isIndexGuardsSet());
+
+            auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(moduleProgram, moduleOptions);
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ctmc = ExplicitModelBuilder<ValueType>(generator).build()->template as<storm::models::sparse::Ctmc<ValueType>>();
+
+            // The composition is only in a deadlock if all modules are. Hence, the self-loops that fixed the deadlocks of
+            // the module are removed again and the deadlocks are fixed once the composition is complete.
+            storm::models::sparse::StateLabeling labeling = ctmc->getStateLabeling();
+            if (labeling.containsLabel("deadlock")) {
+                storm::storage::BitVector deadlockStates = labeling.getStates("deadlock");
+                labeling.removeLabel("deadlock");
+                ctmc = std::make_shared<storm::models::sparse::Ctmc<ValueType>>(ctmc->getTransitionMatrix().filterEntries(~deadlockStates), std::move(labeling));
+            }
+
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> result = minimize(ctmc);
+            STORM_LOG_INFO("Module '" << program.getModule(moduleIndex).getName() << "' has " << ctmc->getNumberOfStates() << " states, its quotient has " << result->getNumberOfStates() << " states.");
+            return result;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> CompositionalModelBuilder<ValueType>::build() {
+            STORM_LOG_THROW(supported, storm::exceptions::NotSupportedException, "The program can not be built compositionally.");
+
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> result = buildModule(0);
+            for (uint64_t moduleIndex = 1; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composition = ParallelCompositionBuilder<ValueType>::compose(result, buildModule(moduleIndex), false);
+                result = minimize(composition);
+                STORM_LOG_INFO("The composition of the first " << (moduleIndex + 1) << " modules has " << composition->getNumberOfStates() << " states, its quotient has " << result->getNumberOfStates() << " states.");
+            }
+
+            // Fix the deadlocks of the composition like the explicit model builder does, i.e., by a self-loop with rate one.
+            storm::storage::SparseMatrix<ValueType> const& matrix = result->getTransitionMatrix();
+            storm::storage::BitVector deadlockStates(result->getNumberOfStates());
+            storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount());
+            for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
+                if (matrix.getRow(state).getNumberOfEntries() == 0) {
+                    deadlockStates.set(state);
+                    builder.addNextValue(state, state, storm::utility::one<ValueType>());
+                } else {
+                    for (auto const& entry : matrix.getRow(state)) {
+                        builder.addNextValue(state, entry.getColumn(), entry.getValue());
+                    }
+                }
+            }
+            storm::models::sparse::StateLabeling labeling = result->getStateLabeling();
+            labeling.addLabel("deadlock", std::move(deadlockStates));
+
+            return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(builder.build(), std::move(labeling));
+        }
+
+        // Explicitly instantiate the class.
+        template class CompositionalModelBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class CompositionalModelBuilder<storm::RationalNumber>;
+        template class CompositionalModelBuilder<storm::RationalFunction>;
+#endif
+
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef STORM_BUILDER_COMPOSITIONALMODELBUILDER_H_
+#define STORM_BUILDER_COMPOSITIONALMODELBUILDER_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/models/sparse/Ctmc.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Builds the explicit model of a PRISM program module by module. Every module is built in isolation and
+         * minimized with respect to (strong) bisimulation. The minimized modules are then composed one after the other,
+         * where the intermediate compositions are minimized again. Hence, the unminimized model of the whole program is
+         * never built and the required memory is determined by the sizes of the quotients.
+         *
+         * This is only possible if the modules evolve independently, which is why the program has to be a CTMC whose
+         * modules neither synchronize nor share variables. Reward models, choice labels, state valuations and choice
+         * origins are not supported. Each label may refer to the variables of at most one module. Like for the whole
+         * program, deadlocks are fixed by a self-loop, but only in the states in which all modules are in a deadlock.
+         */
+        template<typename ValueType>
+        class CompositionalModelBuilder {
+        public:
+            /*!
+             * Prepares building the given program compositionally.
+             *
+             * @param program The program to build.
+             * @param options The options that determine which labels are to be built.
+             */
+            CompositionalModelBuilder(storm::prism::Program const& program, BuilderOptions const& options = BuilderOptions());
+
+            /*!
+             * Retrieves whether the program can be built compositionally. If not, the reason is logged upon construction.
+             */
+            bool isSupported() const;
+
+            /*!
+             * Builds the minimized model of the program. The program must be supported.
+             *
+             * @return The model, whose states are the classes of bisimilar states of the program.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+        private:
+            /*!
+             * Checks whether the program can be built compositionally and determines the labels of the modules.
+             *
+             * @return An explanation why the program is not supported or the empty string.
+             */
+            std::string analyzeProgram();
+
+            /*!
+             * Builds the (minimized) model of a single module.
+             */
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> buildModule(uint64_t moduleIndex) const;
+
+            // The program whose constants and formulas have been substituted.
+            storm::prism::Program program;
+
+            // The options given for building the whole program.
+            BuilderOptions options;
+
+            // For every module the labels and expression labels that are built with the module.
+            std::vector<std::vector<storm::prism::Label>> moduleLabels;
+            std::vector<std::vector<std::pair<std::string, storm::expressions::Expression>>> moduleExpressionLabels;
+
+            // Whether the program can be built compositionally.
+            bool supported;
+        };
+
+    }
+}
+
+#endif /* STORM_BUILDER_COMPOSITIONALMODELBUILDER_H_ */
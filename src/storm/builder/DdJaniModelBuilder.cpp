@@ -287,7 +287,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, storm::builder::DdVariableOrderOptions const& variableOrderOptions) : model(model), automata(), actionInformation(actionInformation), variableOrderOptions(variableOrderOptions) {
                 // Intentionally left empty.
             }
             
@@ -353,41 +353,45 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Collect the location variables and the non-transient variables, for which meta variables are created.
+                std::map<storm::expressions::Variable, std::string> locationVariableToAutomatonMap;
                 for (auto const& automatonName : this->automata) {
-                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
-                    
-                    // Start by creating a meta variable for the location of the automaton.
-                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-                    result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-                    result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-                    result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-                    result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-                    
-                    // Add the location variable to the row/column variables.
-                    result.rowMetaVariables.insert(variablePair.first);
-                    result.columnMetaVariables.insert(variablePair.second);
-                    
-                    // Add the legal range for the location variables.
-                    result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-                    result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+                    locationVariableToAutomatonMap.emplace(this->model.getAutomaton(automatonName).getLocationExpressionVariable(), automatonName);
+                }
+                std::map<storm::expressions::Variable, std::reference_wrapper<storm::jani::Variable const>> expressionVariableToVariableMap;
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    if (!variable.isTransient()) {
+                        expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), variable);
+                    }
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        if (!variable.isTransient()) {
+                            expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), variable);
+                        }
+                    }
                 }
                 
-                // Create global variables.
+                // Create the meta variables in the requested order.
+                for (auto const& expressionVariable : storm::builder::computeDdVariableOrder(this->model, variableOrderOptions)) {
+                    auto locationIt = locationVariableToAutomatonMap.find(expressionVariable);
+                    if (locationIt != locationVariableToAutomatonMap.end()) {
+                        createLocationVariable(this->model.getAutomaton(locationIt->second), result);
+                    } else {
+                        createVariable(expressionVariableToVariableMap.at(expressionVariable).get(), result);
+                    }
+                }
+                
+                // Compute the ranges of the global variables.
                 storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
                 for (auto const& variable : this->model.getGlobalVariables()) {
-                    // Only create the variable if it's non-transient.
-                    if (variable.isTransient()) {
-                        continue;
+                    if (!variable.isTransient()) {
+                        globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
-                    
-                    createVariable(variable, result);
-                    globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                 }
                 result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
                 
-                // Create the variables for the individual automata.
+                // Compute the identities and ranges of the individual automata.
                 for (auto const& automaton : this->model.getAutomata()) {
                     storm::dd::Bdd<Type> identity = result.manager->getBddOne();
                     storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -398,14 +402,13 @@ namespace storm {
                     identity &= variableIdentity;
                     range &= result.manager->getRange(locationVariables.first);
                     
-                    // Then create variables for the variables of the automaton.
+                    // Then add the variables of the automaton.
                     for (auto const& variable : automaton.getVariables()) {
-                        // Only create the variable if it's non-transient.
+                        // Only non-transient variables have meta variables.
                         if (variable.isTransient()) {
                             continue;
                         }
                         
-                        createVariable(variable, result);
                         identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                         range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
@@ -423,6 +426,25 @@ namespace storm {
                 return result;
             }
             
+            void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+                // Create a meta variable for the location of the automaton.
+                storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+                result.rowColumnMetaVariablePairs.push_back(variablePair);
+                
+                result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+                result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+                
+                // Add the location variable to the row/column variables.
+                result.rowMetaVariables.insert(variablePair.first);
+                result.columnMetaVariables.insert(variablePair.second);
+                
+                // Add the legal range for the location variables.
+                result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+                result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -479,6 +501,7 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            storm::builder::DdVariableOrderOptions variableOrderOptions;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -950,9 +973,36 @@ namespace storm {
                 // Prepare storage for the subautomata of the composition.
                 std::vector<AutomatonDd> subautomata;
 
+                uint64_t silentActionIndex = actionInformation.getActionIndex(storm::jani::Model::SILENT_ACTION_NAME);
+                if (this->model.isDeterministicModel()) {
+                    // In deterministic models, no local nondeterminism variables are used. Hence, all actions are
+                    // instantiated with offset zero and the subcompositions do not depend on each other, which lets us
+                    // build them in parallel (if supported by the DD library).
+                    std::vector<ActionInstantiations> subcompositionInstantiations(composition.getNumberOfSubcompositions());
+                    for (uint64_t subcompositionIndex = 0; subcompositionIndex < composition.getNumberOfSubcompositions(); ++subcompositionIndex) {
+                        ActionInstantiations& actionInstantiations = subcompositionInstantiations[subcompositionIndex];
+                        actionInstantiations[silentActionIndex].emplace_back(silentActionIndex, 0, isCtmc);
+                        for (uint64_t synchronizationVectorIndex = 0; synchronizationVectorIndex < composition.getNumberOfSynchronizationVectors(); ++synchronizationVectorIndex) {
+                            auto const& synchVector = composition.getSynchronizationVector(synchronizationVectorIndex);
+                            if (synchVector.getInput(subcompositionIndex) != storm::jani::SynchronizationVector::NO_ACTION_INPUT) {
+                                uint64_t actionIndex = actionInformation.getActionIndex(synchVector.getInput(subcompositionIndex));
+                                actionInstantiations[actionIndex].emplace_back(actionIndex, synchronizationVectorIndex, 0, isCtmc);
+                            }
+                        }
+                    }
+                    
+                    std::vector<boost::optional<AutomatonDd>> builtSubautomata(composition.getNumberOfSubcompositions());
+                    this->variables.manager->execute(composition.getNumberOfSubcompositions(), [&] (uint64_t subcompositionIndex) {
+                        builtSubautomata[subcompositionIndex] = boost::any_cast<AutomatonDd>(composition.getSubcomposition(subcompositionIndex).accept(*this, subcompositionInstantiations[subcompositionIndex]));
+                    });
+                    for (auto& subautomaton : builtSubautomata) {
+                        subautomata.push_back(std::move(subautomaton.get()));
+                    }
+                    return composeInParallel(subautomata, composition.getSynchronizationVectors());
+                }
+
                 // The outer loop iterates over the indices of the subcomposition, because the first subcomposition needs
                 // to be built before the second and so on.
-                uint64_t silentActionIndex = actionInformation.getActionIndex(storm::jani::Model::SILENT_ACTION_NAME);
                 for (uint64_t subcompositionIndex = 0; subcompositionIndex < composition.getNumberOfSubcompositions(); ++subcompositionIndex) {
                     // Now build a new set of action instantiations for the current subcomposition index.
                     ActionInstantiations actionInstantiations;
@@ -1490,14 +1540,21 @@ namespace storm {
             }
             
             ActionDd buildActionDdForActionInstantiation(storm::jani::Automaton const& automaton, ActionInstantiation const& instantiation) {
-                // Translate the individual edges.
-                std::vector<EdgeDd> edgeDds;
+                // Translate the individual edges (in parallel, if the DD library supports it).
+                std::vector<std::reference_wrapper<storm::jani::Edge const>> relevantEdges;
                 for (auto const& edge : automaton.getEdges()) {
                     if (edge.getActionIndex() == instantiation.actionIndex && edge.hasRate() == instantiation.isMarkovian()) {
-                        EdgeDd result = buildEdgeDd(automaton, edge);
-                        edgeDds.emplace_back(result);
+                        relevantEdges.push_back(edge);
                     }
                 }
+                std::vector<boost::optional<EdgeDd>> translatedEdges(relevantEdges.size());
+                this->variables.manager->execute(relevantEdges.size(), [&] (uint64_t index) {
+                    translatedEdges[index] = buildEdgeDd(automaton, relevantEdges[index].get());
+                });
+                std::vector<EdgeDd> edgeDds;
+                for (auto& edgeDd : translatedEdges) {
+                    edgeDds.emplace_back(std::move(edgeDd.get()));
+                }
                 
                 // Now combine the edges to a single action.
                 uint64_t localNondeterminismVariableOffset = instantiation.localNondeterminismVariableOffset;
@@ -1767,28 +1824,34 @@ namespace storm {
                 storm::dd::Bdd<Type> nonMarkovianActionGuards = this->variables.manager->getBddZero();
                 
                 storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                std::vector<std::reference_wrapper<ActionInstantiation const>> instantiations;
                 for (auto const& actionInstantiation : actionInstantiations) {
-                    uint64_t actionIndex = actionInstantiation.first;
-                    if (!automaton.hasEdgeLabeledWithActionIndex(actionIndex)) {
-                        continue;
-                    }
-                    bool inputEnabled = false;
-                    if (inputEnabledActionIndices.find(actionIndex) != inputEnabledActionIndices.end()) {
-                        inputEnabled = true;
-                    }
-                    for (auto const& instantiation : actionInstantiation.second) {
-                        STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "") << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action " << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ") << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
-                        ActionDd actionDd = buildActionDdForActionInstantiation(automaton, instantiation);
-                        if (inputEnabled) {
-                            actionDd.setIsInputEnabled();
-                        }
-                        if (applyMaximumProgress && isTopLevelAutomaton && !instantiation.isMarkovian()) {
-                            nonMarkovianActionGuards |= actionDd.guard;
-                        }
-                        STORM_LOG_TRACE("Used local nondeterminism variables are " << actionDd.getLowestLocalNondeterminismVariable() << " to " << actionDd.getHighestLocalNondeterminismVariable() << ".");
-                        result.actions[ActionIdentification(actionIndex, instantiation.synchronizationVectorIndex, instantiation.isMarkovian())] = actionDd;
-                        result.extendLocalNondeterminismVariables(actionDd.getLocalNondeterminismVariables());
+                    if (automaton.hasEdgeLabeledWithActionIndex(actionInstantiation.first)) {
+                        instantiations.insert(instantiations.end(), actionInstantiation.second.begin(), actionInstantiation.second.end());
+                    }
+                }
+                
+                // The action instantiations are independent of each other, so they are built in parallel (if supported).
+                std::vector<ActionDd> actionDds(instantiations.size());
+                this->variables.manager->execute(instantiations.size(), [&] (uint64_t index) {
+                    ActionInstantiation const& instantiation = instantiations[index];
+                    uint64_t actionIndex = instantiation.actionIndex;
+                    STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "") << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action " << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ") << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
+                    actionDds[index] = buildActionDdForActionInstantiation(automaton, instantiation);
+                });
+                
+                for (uint64_t index = 0; index < instantiations.size(); ++index) {
+                    ActionInstantiation const& instantiation = instantiations[index];
+                    ActionDd& actionDd = actionDds[index];
+                    if (inputEnabledActionIndices.find(instantiation.actionIndex) != inputEnabledActionIndices.end()) {
+                        actionDd.setIsInputEnabled();
+                    }
+                    if (applyMaximumProgress && isTopLevelAutomaton && !instantiation.isMarkovian()) {
+                        nonMarkovianActionGuards |= actionDd.guard;
                     }
+                    STORM_LOG_TRACE("Used local nondeterminism variables are " << actionDd.getLowestLocalNondeterminismVariable() << " to " << actionDd.getHighestLocalNondeterminismVariable() << ".");
+                    result.actions[ActionIdentification(instantiation.actionIndex, instantiation.synchronizationVectorIndex, instantiation.isMarkovian())] = actionDd;
+                    result.extendLocalNondeterminismVariables(actionDd.getLocalNondeterminismVariables());
                 }
                 
                 if (applyMaximumProgress && isTopLevelAutomaton) {
@@ -2167,7 +2230,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.variableOrder);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
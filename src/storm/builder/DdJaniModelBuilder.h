@@ -7,6 +7,7 @@
 
 #include "storm/logic/Formula.h"
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrder.h"
 
 
 namespace storm {
@@ -119,6 +120,9 @@ namespace storm {
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
                 
+                // The options that determine the order of the model variables in the decision diagrams.
+                storm::builder::DdVariableOrderOptions variableOrder;
+                
             };
                         
             /*!
@@ -92,10 +92,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, storm::builder::DdVariableOrderOptions const& variableOrderOptions) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(variableOrderOptions);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -154,8 +154,10 @@ namespace storm {
         private:
             /*!
              * Creates the required meta variables and variable/module identities.
+             *
+             * @param variableOrderOptions The options that determine the order of the meta variables of the program variables.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(storm::builder::DdVariableOrderOptions const& variableOrderOptions) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,84 +177,66 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Create meta variables for all program variables in the requested order. Row and column variables of
+                // each program variable are interleaved by the manager.
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableBounds;
+                auto addBounds = [&integerVariableBounds] (storm::prism::IntegerVariable const& integerVariable) {
+                    integerVariableBounds.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                };
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    addBounds(integerVariable);
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        addBounds(integerVariable);
+                    }
+                }
+                std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToIdentityBddMap;
+                for (auto const& variable : storm::builder::computeDdVariableOrder(program, variableOrderOptions)) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    auto boundsIt = integerVariableBounds.find(variable);
+                    if (boundsIt != integerVariableBounds.end()) {
+                        variablePair = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                    } else {
+                        variablePair = manager->addMetaVariable(variable.getName());
+                    }
+                    STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
                     rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
+                    variableToRowMetaVariableMap->emplace(variable, variablePair.first);
                     
                     columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
+                    variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
                     
                     storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    rowColumnMetaVariablePairs.push_back(variablePair);
+                    variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
                     
+                    rowColumnMetaVariablePairs.push_back(variablePair);
+                    variableToIdentityBddMap.emplace(variable, variableIdentity);
+                }
+                
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                    
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    
-                    rowColumnMetaVariablePairs.push_back(variablePair);
                     allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Create the identities and ranges of the modules.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
+                    std::set<storm::expressions::Variable> moduleVariables;
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleVariables.insert(integerVariable.getExpressionVariable());
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleVariables.insert(booleanVariable.getExpressionVariable());
+                    }
+                    for (auto const& variable : moduleVariables) {
+                        moduleIdentity &= variableToIdentityBddMap.at(variable);
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(variable));
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -346,17 +330,23 @@ namespace storm {
             
             virtual boost::any visit(storm::prism::SynchronizingParallelComposition const& composition, boost::any const& data) override {
                 // First, we translate the subcompositions.
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
-
-                // Prepare the new offset mapping.
-                std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap = boost::any_cast<std::map<uint_fast64_t, uint_fast64_t> const&>(data);
-                std::map<uint_fast64_t, uint_fast64_t> newSynchronizingActionToOffsetMap = synchronizingActionToOffsetMap;
-                for (auto const& action : left.synchronizingActionToDecisionDiagramMap) {
-                    newSynchronizingActionToOffsetMap[action.first] = action.second.numberOfUsedNondeterminismVariables;
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left;
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right;
+                if (usesNondeterminismVariables()) {
+                    left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
+                    
+                    // Prepare the new offset mapping.
+                    std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap = boost::any_cast<std::map<uint_fast64_t, uint_fast64_t> const&>(data);
+                    std::map<uint_fast64_t, uint_fast64_t> newSynchronizingActionToOffsetMap = synchronizingActionToOffsetMap;
+                    for (auto const& action : left.synchronizingActionToDecisionDiagramMap) {
+                        newSynchronizingActionToOffsetMap[action.first] = action.second.numberOfUsedNondeterminismVariables;
+                    }
+                    
+                    right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, newSynchronizingActionToOffsetMap));
+                } else {
+                    translateSubcompositionsInParallel(composition, data, left, right);
                 }
                 
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, newSynchronizingActionToOffsetMap));
-                
                 // Then, determine the action indices on which we need to synchronize.
                 std::set<uint_fast64_t> leftSynchronizationActionIndices = left.getSynchronizingActionIndices();
                 std::set<uint_fast64_t> rightSynchronizationActionIndices = right.getSynchronizingActionIndices();
@@ -369,10 +359,10 @@ namespace storm {
             }
             
             virtual boost::any visit(storm::prism::InterleavingParallelComposition const& composition, boost::any const& data) override {
-                // First, we translate the subcompositions.
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
-                
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, data));
+                // First, we translate the subcompositions. As there is no synchronization, they are independent.
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left;
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right;
+                translateSubcompositionsInParallel(composition, data, left, right);
 
                 // Finally, we compose the subcompositions to create the result.
                 composeInParallel(left, right, std::set<uint_fast64_t>());
@@ -387,20 +377,26 @@ namespace storm {
                 }
                 
                 // Then, we translate the subcompositions.
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
-                
-                // Prepare the new offset mapping.
-                std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap = boost::any_cast<std::map<uint_fast64_t, uint_fast64_t> const&>(data);
-                std::map<uint_fast64_t, uint_fast64_t> newSynchronizingActionToOffsetMap = synchronizingActionToOffsetMap;
-                for (auto const& actionIndex : synchronizingActionIndices) {
-                    auto it = left.synchronizingActionToDecisionDiagramMap.find(actionIndex);
-                    if (it != left.synchronizingActionToDecisionDiagramMap.end()) {
-                        newSynchronizingActionToOffsetMap[actionIndex] = it->second.numberOfUsedNondeterminismVariables;
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left;
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right;
+                if (usesNondeterminismVariables()) {
+                    left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
+                    
+                    // Prepare the new offset mapping.
+                    std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap = boost::any_cast<std::map<uint_fast64_t, uint_fast64_t> const&>(data);
+                    std::map<uint_fast64_t, uint_fast64_t> newSynchronizingActionToOffsetMap = synchronizingActionToOffsetMap;
+                    for (auto const& actionIndex : synchronizingActionIndices) {
+                        auto it = left.synchronizingActionToDecisionDiagramMap.find(actionIndex);
+                        if (it != left.synchronizingActionToDecisionDiagramMap.end()) {
+                            newSynchronizingActionToOffsetMap[actionIndex] = it->second.numberOfUsedNondeterminismVariables;
+                        }
                     }
+                    
+                    right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, newSynchronizingActionToOffsetMap));
+                } else {
+                    translateSubcompositionsInParallel(composition, data, left, right);
                 }
                 
-                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, newSynchronizingActionToOffsetMap));
-                
                 std::set<uint_fast64_t> leftSynchronizationActionIndices = left.getSynchronizingActionIndices();
                 bool isContainedInLeft = std::includes(leftSynchronizationActionIndices.begin(), leftSynchronizationActionIndices.end(), synchronizingActionIndices.begin(), synchronizingActionIndices.end());
                 STORM_LOG_WARN_COND(isContainedInLeft, "Left subcomposition of composition '" << composition << "' does not include all actions over which to synchronize.");
@@ -415,6 +411,29 @@ namespace storm {
             }
 
         private:
+            /*!
+             * Retrieves whether the actions use nondeterminism variables. If so, the offsets of the nondeterminism
+             * variables used by the right subcomposition of a synchronizing composition depend on the left one.
+             * Otherwise, all offsets are zero.
+             */
+            bool usesNondeterminismVariables() const {
+                return generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP;
+            }
+            
+            /*!
+             * Translates the two subcompositions of the given composition in parallel (if supported by the DD library)
+             * using the same offset mapping.
+             */
+            void translateSubcompositionsInParallel(storm::prism::ParallelComposition const& composition, boost::any const& data, typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram& left, typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram& right) {
+                generationInfo.manager->execute(2, [&] (uint64_t index) {
+                    if (index == 0) {
+                        left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
+                    } else {
+                        right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, data));
+                    }
+                });
+            }
+            
             /*!
              * Hides the actions of the given module according to the given set. As a result, the module is modified in
              * place.
@@ -663,7 +682,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createCommandDecisionDiagram(GenerationInformation& generationInfo, storm::prism::Module const& module, storm::prism::Command const& command) {
             STORM_LOG_TRACE("Translating guard " << command.getGuardExpression());
-            storm::dd::Bdd<Type> guard = generationInfo.rowExpressionAdapter->translateBooleanExpression(command.getGuardExpression()) && generationInfo.moduleToRangeMap[module.getName()].notZero();
+            storm::dd::Bdd<Type> guard = generationInfo.rowExpressionAdapter->translateBooleanExpression(command.getGuardExpression()) && generationInfo.moduleToRangeMap.at(module.getName()).notZero();
             STORM_LOG_WARN_COND(!guard.isZero(), "The guard '" << command.getGuardExpression() << "' is unsatisfiable.");
             
             if (!guard.isZero()) {
@@ -714,21 +733,23 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createActionDecisionDiagram(GenerationInformation& generationInfo, storm::prism::Module const& module, uint_fast64_t synchronizationActionIndex, uint_fast64_t nondeterminismVariableOffset) {
-            std::vector<ActionDecisionDiagram> commandDds;
+            std::vector<std::reference_wrapper<storm::prism::Command const>> relevantCommands;
             for (storm::prism::Command const& command : module.getCommands()) {
                 
                 // Determine whether the command is relevant for the selected action.
                 bool relevant = (synchronizationActionIndex == 0 && !command.isLabeled()) || (synchronizationActionIndex && command.isLabeled() && command.getActionIndex() == synchronizationActionIndex);
                 
-                if (!relevant) {
-                    continue;
+                if (relevant) {
+                    relevantCommands.push_back(command);
                 }
-                
-                STORM_LOG_TRACE("Translating command " << command);
-                
-                // At this point, the command is known to be relevant for the action.
-                commandDds.push_back(createCommandDecisionDiagram(generationInfo, module, command));
             }
+            
+            // Translate the relevant commands (in parallel, if the DD library supports it).
+            std::vector<ActionDecisionDiagram> commandDds(relevantCommands.size());
+            generationInfo.manager->execute(relevantCommands.size(), [&] (uint64_t index) {
+                STORM_LOG_TRACE("Translating command " << relevantCommands[index].get());
+                commandDds[index] = createCommandDecisionDiagram(generationInfo, module, relevantCommands[index].get());
+            });
 
             ActionDecisionDiagram result(*generationInfo.manager);
             if (!commandDds.empty()) {
@@ -996,17 +1017,23 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(GenerationInformation& generationInfo, storm::prism::Module const& module, std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap) {
-            // Start by creating the action DD for the independent action.
-            ActionDecisionDiagram independentActionDd = createActionDecisionDiagram(generationInfo, module, 0, 0);
-            uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
+            // Create the action DDs for the independent action (index 0) and all synchronizing actions of the module.
+            // As the actions are independent of each other, they are created in parallel (if supported).
+            std::vector<uint_fast64_t> actionIndices = {0};
+            actionIndices.insert(actionIndices.end(), module.getSynchronizingActionIndices().begin(), module.getSynchronizingActionIndices().end());
+            std::vector<ActionDecisionDiagram> actionDds(actionIndices.size());
+            generationInfo.manager->execute(actionIndices.size(), [&] (uint64_t index) {
+                uint_fast64_t actionIndex = actionIndices[index];
+                STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
+                actionDds[index] = createActionDecisionDiagram(generationInfo, module, actionIndex, actionIndex == 0 ? 0 : synchronizingActionToOffsetMap.at(actionIndex));
+            });
             
-            // Create module DD for all synchronizing actions of the module.
+            ActionDecisionDiagram const& independentActionDd = actionDds.front();
+            uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
             std::map<uint_fast64_t, ActionDecisionDiagram> actionIndexToDdMap;
-            for (auto const& actionIndex : module.getSynchronizingActionIndices()) {
-                STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
-                ActionDecisionDiagram tmp = createActionDecisionDiagram(generationInfo, module, actionIndex, synchronizingActionToOffsetMap.at(actionIndex));
-                numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, tmp.numberOfUsedNondeterminismVariables);
-                actionIndexToDdMap.emplace(actionIndex, tmp);
+            for (uint64_t index = 1; index < actionIndices.size(); ++index) {
+                numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, actionDds[index].numberOfUsedNondeterminismVariables);
+                actionIndexToDdMap.emplace(actionIndices[index], actionDds[index]);
             }
 
             return ModuleDecisionDiagram(independentActionDd, actionIndexToDdMap, generationInfo.moduleToIdentityMap.at(module.getName()), numberOfUsedNondeterminismVariables);
@@ -1033,101 +1060,53 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module) {
-            storm::dd::Add<Type, ValueType> result;
-            
             // Make sure all actions contain all necessary meta variables.
             module.independentAction.ensureContainsVariables(generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
             for (auto& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
                 synchronizingAction.second.ensureContainsVariables(generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
             }
             
-
-
+            // Collect the independent action (with index 0) and the synchronizing actions.
+            std::vector<uint_fast64_t> actionIndices = {0};
+            std::vector<std::reference_wrapper<ActionDecisionDiagram const>> actions = {module.independentAction};
+            for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
+                actionIndices.push_back(synchronizingAction.first);
+                actions.push_back(synchronizingAction.second);
+            }
             
-            // If the model is an MDP, we need to encode the nondeterminism using additional variables.
-            if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
-                result = generationInfo.manager->template getAddZero<ValueType>();
-                
-                // First, determine the highest number of nondeterminism variables that is used in any action and make
-                // all actions use the same amout of nondeterminism variables.
-                uint_fast64_t numberOfUsedNondeterminismVariables = module.numberOfUsedNondeterminismVariables;
+            bool isMdp = generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP;
+            STORM_LOG_THROW(isMdp || generationInfo.program.getModelType() == storm::prism::Program::ModelType::DTMC || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC, storm::exceptions::InvalidArgumentException, "Illegal model type.");
+            
+            // Extend the DDs of all actions (in parallel, if supported), such that they can simply be added.
+            std::vector<storm::dd::Add<Type, ValueType>> actionDds(actions.size());
+            generationInfo.manager->execute(actions.size(), [&] (uint64_t index) {
+                ActionDecisionDiagram const& action = actions[index];
                 
-                // Compute missing global variable identities in independent action.
+                // Compute missing global variable identities of the action.
                 std::set<storm::expressions::Variable> missingIdentities;
-                std::set_difference(generationInfo.allGlobalVariables.begin(), generationInfo.allGlobalVariables.end(), module.independentAction.assignedGlobalVariables.begin(), module.independentAction.assignedGlobalVariables.end(), std::inserter(missingIdentities, missingIdentities.begin()));
+                std::set_difference(generationInfo.allGlobalVariables.begin(), generationInfo.allGlobalVariables.end(), action.assignedGlobalVariables.begin(), action.assignedGlobalVariables.end(), std::inserter(missingIdentities, missingIdentities.begin()));
                 storm::dd::Add<Type, ValueType> identityEncoding = generationInfo.manager->template getAddOne<ValueType>();
                 for (auto const& variable : missingIdentities) {
-                    STORM_LOG_TRACE("Multiplying identity of global variable " << variable.getName() << " to independent action.");
+                    STORM_LOG_TRACE("Multiplying identity of global variable " << variable.getName() << " to action '" << actionIndices[index] << "'.");
                     identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                 }
+                actionDds[index] = identityEncoding * action.transitionsDd;
                 
-                // Add variables to independent action DD.
-                storm::dd::Add<Type, ValueType> nondeterminismEncoding = generationInfo.manager->template getAddOne<ValueType>();
-                for (uint_fast64_t i = module.independentAction.numberOfUsedNondeterminismVariables; i < numberOfUsedNondeterminismVariables; ++i) {
-                    nondeterminismEncoding *= generationInfo.manager->getEncoding(generationInfo.nondeterminismMetaVariables[i], 0).template toAdd<ValueType>();
-                }
-
-                result = identityEncoding * module.independentAction.transitionsDd * nondeterminismEncoding;
-                
-                // Add variables to synchronized action DDs.
-                std::map<uint_fast64_t, storm::dd::Add<Type, ValueType>> synchronizingActionToDdMap;
-                for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
-                    // Compute missing global variable identities in synchronizing actions.
-                    missingIdentities = std::set<storm::expressions::Variable>();
-                    std::set_difference(generationInfo.allGlobalVariables.begin(), generationInfo.allGlobalVariables.end(), synchronizingAction.second.assignedGlobalVariables.begin(), synchronizingAction.second.assignedGlobalVariables.end(), std::inserter(missingIdentities, missingIdentities.begin()));
-                    identityEncoding = generationInfo.manager->template getAddOne<ValueType>();
-                    for (auto const& variable : missingIdentities) {
-                        STORM_LOG_TRACE("Multiplying identity of global variable " << variable.getName() << " to synchronizing action '" << synchronizingAction.first << "'.");
-                        identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
-                    }
-                    
-                    nondeterminismEncoding = generationInfo.manager->template getAddOne<ValueType>();
-                    for (uint_fast64_t i = synchronizingAction.second.numberOfUsedNondeterminismVariables; i < numberOfUsedNondeterminismVariables; ++i) {
+                // If the model is an MDP, we need to encode the nondeterminism using additional variables. All actions
+                // need to use the highest number of nondeterminism variables used in any action.
+                if (isMdp) {
+                    storm::dd::Add<Type, ValueType> nondeterminismEncoding = generationInfo.manager->template getAddOne<ValueType>();
+                    for (uint_fast64_t i = action.numberOfUsedNondeterminismVariables; i < module.numberOfUsedNondeterminismVariables; ++i) {
                         nondeterminismEncoding *= generationInfo.manager->getEncoding(generationInfo.nondeterminismMetaVariables[i], 0).template toAdd<ValueType>();
                     }
-                    synchronizingActionToDdMap.emplace(synchronizingAction.first, identityEncoding * synchronizingAction.second.transitionsDd * nondeterminismEncoding);
-                }
-                
-                // Add variables for synchronization.
-                result *= getSynchronizationDecisionDiagram(generationInfo);
-                
-                for (auto& synchronizingAction : synchronizingActionToDdMap) {
-                    synchronizingAction.second *= getSynchronizationDecisionDiagram(generationInfo, synchronizingAction.first);
-                }
-                
-                // Now, we can simply add all synchronizing actions to the result.
-                for (auto const& synchronizingAction : synchronizingActionToDdMap) {
-                    result += synchronizingAction.second;
-                }
-            } else if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::DTMC || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC) {
-                // Simply add all actions, but make sure to include the missing global variable identities.
-                
-                // Compute missing global variable identities in independent action.
-                std::set<storm::expressions::Variable> missingIdentities;
-                std::set_difference(generationInfo.allGlobalVariables.begin(), generationInfo.allGlobalVariables.end(), module.independentAction.assignedGlobalVariables.begin(), module.independentAction.assignedGlobalVariables.end(), std::inserter(missingIdentities, missingIdentities.begin()));
-                storm::dd::Add<Type, ValueType> identityEncoding = generationInfo.manager->template getAddOne<ValueType>();
-                for (auto const& variable : missingIdentities) {
-                    STORM_LOG_TRACE("Multiplying identity of global variable " << variable.getName() << " to independent action.");
-                    identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
-                }
-
-                result = identityEncoding * module.independentAction.transitionsDd;
-                for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
-                    // Compute missing global variable identities in synchronizing actions.
-                    missingIdentities = std::set<storm::expressions::Variable>();
-                    std::set_difference(generationInfo.allGlobalVariables.begin(), generationInfo.allGlobalVariables.end(), synchronizingAction.second.assignedGlobalVariables.begin(), synchronizingAction.second.assignedGlobalVariables.end(), std::inserter(missingIdentities, missingIdentities.begin()));
-                    identityEncoding = generationInfo.manager->template getAddOne<ValueType>();
-                    for (auto const& variable : missingIdentities) {
-                        STORM_LOG_TRACE("Multiplying identity of global variable " << variable.getName() << " to synchronizing action '" << synchronizingAction.first << "'.");
-                        identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
-                    }
                     
-                    result += identityEncoding * synchronizingAction.second.transitionsDd;
+                    // Add variables for synchronization.
+                    actionDds[index] *= nondeterminismEncoding * getSynchronizationDecisionDiagram(generationInfo, actionIndices[index]);
                 }
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
-            }
-            return result;
+            });
+            
+            // Now, we can simply add all actions.
+            return storm::utility::dd::sum(*generationInfo.manager, std::move(actionDds));
         }
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1317,7 +1296,7 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options.variableOrder);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
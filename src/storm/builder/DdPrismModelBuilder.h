@@ -8,6 +8,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -93,6 +94,9 @@ namespace storm {
                 // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
+                
+                // The options that determine the order of the program variables in the decision diagrams.
+                storm::builder::DdVariableOrderOptions variableOrder;
             };
             
             /*!
@@ -0,0 +1,293 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <numeric>
+
+#include <boost/algorithm/string/trim.hpp>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/utility/file.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace builder {
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic) {
+            switch (heuristic) {
+                case DdVariableOrderHeuristic::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrderHeuristic::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+
+        DdVariableOrderOptions::DdVariableOrderOptions() : heuristic(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderHeuristic()) {
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isDdVariableOrderInputSet()) {
+                inputFilename = buildSettings.getDdVariableOrderInputFilename();
+            }
+            if (buildSettings.isDdVariableOrderOutputSet()) {
+                outputFilename = buildSettings.getDdVariableOrderOutputFilename();
+            }
+        }
+
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalNumberOfIterations) {
+            std::vector<uint64_t> order(numberOfVariables);
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint64_t> position = order;
+
+            auto computeTotalSpan = [&hyperedges, &position] () {
+                uint64_t totalSpan = 0;
+                for (auto const& hyperedge : hyperedges) {
+                    auto minmax = std::minmax_element(hyperedge.begin(), hyperedge.end(), [&position] (uint64_t first, uint64_t second) { return position[first] < position[second]; });
+                    totalSpan += position[*minmax.second] - position[*minmax.first];
+                }
+                return totalSpan;
+            };
+
+            uint64_t bestTotalSpan = computeTotalSpan();
+            std::vector<uint64_t> bestOrder = order;
+
+            std::vector<double> tentativePosition(numberOfVariables);
+            std::vector<uint64_t> degree(numberOfVariables);
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations && bestTotalSpan > 0; ++iteration) {
+                // Move every variable to the average center of gravity of its hyperedges.
+                std::fill(tentativePosition.begin(), tentativePosition.end(), 0.0);
+                std::fill(degree.begin(), degree.end(), 0);
+                for (auto const& hyperedge : hyperedges) {
+                    double centerOfGravity = 0;
+                    for (auto const& variable : hyperedge) {
+                        centerOfGravity += position[variable];
+                    }
+                    centerOfGravity /= hyperedge.size();
+                    for (auto const& variable : hyperedge) {
+                        tentativePosition[variable] += centerOfGravity;
+                        ++degree[variable];
+                    }
+                }
+                for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                    tentativePosition[variable] = degree[variable] == 0 ? static_cast<double>(position[variable]) : tentativePosition[variable] / degree[variable];
+                }
+
+                // Ties are broken by the previous position, which keeps the heuristic deterministic.
+                std::sort(order.begin(), order.end(), [&] (uint64_t first, uint64_t second) {
+                    return tentativePosition[first] < tentativePosition[second] || (tentativePosition[first] == tentativePosition[second] && position[first] < position[second]);
+                });
+                for (uint64_t index = 0; index < numberOfVariables; ++index) {
+                    position[order[index]] = index;
+                }
+
+                uint64_t totalSpan = computeTotalSpan();
+                STORM_LOG_TRACE("FORCE iteration " << iteration << " yields a total span of " << totalSpan << ".");
+                if (totalSpan < bestTotalSpan) {
+                    bestTotalSpan = totalSpan;
+                    bestOrder = order;
+                } else {
+                    break;
+                }
+            }
+            return bestOrder;
+        }
+
+        namespace {
+            // The variables of a model together with the sets of variables that are related by the model's behaviour.
+            class DependencyGraph {
+            public:
+                void addVariable(storm::expressions::Variable const& variable) {
+                    variableToIndex.emplace(variable, variables.size());
+                    variables.push_back(variable);
+                }
+
+                void addHyperedge(std::set<storm::expressions::Variable> const& relatedVariables) {
+                    std::vector<uint64_t> hyperedge;
+                    for (auto const& variable : relatedVariables) {
+                        // Constants and transient variables do not get decision diagram variables.
+                        auto it = variableToIndex.find(variable);
+                        if (it != variableToIndex.end()) {
+                            hyperedge.push_back(it->second);
+                        }
+                    }
+                    if (hyperedge.size() > 1) {
+                        hyperedges.push_back(std::move(hyperedge));
+                    }
+                }
+
+                std::vector<storm::expressions::Variable> computeOrder(DdVariableOrderOptions const& options) const {
+                    std::vector<storm::expressions::Variable> result;
+                    if (options.heuristic == DdVariableOrderHeuristic::Force) {
+                        for (auto const& index : computeForceOrder(variables.size(), hyperedges)) {
+                            result.push_back(variables[index]);
+                        }
+                    } else {
+                        result = variables;
+                    }
+
+                    if (options.inputFilename) {
+                        std::map<std::string, storm::expressions::Variable> nameToVariable;
+                        for (auto const& variable : variables) {
+                            nameToVariable.emplace(variable.getName(), variable);
+                        }
+
+                        std::vector<storm::expressions::Variable> orderFromFile;
+                        std::set<storm::expressions::Variable> orderedVariables;
+                        for (auto const& name : parseDdVariableOrder(options.inputFilename.get())) {
+                            auto it = nameToVariable.find(name);
+                            STORM_LOG_THROW(it != nameToVariable.end(), storm::exceptions::WrongFormatException, "The variable order in file '" << options.inputFilename.get() << "' refers to unknown variable '" << name << "'.");
+                            STORM_LOG_THROW(orderedVariables.insert(it->second).second, storm::exceptions::WrongFormatException, "The variable order in file '" << options.inputFilename.get() << "' contains variable '" << name << "' more than once.");
+                            orderFromFile.push_back(it->second);
+                        }
+                        for (auto const& variable : result) {
+                            if (orderedVariables.find(variable) == orderedVariables.end()) {
+                                STORM_LOG_WARN("The variable order in file '" << options.inputFilename.get() << "' does not contain variable '" << variable.getName() << "', which is therefore placed behind the others.");
+                                orderFromFile.push_back(variable);
+                            }
+                        }
+                        result = std::move(orderFromFile);
+                    }
+
+                    if (options.outputFilename) {
+                        exportDdVariableOrder(options.outputFilename.get(), result);
+                    }
+                    return result;
+                }
+
+            private:
+                std::vector<storm::expressions::Variable> variables;
+                std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+                std::vector<std::vector<uint64_t>> hyperedges;
+            };
+        }
+
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderOptions const& options) {
+            DependencyGraph graph;
+            for (auto const& variable : program.getGlobalIntegerVariables()) {
+                graph.addVariable(variable.getExpressionVariable());
+            }
+            for (auto const& variable : program.getGlobalBooleanVariables()) {
+                graph.addVariable(variable.getExpressionVariable());
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& variable : module.getIntegerVariables()) {
+                    graph.addVariable(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getBooleanVariables()) {
+                    graph.addVariable(variable.getExpressionVariable());
+                }
+            }
+
+            std::set<uint_fast64_t> const& synchronizingActionIndices = program.getSynchronizingActionIndices();
+            std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionToVariables;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+                    for (auto const& update : command.getUpdates()) {
+                        for (auto const& assignment : update.getAssignments()) {
+                            commandVariables.insert(assignment.getVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getExpression().getVariables();
+                            commandVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    if (command.isLabeled() && synchronizingActionIndices.find(command.getActionIndex()) != synchronizingActionIndices.end()) {
+                        actionToVariables[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+                    }
+                    graph.addHyperedge(commandVariables);
+                }
+            }
+            for (auto const& actionVariables : actionToVariables) {
+                graph.addHyperedge(actionVariables.second);
+            }
+
+            return graph.computeOrder(options);
+        }
+
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderOptions const& options) {
+            DependencyGraph graph;
+            // The location variables come first (sorted by the names of the automata).
+            std::map<std::string, storm::expressions::Variable> automatonToLocationVariable;
+            for (auto const& automaton : model.getAutomata()) {
+                automatonToLocationVariable.emplace(automaton.getName(), automaton.getLocationExpressionVariable());
+            }
+            for (auto const& locationVariable : automatonToLocationVariable) {
+                graph.addVariable(locationVariable.second);
+            }
+            for (auto const& variable : model.getGlobalVariables()) {
+                if (!variable.isTransient()) {
+                    graph.addVariable(variable.getExpressionVariable());
+                }
+            }
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& variable : automaton.getVariables()) {
+                    if (!variable.isTransient()) {
+                        graph.addVariable(variable.getExpressionVariable());
+                    }
+                }
+            }
+
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> edgeVariables = edge.getGuard().getVariables();
+                    edgeVariables.insert(automaton.getLocationExpressionVariable());
+                    for (auto const& destination : edge.getDestinations()) {
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            edgeVariables.insert(assignment.getExpressionVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getAssignedExpression().getVariables();
+                            edgeVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionToVariables[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+                    }
+                    graph.addHyperedge(edgeVariables);
+                }
+            }
+            for (auto const& actionVariables : actionToVariables) {
+                graph.addHyperedge(actionVariables.second);
+            }
+
+            return graph.computeOrder(options);
+        }
+
+        void exportDdVariableOrder(std::string const& filename, std::vector<storm::expressions::Variable> const& order) {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            for (auto const& variable : order) {
+                stream << variable.getName() << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+
+        std::vector<std::string> parseDdVariableOrder(std::string const& filename) {
+            std::ifstream stream;
+            storm::utility::openFile(filename, stream);
+            std::vector<std::string> result;
+            std::string line;
+            while (storm::utility::getline(stream, line)) {
+                boost::trim(line);
+                if (!line.empty() && line.front() != '#') {
+                    result.push_back(line);
+                }
+            }
+            storm::utility::closeFile(stream);
+            return result;
+        }
+
+    }
+}
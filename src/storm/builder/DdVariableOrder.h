@@ -0,0 +1,95 @@
+#ifndef STORM_BUILDER_DDVARIABLEORDER_H_
+#define STORM_BUILDER_DDVARIABLEORDER_H_
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <set>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace jani {
+        class Model;
+    }
+
+    namespace builder {
+
+        // An enum that contains all heuristics that determine the order of the model variables in the decision diagrams.
+        enum class DdVariableOrderHeuristic { Declaration, Force };
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic);
+
+        struct DdVariableOrderOptions {
+            /*!
+             * Creates the options as they are set in the build settings.
+             */
+            DdVariableOrderOptions();
+
+            // The heuristic that is used to order the variables.
+            DdVariableOrderHeuristic heuristic;
+
+            // If set, the order is read from this file (variables not mentioned in the file are placed behind the others
+            // in the order of the heuristic).
+            boost::optional<std::string> inputFilename;
+
+            // If set, the computed order is written to this file.
+            boost::optional<std::string> outputFilename;
+        };
+
+        /*!
+         * Computes an order of the given variables with the FORCE heuristic (Aloul et al.), which repeatedly moves each
+         * variable to the average center of gravity of the hyperedges it belongs to. This keeps variables that appear
+         * together (e.g. in the same command) close to each other.
+         *
+         * @param numberOfVariables The number of variables. The initial order is 0, ..., numberOfVariables - 1.
+         * @param hyperedges The sets of (indices of) variables that are related.
+         * @param maximalNumberOfIterations The maximal number of iterations of the heuristic.
+         * @return The variables in the computed order.
+         */
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalNumberOfIterations = 100);
+
+        /*!
+         * Computes the order in which the decision diagram variables of the (non-transient) program variables are to be
+         * created. The hyperedges of the heuristic are given by the variables of each command and of all commands
+         * that synchronize on the same action.
+         *
+         * @param program The program whose variables to order.
+         * @param options The options that determine the order.
+         * @return The variables in the order in which they are to be created.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderOptions const& options);
+
+        /*!
+         * Computes the order in which the decision diagram variables of the non-transient variables and the location
+         * variables of the automata of the given model are to be created. The hyperedges of the heuristic are given by
+         * the variables of each edge (including the location variable of its automaton).
+         *
+         * @param model The model whose variables to order.
+         * @param options The options that determine the order.
+         * @return The variables in the order in which they are to be created.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderOptions const& options);
+
+        /*!
+         * Writes the names of the given variables (one per line) to the given file.
+         */
+        void exportDdVariableOrder(std::string const& filename, std::vector<storm::expressions::Variable> const& order);
+
+        /*!
+         * Reads the names of variables (one per line) from the given file. Empty lines and lines starting with '#'
+         * are ignored.
+         */
+        std::vector<std::string> parseDdVariableOrder(std::string const& filename);
+
+    }
+}
+
+#endif /* STORM_BUILDER_DDVARIABLEORDER_H_ */
@@ -1,7 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
-
+#include <numeric>
+#include <unordered_map>
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/ChoiceInformationBuilder.h"
@@ -32,13 +36,19 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 
 
 namespace storm {
     namespace builder {
-                        
+        
+        namespace {
+            // The number of states that every thread expands per round of the parallel exploration.
+            uint64_t const statesPerThreadAndRound = 1024;
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()), buildOutOfCore(storm::settings::getModule<storm::settings::modules::BuildSettings>().isOutOfCoreSet()), outOfCoreDirectory(storm::settings::getModule<storm::settings::modules::BuildSettings>().getOutOfCoreDirectory()), outOfCoreBufferSize(storm::settings::getModule<storm::settings::modules::BuildSettings>().getOutOfCoreBufferSize()), symmetryReduction(storm::settings::getModule<storm::settings::modules::BuildSettings>().isSymmetryReductionSet()), partialOrderReduction(storm::settings::getModule<storm::settings::modules::BuildSettings>().isPartialOrderReductionSet()) {
             // Intentionally left empty.
         }
         
@@ -49,12 +59,16 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (builderOptions.numberOfThreads > 1) {
+                generatorFactory = [program, generatorOptions] () { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (builderOptions.numberOfThreads > 1) {
+                generatorFactory = [model, generatorOptions] () { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -81,21 +95,31 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+            // If symmetries are factored out, only the representatives of the states are stored.
+            CompressedState const* representative = &state;
+            CompressedState canonicalState;
+            if (!symmetries.empty()) {
+                canonicalState = state;
+                symmetries.canonicalize(canonicalState);
+                representative = &canonicalState;
+            }
+            
+            STORM_LOG_ASSERT(!stateStorage.concurrentStateToId, "States can only be added sequentially if the state storage is not used concurrently.");
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
             // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(*representative, newIndex);
             
             StateType actualIndex = actualIndexBucketPair.first;
             
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
-                    statesToExplore.emplace_front(state, actualIndex);
+                    statesToExplore.emplace_front(*representative, actualIndex);
 
                     // Reserve one slot for the new state in the remapping.
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
                 } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-                    statesToExplore.emplace_back(state, actualIndex);
+                    statesToExplore.emplace_back(*representative, actualIndex);
                 } else {
                     STORM_LOG_ASSERT(false, "Invalid exploration order.");
                 }
@@ -104,6 +128,131 @@ namespace storm {
             return actualIndex;
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isStateDiscovered(CompressedState const& state) const {
+            if (symmetries.empty()) {
+                return stateStorage.stateToId.contains(state);
+            }
+            CompressedState canonicalState = state;
+            symmetries.canonicalize(canonicalState);
+            return stateStorage.stateToId.contains(canonicalState);
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isExploreInParallelSet() const {
+            if (options.numberOfThreads <= 1) {
+                return false;
+            }
+            if (!generatorFactory) {
+                STORM_LOG_WARN("Exploring the state space sequentially, because a parallel exploration is only possible when building from a PRISM program or a JANI model.");
+                return false;
+            }
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Exploring the state space sequentially, because a parallel exploration is only possible in breadth-first order.");
+                return false;
+            }
+            if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                STORM_LOG_WARN("Exploring the state space sequentially, because a parallel exploration does not support labeling states with overlapping guards.");
+                return false;
+            }
+            return true;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isBuildOutOfCoreSet() const {
+            if (!options.buildOutOfCore) {
+                return false;
+            }
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Keeping the transitions in memory, because storing them out-of-core is only possible in breadth-first order.");
+                return false;
+            }
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Keeping the transitions in memory, because storing them out-of-core is only possible for models with double values.");
+                return false;
+            }
+            return true;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        std::vector<typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExpandedState> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandStatesInParallel() {
+            if (workerGenerators.empty()) {
+                workerGenerators.push_back(generator);
+                while (workerGenerators.size() < options.numberOfThreads) {
+                    workerGenerators.push_back(generatorFactory());
+                }
+            }
+            
+            uint64_t numberOfStates = std::min<uint64_t>(statesToExplore.size(), options.numberOfThreads * statesPerThreadAndRound);
+            std::vector<ExpandedState> result(numberOfStates);
+            std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(numberOfStates, workerGenerators.size(), [] (uint64_t index) { return index; });
+            
+            // The states that are added in this round obtain the preliminary ids firstNewId, firstNewId + 1, ...
+            storm::storage::ConcurrentBitVectorHashMap<StateType>& stateToId = *stateStorage.concurrentStateToId;
+            uint64_t firstNewId = stateStorage.getNumberOfStates();
+            std::atomic<uint64_t> nextId(firstNewId);
+            std::vector<std::vector<std::pair<StateType, CompressedState>>> newStatesOfBlocks(blocks.size() - 1);
+            
+            storm::utility::ThreadPool::getGlobalInstance(options.numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = *workerGenerators[block];
+                std::vector<std::pair<StateType, CompressedState>>& newStates = newStatesOfBlocks[block];
+                
+                ExpandedState* expandedState = nullptr;
+                CompressedState canonicalState;
+                std::function<StateType ()> idGenerator = [&nextId] () { return static_cast<StateType>(nextId++); };
+                std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) -> StateType {
+                    CompressedState const* representative = &state;
+                    if (!symmetries.empty()) {
+                        canonicalState = state;
+                        symmetries.canonicalize(canonicalState);
+                        representative = &canonicalState;
+                    }
+                    std::pair<StateType, bool> idFlagPair = stateToId.findOrGenerate(*representative, idGenerator);
+                    if (idFlagPair.second) {
+                        newStates.emplace_back(idFlagPair.first, *representative);
+                    }
+                    if (idFlagPair.first >= firstNewId) {
+                        expandedState->newStateIds.push_back(idFlagPair.first);
+                    }
+                    return idFlagPair.first;
+                };
+                
+                for (uint64_t index = blocks[block]; index < blocks[block + 1]; ++index) {
+                    expandedState = &result[index];
+                    workerGenerator.load(statesToExplore[index].first);
+                    expandedState->behavior = workerGenerator.expand(stateToIdCallback);
+                }
+            });
+            stateToId.releaseRetiredTables();
+            
+            // Collect the new states by their preliminary ids.
+            uint64_t numberOfNewStates = nextId.load() - firstNewId;
+            std::vector<CompressedState> newStates(numberOfNewStates);
+            for (auto& newStatesOfBlock : newStatesOfBlocks) {
+                for (auto& idStatePair : newStatesOfBlock) {
+                    newStates[idStatePair.first - firstNewId] = std::move(idStatePair.second);
+                }
+            }
+            
+            // In a sequential exploration, the new states obtain their ids in the order in which they are first
+            // requested when expanding the states in the order of the queue.
+            StateType const unassigned = std::numeric_limits<StateType>::max();
+            stateIdTranslation.resize(firstNewId + numberOfNewStates, unassigned);
+            StateType nextSequentialId = static_cast<StateType>(firstNewId);
+            for (auto const& expandedState : result) {
+                for (auto const& newStateId : expandedState.newStateIds) {
+                    if (stateIdTranslation[newStateId] == unassigned) {
+                        stateIdTranslation[newStateId] = nextSequentialId;
+                        statesToExplore.emplace_back(std::move(newStates[newStateId - firstNewId]), nextSequentialId);
+                        ++nextSequentialId;
+                    }
+                }
+            }
+            STORM_LOG_ASSERT(nextSequentialId == firstNewId + numberOfNewStates, "Not all new states were requested.");
+            
+            return result;
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, boost::optional<storm::storage::sparse::StateValuationsBuilder>& stateValuationsBuilder) {
             
@@ -113,9 +262,36 @@ namespace storm {
                 markovianStates = storm::storage::BitVector(1000);
             }
 
+            // If requested, detect the symmetries that are factored out during the exploration.
+            if (options.symmetryReduction) {
+                if (generator->isPartiallyObservable()) {
+                    STORM_LOG_WARN("Exploring the full state space, because symmetries can not be factored out for partially observable models.");
+                } else {
+                    symmetries = generator->detectSymmetries();
+                    STORM_LOG_WARN_COND(!symmetries.empty(), "Exploring the full state space, because no symmetries were found that can be factored out.");
+                    STORM_LOG_INFO_COND(symmetries.empty(), "Factoring out the symmetries of " << symmetries.getNumberOfGroups() << " group(s) of components.");
+                }
+            }
+            
             // Create a callback for the next-state generator to enable it to request the index of states.
             std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
             
+            // If the states are expanded in parallel, we keep the states expanded in the current round.
+            bool exploreInParallel = isExploreInParallelSet();
+            std::vector<ExpandedState> expandedStates;
+            uint64_t nextExpandedState = 0;
+            std::vector<std::pair<StateType, ValueType>> translatedEntries;
+            
+            // If requested, let the generator postpone choices that are independent of the other ones.
+            if (options.partialOrderReduction) {
+                if (exploreInParallel) {
+                    STORM_LOG_WARN("Exploring without partial-order reduction, because it can not be combined with a parallel exploration.");
+                } else {
+                    bool reduced = generator->enablePartialOrderReduction(std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isStateDiscovered, this, std::placeholders::_1));
+                    STORM_LOG_WARN_COND(reduced, "Exploring without partial-order reduction, because no independent commands or edges were found (or reward models are to be built).");
+                }
+            }
+            
             // If the exploration order is something different from breadth-first, we need to keep track of the remapping
             // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
             // and later reverse it.
@@ -126,6 +302,14 @@ namespace storm {
             // Let the generator create all initial states.
             this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
             STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+            
+            // In a parallel exploration, the threads add the states to the state storage themselves. The initial states
+            // keep their ids.
+            if (exploreInParallel) {
+                stateStorage.enableConcurrentInsertion();
+                stateIdTranslation.resize(stateStorage.getNumberOfStates());
+                std::iota(stateIdTranslation.begin(), stateIdTranslation.end(), 0);
+            }
 
             // Now explore the current state until there is no more reachable state.
             uint_fast64_t currentRowGroup = 0;
@@ -138,6 +322,12 @@ namespace storm {
             
             // Perform a search through the model.
             while (!statesToExplore.empty()) {
+                // If the states are expanded in parallel and all states of the last round were processed, start a new round.
+                if (exploreInParallel && nextExpandedState == expandedStates.size()) {
+                    expandedStates = expandStatesInParallel();
+                    nextExpandedState = 0;
+                }
+                
                 // Get the first state in the queue.
                 CompressedState currentState = statesToExplore.front().first;
                 StateType currentIndex = statesToExplore.front().second;
@@ -153,11 +343,23 @@ namespace storm {
                     STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
                 }
                 
-                generator->load(currentState);
-                if (stateValuationsBuilder) {
-                    generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                if (exploreInParallel) {
+                    ExpandedState& expandedState = expandedStates[nextExpandedState];
+                    ++nextExpandedState;
+                    behavior = std::move(expandedState.behavior);
+                    
+                    if (stateValuationsBuilder) {
+                        generator->load(currentState);
+                        generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
+                    }
+                } else {
+                    generator->load(currentState);
+                    if (stateValuationsBuilder) {
+                        generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
+                    }
+                    behavior = generator->expand(stateToIdCallback);
                 }
-                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
                 
                 // If there is no behavior, we might have to introduce a self-loop.
                 if (behavior.empty()) {
@@ -228,8 +430,20 @@ namespace storm {
                         }
                         
                         // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        if (!exploreInParallel) {
+                            for (auto const& stateProbabilityPair : choice) {
+                                transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                            }
+                        } else {
+                            // Replace the preliminary ids. As this may change the order of the successors, we need to sort them.
+                            translatedEntries.clear();
+                            for (auto const& stateProbabilityPair : choice) {
+                                translatedEntries.emplace_back(stateIdTranslation[stateProbabilityPair.first], stateProbabilityPair.second);
+                            }
+                            std::sort(translatedEntries.begin(), translatedEntries.end(), [] (std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                            for (auto const& stateProbabilityPair : translatedEntries) {
+                                transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                            }
                         }
                         
                         // Add the rewards to the reward models.
@@ -268,6 +482,11 @@ namespace storm {
                 }
             }
             
+            if (exploreInParallel) {
+                stateStorage.disableConcurrentInsertion([this] (StateType const& state) { return stateIdTranslation[state]; });
+                stateIdTranslation = std::vector<StateType>();
+            }
+            
             if (markovianStates) {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
@@ -310,6 +529,10 @@ namespace storm {
             
             // Prepare the component builders
             storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
+            bool buildOutOfCore = isBuildOutOfCoreSet();
+            if (buildOutOfCore) {
+                transitionMatrixBuilder.enableOutOfCoreStorage(options.outOfCoreDirectory, options.outOfCoreBufferSize);
+            }
             std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
             for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
                 rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -325,8 +548,16 @@ namespace storm {
             
             buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, stateValuationsBuilder);
             
+            // Build the labeling before the matrix. If the transitions were stored out-of-core, the states are not
+            // needed anymore afterwards (unless we need to compute observations), so we can release their memory before
+            // the transitions are read back.
+            storm::models::sparse::StateLabeling stateLabeling = buildStateLabeling();
+            if (buildOutOfCore && !generator->isPartiallyObservable()) {
+                stateStorage.stateToId = storm::storage::BitVectorHashMap<StateType>();
+            }
+            
             // Initialize the model components with the obtained information.
-            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), std::move(stateLabeling), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
             
             // Now finalize all reward models.
             for (auto& rewardModelBuilder : rewardModelBuilders) {
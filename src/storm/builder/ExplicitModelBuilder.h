@@ -1,6 +1,7 @@
 #ifndef STORM_BUILDER_EXPLICITMODELBUILDER_H
 #define	STORM_BUILDER_EXPLICITMODELBUILDER_H
 
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -57,6 +58,27 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads that expand states in parallel. The parallel exploration is only available for
+                // PRISM programs and JANI models and in breadth-first order.
+                uint64_t numberOfThreads;
+                
+                // A flag indicating whether the transitions are to be written to a temporary file during the exploration
+                // (only available for breadth-first exploration and double values).
+                bool buildOutOfCore;
+                
+                // The directory in which the temporary file is created. If empty, the system's temporary directory is used.
+                std::string outOfCoreDirectory;
+                
+                // The number of transitions that are held in memory before they are written to the temporary file.
+                uint64_t outOfCoreBufferSize;
+                
+                // A flag indicating whether only one representative of the states that differ by a permutation of
+                // symmetric components of the input (as detected by the generator) is to be explored.
+                bool symmetryReduction;
+                
+                // A flag indicating whether the generator may postpone choices by applying a partial-order reduction.
+                bool partialOrderReduction;
             };
             
             /*!
@@ -91,8 +113,9 @@ namespace storm {
             
         private:
             /*!
-             * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
-             * the lists of all states with a new id. If the state was already known, the object that is pointed to by
+             * Retrieves the state id of the given state. If symmetries are factored out, the state is first replaced by
+             * its representative. If the state has not been encountered yet, it will be added to the lists of all states
+             * with a new id. If the state was already known, the object that is pointed to by
              * the given state pointer is deleted and the old state id is returned. Note that the pointer should not be
              * used after invoking this method.
              *
@@ -100,6 +123,46 @@ namespace storm {
              * @return A pair indicating whether the state was already discovered before and the state id of the state.
              */
             StateType getOrAddStateIndex(CompressedState const& state);
+            
+            /*!
+             * Retrieves whether the given state (or its representative, if symmetries are factored out) was already
+             * discovered.
+             */
+            bool isStateDiscovered(CompressedState const& state) const;
+            
+            /*!
+             * The result of expanding a state in a parallel exploration round.
+             */
+            struct ExpandedState {
+                // The behavior of the state, where the successors carry their preliminary ids (see stateIdTranslation).
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                
+                // The preliminary ids of the successors that were added to the state storage in the current round (by
+                // any thread) in the order in which the generator requested them. An id may occur several times.
+                std::vector<StateType> newStateIds;
+            };
+            
+            /*!
+             * Retrieves whether the states are to be expanded in parallel (see expandStatesInParallel).
+             */
+            bool isExploreInParallelSet() const;
+            
+            /*!
+             * Retrieves whether the transitions are to be stored out-of-core during the exploration. If this was
+             * requested, but is not possible, a warning is issued.
+             */
+            bool isBuildOutOfCoreSet() const;
+            
+            /*!
+             * Expands a number of states at the front of the exploration queue in parallel, where every thread uses its
+             * own generator. The threads add new states to the concurrent map of the state storage, where they obtain
+             * preliminary ids in the order in which the threads happen to insert them. Afterwards, the new states are
+             * assigned the ids that they would obtain in a sequential exploration (see stateIdTranslation) and are
+             * appended to the queue. The expanded states stay in the queue, so that they are processed in order.
+             *
+             * @return The expanded states in the order of the queue.
+             */
+            std::vector<ExpandedState> expandStatesInParallel();
     
             /*!
              * Builds the transition matrix and the transition reward matrix based for the given program.
@@ -129,6 +192,12 @@ namespace storm {
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
             
+            /// A function that creates further generators for the parallel exploration (if the input is known).
+            std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+            
+            /// The generators used by the threads of the parallel exploration. The first one is the generator above.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+            
             /// The options to be used for the building process.
             Options options;
 
@@ -141,6 +210,13 @@ namespace storm {
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
             /// built in case the exploration order is not BFS.
             boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+            
+            /// The symmetries that are factored out during the exploration (if requested).
+            storm::generator::SymmetryReduction symmetries;
+            
+            /// During a parallel exploration, the state storage maps the states to preliminary ids. This maps the
+            /// preliminary ids to the ids that the states obtain in a sequential exploration.
+            std::vector<StateType> stateIdTranslation;
 
         };
         
@@ -165,6 +165,7 @@ namespace storm {
         template class ParallelCompositionBuilder<double>;
 
 #ifdef STORM_HAVE_CARL
+        template class ParallelCompositionBuilder<storm::RationalNumber>;
         template class ParallelCompositionBuilder<storm::RationalFunction>;
 #endif
         
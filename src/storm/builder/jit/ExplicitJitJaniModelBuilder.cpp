@@ -3,6 +3,10 @@
 #include <iostream>
 #include <cstdio>
 #include <chrono>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <set>
 #include <errno.h>
 
 #include "storm/solver/SmtSolver.h"
@@ -36,6 +40,7 @@
 #include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/storm-version.h"
 #include "storm-config.h"
 
 namespace storm {
@@ -94,7 +99,7 @@ namespace storm {
                         compiler = std::string(cxxEnv);
                     }
                     if (compiler.empty()) {
-                        compiler = "c++";
+                        compiler = findCompiler();
                     }
                 }
                 if (settings.isCompilerFlagsSet()) {
@@ -136,7 +141,19 @@ namespace storm {
 #else
                 gmpIncludeDirectory = "";
 #endif
-                sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isSparseppIncludeDirectorySet()) {
+                    sparseppIncludeDirectory = settings.getSparseppIncludeDirectory();
+                } else {
+                    // Prefer the copy of the headers in the build directory, but fall back to the sources in case the
+                    // build directory was removed after installation.
+                    sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                    if (!boost::filesystem::exists(sparseppIncludeDirectory + "sparsepp/spp.h")) {
+                        sparseppIncludeDirectory = STORM_SOURCE_DIR "/resources/3rdparty/sparsepp/";
+                    }
+                }
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = boost::filesystem::path(settings.getCacheDirectory());
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -225,8 +242,21 @@ namespace storm {
             }
             
             template <typename ValueType, typename RewardModelType>
-            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::writeToTemporaryFile(std::string const& content, std::string const& suffix) {
-                boost::filesystem::path temporaryFile = boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + suffix);
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::findCompiler() {
+                for (std::string const& candidate : {"c++", "g++", "clang++"}) {
+                    if (!execute("command -v " + candidate)) {
+                        STORM_LOG_TRACE("Using compiler '" << candidate << "' for the jit-based model builder.");
+                        return candidate;
+                    }
+                }
+                
+                // If none of the candidates was found, we use the default name and let the compilation report the error.
+                return "c++";
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::writeToTemporaryFile(std::string const& content, std::string const& suffix, boost::filesystem::path const& directory) {
+                boost::filesystem::path temporaryFile = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + suffix);
                 std::ofstream out(temporaryFile.native());
                 out << content << std::endl;
                 out.close();
@@ -524,20 +554,48 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
-                
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                // (2) If the compiled builders are cached, look up whether the same source was compiled before. As
+                // the constants of the model are substituted in the generated source code, the source code (together
+                // with the compiler invocation) identifies the shared library.
+                boost::filesystem::path dynamicLibraryPath;
+                bool cacheHit = false;
+                if (cacheDirectory) {
+                    boost::filesystem::create_directories(cacheDirectory.get());
+                    dynamicLibraryPath = cacheDirectory.get() / ("storm-jit-" + computeCacheKey(source) + DYLIB_EXTENSION);
+                    cacheHit = boost::filesystem::exists(dynamicLibraryPath);
+                    STORM_LOG_DEBUG((cacheHit ? "Found" : "Did not find") << " compiled builder " << dynamicLibraryPath << " in cache.");
+                }
+                
+                if (!cacheHit) {
+                    // (3) Write the source code to a temporary file. If we are caching the result, we write it to the
+                    // cache directory so that the shared library can be moved to its final location atomically.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source, ".cpp", cacheDirectory ? cacheDirectory.get() : boost::filesystem::path());
+                    
+                    // (4) Compile the source code to a shared library. If this fails, the source must not be left
+                    // behind (in particular not in the cache directory).
+                    boost::filesystem::path compiledLibraryPath;
+                    try {
+                        compiledLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    } catch (...) {
+                        boost::system::error_code removeError;
+                        boost::filesystem::remove(temporarySourceFile, removeError);
+                        throw;
+                    }
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (5) Remove the source code of the shared library we just compiled and move the library to the cache.
+                    boost::filesystem::remove(temporarySourceFile);
+                    if (cacheDirectory) {
+                        boost::filesystem::rename(compiledLibraryPath, dynamicLibraryPath);
+                    } else {
+                        dynamicLibraryPath = compiledLibraryPath;
+                    }
+                }
                 
-                // (5) Create the builder from the shared library.
+                // (6) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
                 
-                // (6) Execute the build function of the builder in the shared library and build the actual model.
+                // (7) Execute the build function of the builder in the shared library and build the actual model.
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 std::shared_ptr<storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>> sparseModel(nullptr);
@@ -553,8 +611,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (8) Delete the shared library unless it is kept in the cache.
+                if (!cacheDirectory) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -2526,22 +2586,133 @@ namespace storm {
             }
             
             template <typename ValueType, typename RewardModelType>
-            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::compileToSharedLibrary(boost::filesystem::path const& sourceFile) {
-                std::string sourceFilename = boost::filesystem::absolute(sourceFile).string();
-                auto dynamicLibraryPath = sourceFile;
-                dynamicLibraryPath += DYLIB_EXTENSION;
-                std::string dynamicLibraryFilename = boost::filesystem::absolute(dynamicLibraryPath).string();
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getIncludeFlags() const {
                 std::string includes = "";
                 for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
                     if (dir != "") {
                         includes += " -I" + dir;
                     }
                 }
-                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + includes + " -o " + dynamicLibraryFilename;
+                return includes;
+            }
+            
+            namespace {
+                /*!
+                 * Retrieves the targets of the include directives of the given source together with a flag that
+                 * indicates whether the target was given in quotes.
+                 */
+                std::vector<std::pair<std::string, bool>> getIncludeDirectives(std::string const& source) {
+                    std::vector<std::pair<std::string, bool>> result;
+                    std::istringstream stream(source);
+                    std::string line;
+                    while (std::getline(stream, line)) {
+                        std::size_t position = line.find_first_not_of(" \t");
+                        if (position == std::string::npos || line[position] != '#') {
+                            continue;
+                        }
+                        position = line.find_first_not_of(" \t", position + 1);
+                        if (position == std::string::npos || line.compare(position, 7, "include") != 0) {
+                            continue;
+                        }
+                        position = line.find_first_of("<\"", position + 7);
+                        if (position == std::string::npos) {
+                            continue;
+                        }
+                        bool quoted = line[position] == '"';
+                        std::size_t end = line.find(quoted ? '"' : '>', position + 1);
+                        if (end != std::string::npos) {
+                            result.emplace_back(line.substr(position + 1, end - position - 1), quoted);
+                        }
+                    }
+                    return result;
+                }
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getIncludedHeadersDescription(std::string const& source) const {
+                std::vector<boost::filesystem::path> includeDirectories;
+                for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
+                    if (dir != "") {
+                        includeDirectories.emplace_back(dir);
+                    }
+                }
+                
+                // Resolve the includes like the compiler does and follow them through all headers that are found.
+                std::set<boost::filesystem::path> headers;
+                std::vector<std::pair<std::string, boost::filesystem::path>> stack = {std::make_pair(source, boost::filesystem::path())};
+                while (!stack.empty()) {
+                    std::string content = std::move(stack.back().first);
+                    boost::filesystem::path directory = std::move(stack.back().second);
+                    stack.pop_back();
+                    for (auto const& directive : getIncludeDirectives(content)) {
+                        std::vector<boost::filesystem::path> candidates;
+                        if (directive.second && !directory.empty()) {
+                            candidates.push_back(directory / directive.first);
+                        }
+                        for (auto const& includeDirectory : includeDirectories) {
+                            candidates.push_back(includeDirectory / directive.first);
+                        }
+                        for (auto const& candidate : candidates) {
+                            boost::system::error_code error;
+                            if (boost::filesystem::is_regular_file(candidate, error)) {
+                                boost::filesystem::path header = boost::filesystem::absolute(candidate).lexically_normal();
+                                if (headers.insert(header).second) {
+                                    std::ifstream in(header.native());
+                                    std::stringstream buffer;
+                                    buffer << in.rdbuf();
+                                    stack.emplace_back(buffer.str(), header.parent_path());
+                                }
+                                break;
+                            }
+                        }
+                    }
+                }
+                
+                std::stringstream description;
+                for (auto const& header : headers) {
+                    boost::system::error_code error;
+                    description << header.string() << " " << boost::filesystem::file_size(header, error) << " " << boost::filesystem::last_write_time(header, error) << std::endl;
+                }
+                return description.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::computeCacheKey(std::string const& source) const {
+                // The generated code is compiled against the headers of this version of Storm and its dependencies, so
+                // a shared library must not be reused once Storm or any of the included headers changed.
+                std::string version = storm::utility::StormVersion::longVersionString() + " " + storm::utility::StormVersion::buildInfo();
+                
+                // We use the 64-bit FNV-1a hash, because (unlike std::hash) its values are the same for all runs and
+                // platforms, which is required for a persistent cache.
+                uint64_t hash = 14695981039346656037ull;
+                for (std::string const& part : {version, compiler, compilerFlags, getIncludeFlags(), getIncludedHeadersDescription(source), source}) {
+                    for (char character : part) {
+                        hash ^= static_cast<uint8_t>(character);
+                        hash *= 1099511628211ull;
+                    }
+                    // Separate the parts such that moving characters from one part to the next changes the key.
+                    hash ^= 0xff;
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream stream;
+                stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+                return stream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::compileToSharedLibrary(boost::filesystem::path const& sourceFile) {
+                std::string sourceFilename = boost::filesystem::absolute(sourceFile).string();
+                auto dynamicLibraryPath = sourceFile;
+                dynamicLibraryPath += DYLIB_EXTENSION;
+                std::string dynamicLibraryFilename = boost::filesystem::absolute(dynamicLibraryPath).string();
+                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + getIncludeFlags() + " -o " + dynamicLibraryFilename;
                 boost::optional<std::string> error = execute(command);
                 
                 if (error) {
-                    boost::filesystem::remove(sourceFile);
+                    // Remove the source and whatever the compiler might have written before failing.
+                    boost::system::error_code removeError;
+                    boost::filesystem::remove(sourceFile, removeError);
+                    boost::filesystem::remove(dynamicLibraryPath, removeError);
                     STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Compiling shared library failed. Error: " << error.get());
                 }
                     
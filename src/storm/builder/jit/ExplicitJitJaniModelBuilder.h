@@ -94,9 +94,15 @@ namespace storm {
                 static boost::optional<std::string> execute(std::string command);
                 
                 /*!
-                 * Writes the given content to a temporary file. The temporary file is created to have the provided suffix.
+                 * Writes the given content to a temporary file. The temporary file is created to have the provided suffix
+                 * and is placed in the given directory (or the current working directory if none is given).
                  */
-                static boost::filesystem::path writeToTemporaryFile(std::string const& content, std::string const& suffix = ".cpp");
+                static boost::filesystem::path writeToTemporaryFile(std::string const& content, std::string const& suffix = ".cpp", boost::filesystem::path const& directory = boost::filesystem::path());
+                
+                /*!
+                 * Searches for a C++ compiler among the common names and returns the first one that is found.
+                 */
+                static std::string findCompiler();
 
                 /*!
                  * Assembles the information of the model such that it can be put into the source skeleton.
@@ -147,6 +153,25 @@ namespace storm {
                  */
                 std::string createSourceCodeFromSkeleton(cpptempl::data_map& modelData);
                 
+                /*!
+                 * Retrieves the include flags that are passed to the compiler.
+                 */
+                std::string getIncludeFlags() const;
+                
+                /*!
+                 * Computes the key under which the shared library compiled from the given source is stored in the cache.
+                 * Besides the source, the key depends on the version of Storm, the compiler, the flags with which it is
+                 * invoked and the headers included by the source.
+                 */
+                std::string computeCacheKey(std::string const& source) const;
+                
+                /*!
+                 * Retrieves a description of the headers that are (transitively) included by the given source, i.e., the
+                 * path, size and time of the last modification of every header. Headers that are not found in the
+                 * include directories (like the headers of the standard library) are not considered.
+                 */
+                std::string getIncludedHeadersDescription(std::string const& source) const;
+                
                 /*!
                  * Compiles the provided source file to a shared library and returns a path object to the resulting
                  * binary file.
@@ -213,6 +238,9 @@ namespace storm {
                 /// The include directory for gmp
                 std::string gmpIncludeDirectory;
                 
+                /// If set, the compiled shared libraries are kept in this directory and reused for identical models.
+                boost::optional<boost::filesystem::path> cacheDirectory;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<storm::RawPolynomialCache> cache;
             };
@@ -11,6 +11,8 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        compactStorage = multiplierSettings.isCompactStorageSet();
+        multicolorGaussSeidel = multiplierSettings.isMulticolorGaussSeidelSet();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +32,20 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool const& MultiplierEnvironment::isCompactStorageSet() const {
+        return compactStorage;
+    }
+    
+    void MultiplierEnvironment::setCompactStorage(bool value) {
+        compactStorage = value;
+    }
+    
+    bool const& MultiplierEnvironment::isMulticolorGaussSeidelSet() const {
+        return multicolorGaussSeidel;
+    }
+    
+    void MultiplierEnvironment::setMulticolorGaussSeidel(bool value) {
+        multicolorGaussSeidel = value;
+    }
+    
 }
@@ -15,9 +15,17 @@ namespace storm {
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
         
+        bool const& isCompactStorageSet() const;
+        void setCompactStorage(bool value);
+        
+        bool const& isMulticolorGaussSeidelSet() const;
+        void setMulticolorGaussSeidel(bool value);
+        
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool compactStorage;
+        bool multicolorGaussSeidel;
     };
 }
 
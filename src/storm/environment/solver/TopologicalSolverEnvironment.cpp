@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -15,6 +16,10 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        parallelSccScheduling = topologicalSettings.isParallelSccSchedulingSet();
+        trivialSccBatchSize = topologicalSettings.getTrivialSccBatchSize();
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +54,32 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    bool const& TopologicalSolverEnvironment::isParallelSccSchedulingSet() const {
+        return parallelSccScheduling;
+    }
+    
+    void TopologicalSolverEnvironment::setParallelSccScheduling(bool value) {
+        parallelSccScheduling = value;
+    }
+    
+    uint64_t const& TopologicalSolverEnvironment::getTrivialSccBatchSize() const {
+        return trivialSccBatchSize;
+    }
+    
+    void TopologicalSolverEnvironment::setTrivialSccBatchSize(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The batch size for trivial SCCs must be positive.");
+        trivialSccBatchSize = value;
+    }
+    
+    uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
+    
 
 
 }
@@ -20,12 +20,25 @@ namespace storm {
         bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
         void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
         
+        bool const& isParallelSccSchedulingSet() const;
+        void setParallelSccScheduling(bool value);
+        
+        uint64_t const& getTrivialSccBatchSize() const;
+        void setTrivialSccBatchSize(uint64_t value);
+        
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        
     private:
         storm::solver::EquationSolverType underlyingEquationSolverType;
         bool underlyingEquationSolverTypeSetFromDefault;
         
         storm::solver::MinMaxMethod underlyingMinMaxMethod;
         bool underlyingMinMaxMethodSetFromDefault;
+        
+        bool parallelSccScheduling;
+        uint64_t trivialSccBatchSize;
+        uint64_t numberOfThreads;
     };
 }
 
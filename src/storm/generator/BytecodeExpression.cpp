@@ -0,0 +1,224 @@
+#include "storm/generator/BytecodeExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * Translates an expression into bytecode. Every subexpression writes its value to a fresh register.
+         */
+        class BytecodeCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            BytecodeCompiler(VariableInformation const& variableInformation, BytecodeExpression& result) : variableInformation(variableInformation), result(result), failed(false) {
+                // Intentionally left empty.
+            }
+
+            bool compile(storm::expressions::Expression const& expression) {
+                expression.getBaseExpression().accept(*this, boost::none);
+                result.registers.resize(result.instructions.size());
+                return !failed;
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+                uint64_t condition = boost::any_cast<uint64_t>(expression.getCondition()->accept(*this, data));
+                uint64_t thenRegister = boost::any_cast<uint64_t>(expression.getThenExpression()->accept(*this, data));
+                uint64_t elseRegister = boost::any_cast<uint64_t>(expression.getElseExpression()->accept(*this, data));
+                return addInstruction(BytecodeExpression::OpCode::IfThenElse, condition, thenRegister, elseRegister);
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                BytecodeExpression::OpCode opCode;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And: opCode = BytecodeExpression::OpCode::And; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or: opCode = BytecodeExpression::OpCode::Or; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: opCode = BytecodeExpression::OpCode::Xor; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: opCode = BytecodeExpression::OpCode::Implies; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: opCode = BytecodeExpression::OpCode::Iff; break;
+                }
+                return visitBinary(opCode, expression, data);
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                BytecodeExpression::OpCode opCode;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: opCode = BytecodeExpression::OpCode::Plus; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: opCode = BytecodeExpression::OpCode::Minus; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: opCode = BytecodeExpression::OpCode::Times; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: opCode = BytecodeExpression::OpCode::Divide; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: opCode = BytecodeExpression::OpCode::Min; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: opCode = BytecodeExpression::OpCode::Max; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: opCode = BytecodeExpression::OpCode::Power; break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo: opCode = BytecodeExpression::OpCode::Modulo; break;
+                }
+                return visitBinary(opCode, expression, data);
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+                BytecodeExpression::OpCode opCode;
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: opCode = BytecodeExpression::OpCode::Equal; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: opCode = BytecodeExpression::OpCode::NotEqual; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: opCode = BytecodeExpression::OpCode::Less; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: opCode = BytecodeExpression::OpCode::LessOrEqual; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: opCode = BytecodeExpression::OpCode::Greater; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: opCode = BytecodeExpression::OpCode::GreaterOrEqual; break;
+                }
+                return visitBinary(opCode, expression, data);
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                storm::expressions::Variable const& variable = expression.getVariable();
+                for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                    if (booleanVariable.variable == variable) {
+                        return addInstruction(BytecodeExpression::OpCode::LoadBoolean, booleanVariable.bitOffset);
+                    }
+                }
+                for (auto const& integerVariable : variableInformation.integerVariables) {
+                    if (integerVariable.variable == variable) {
+                        return addLoadInteger(integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound);
+                    }
+                }
+                for (auto const& locationVariable : variableInformation.locationVariables) {
+                    if (locationVariable.variable == variable) {
+                        return addLoadInteger(locationVariable.bitOffset, locationVariable.bitWidth, 0);
+                    }
+                }
+
+                // The variable is not part of the state, so we have to leave it to the evaluator.
+                failed = true;
+                return addConstant(0.0);
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                uint64_t operand = boost::any_cast<uint64_t>(expression.getOperand()->accept(*this, data));
+                return addInstruction(BytecodeExpression::OpCode::Not, operand);
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                BytecodeExpression::OpCode opCode;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: opCode = BytecodeExpression::OpCode::Negate; break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: opCode = BytecodeExpression::OpCode::Floor; break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: opCode = BytecodeExpression::OpCode::Ceil; break;
+                }
+                uint64_t operand = boost::any_cast<uint64_t>(expression.getOperand()->accept(*this, data));
+                return addInstruction(opCode, operand);
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                return addConstant(expression.getValue() ? 1.0 : 0.0);
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                return addConstant(static_cast<double>(expression.getValue()));
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                return addConstant(expression.getValueAsDouble());
+            }
+
+        private:
+            boost::any visitBinary(BytecodeExpression::OpCode opCode, storm::expressions::BinaryExpression const& expression, boost::any const& data) {
+                uint64_t first = boost::any_cast<uint64_t>(expression.getFirstOperand()->accept(*this, data));
+                uint64_t second = boost::any_cast<uint64_t>(expression.getSecondOperand()->accept(*this, data));
+                return addInstruction(opCode, first, second);
+            }
+
+            uint64_t addLoadInteger(uint64_t bitOffset, uint64_t bitWidth, int_fast64_t lowerBound) {
+                if (bitWidth == 0) {
+                    return addConstant(static_cast<double>(lowerBound));
+                }
+                uint64_t target = addInstruction(BytecodeExpression::OpCode::LoadInteger, bitOffset, bitWidth);
+                result.instructions.back().value = static_cast<double>(lowerBound);
+                return target;
+            }
+
+            uint64_t addConstant(double value) {
+                uint64_t target = addInstruction(BytecodeExpression::OpCode::Constant);
+                result.instructions.back().value = value;
+                return target;
+            }
+
+            uint64_t addInstruction(BytecodeExpression::OpCode opCode, uint64_t first = 0, uint64_t second = 0, uint64_t third = 0) {
+                uint64_t target = result.instructions.size();
+                result.instructions.push_back({opCode, static_cast<uint32_t>(target), first, second, third, 0.0});
+                return target;
+            }
+
+            VariableInformation const& variableInformation;
+            BytecodeExpression& result;
+            bool failed;
+        };
+
+        boost::optional<BytecodeExpression> BytecodeExpression::compile(storm::expressions::Expression const& expression, VariableInformation const& variableInformation) {
+            BytecodeExpression result;
+            BytecodeCompiler compiler(variableInformation, result);
+            if (!compiler.compile(expression)) {
+                return boost::none;
+            }
+            return result;
+        }
+
+        bool BytecodeExpression::evaluateAsBool(CompressedState const& state) const {
+            return execute(state) == 1.0;
+        }
+
+        int_fast64_t BytecodeExpression::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int_fast64_t>(execute(state));
+        }
+
+        double BytecodeExpression::evaluateAsDouble(CompressedState const& state) const {
+            return execute(state);
+        }
+
+        uint64_t BytecodeExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        double BytecodeExpression::execute(CompressedState const& state) const {
+            double* r = registers.data();
+            for (auto const& instruction : instructions) {
+                double& target = r[instruction.target];
+                switch (instruction.opCode) {
+                    case OpCode::Constant: target = instruction.value; break;
+                    case OpCode::LoadBoolean: target = state.get(instruction.first) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: target = static_cast<double>(state.getAsInt(instruction.first, instruction.second)) + instruction.value; break;
+                    case OpCode::Plus: target = r[instruction.first] + r[instruction.second]; break;
+                    case OpCode::Minus: target = r[instruction.first] - r[instruction.second]; break;
+                    case OpCode::Times: target = r[instruction.first] * r[instruction.second]; break;
+                    case OpCode::Divide: target = r[instruction.first] / r[instruction.second]; break;
+                    case OpCode::Min: target = std::min(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Max: target = std::max(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Power: target = std::pow(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Modulo: target = std::fmod(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Negate: target = -r[instruction.first]; break;
+                    case OpCode::Floor: target = std::floor(r[instruction.first]); break;
+                    case OpCode::Ceil: target = std::ceil(r[instruction.first]); break;
+                    // Boolean operations treat all non-zero values as true (as exprtk does).
+                    case OpCode::Not: target = r[instruction.first] == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::And: target = (r[instruction.first] != 0.0 && r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Or: target = (r[instruction.first] != 0.0 || r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Xor: target = ((r[instruction.first] != 0.0) != (r[instruction.second] != 0.0)) ? 1.0 : 0.0; break;
+                    case OpCode::Implies: target = (r[instruction.first] == 0.0 || r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Iff:
+                    case OpCode::Equal: target = r[instruction.first] == r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: target = r[instruction.first] != r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Less: target = r[instruction.first] < r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: target = r[instruction.first] <= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: target = r[instruction.first] > r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: target = r[instruction.first] >= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::IfThenElse: target = r[instruction.first] != 0.0 ? r[instruction.second] : r[instruction.third]; break;
+                }
+            }
+            return r[instructions.back().target];
+        }
+
+    }
+}
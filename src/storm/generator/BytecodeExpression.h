@@ -0,0 +1,100 @@
+#ifndef STORM_GENERATOR_BYTECODEEXPRESSION_H_
+#define STORM_GENERATOR_BYTECODEEXPRESSION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class Expression;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * An expression that was compiled once into a compact register-based bytecode. Evaluating the bytecode reads the
+         * values of the variables directly from the bit layout of a compressed state, so the state does not have to be
+         * unpacked into an expression evaluator first.
+         *
+         * All values are computed as doubles with the same semantics as the (exprtk-based) evaluator that is otherwise
+         * used for models with double values. The operations are carried out in the order given by the expression,
+         * whereas the evaluator may reorder some arithmetic operations. Results that are not integral may therefore
+         * differ by rounding errors.
+         */
+        class BytecodeExpression {
+        public:
+            /*!
+             * Compiles the given expression. Compilation fails if the expression refers to variables that are not stored
+             * in the compressed states described by the variable information (e.g. undefined constants).
+             *
+             * @param expression The expression to compile.
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @return The compiled expression or none if the expression could not be compiled.
+             */
+            static boost::optional<BytecodeExpression> compile(storm::expressions::Expression const& expression, VariableInformation const& variableInformation);
+
+            /*!
+             * Evaluates the expression in the given state. The result is interpreted like ExpressionEvaluator::asBool,
+             * asInt and asRational, respectively.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+            int_fast64_t evaluateAsInt(CompressedState const& state) const;
+            double evaluateAsDouble(CompressedState const& state) const;
+
+            /*!
+             * Retrieves the number of instructions of the bytecode.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+            enum class OpCode : uint8_t {
+                // Loads of constants and variables.
+                Constant, LoadBoolean, LoadInteger,
+                // Numerical operations.
+                Plus, Minus, Times, Divide, Min, Max, Power, Modulo, Negate, Floor, Ceil,
+                // Boolean operations.
+                Not, And, Or, Xor, Implies, Iff,
+                // Relations.
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                // Selects the value of the second or the third operand depending on the first one.
+                IfThenElse
+            };
+
+            /*!
+             * A single instruction. The result is written to the register 'target', the operands are read from the
+             * given registers. Loads of variables use the operand fields to store the bit offset and width.
+             */
+            struct Instruction {
+                OpCode opCode;
+                uint32_t target;
+                uint64_t first;
+                uint64_t second;
+                uint64_t third;
+                double value;
+            };
+
+        private:
+            BytecodeExpression() = default;
+
+            /*!
+             * Executes the bytecode and returns the value of the result register.
+             */
+            double execute(CompressedState const& state) const;
+
+            // The instructions in the order of their execution. The result is stored in the target of the last one.
+            std::vector<Instruction> instructions;
+
+            // The registers in which the intermediate results are stored.
+            mutable std::vector<double> registers;
+
+            friend class BytecodeCompiler;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEEXPRESSION_H_ */
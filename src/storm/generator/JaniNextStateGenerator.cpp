@@ -1,5 +1,8 @@
 #include "storm/generator/JaniNextStateGenerator.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -91,6 +94,11 @@ namespace storm {
             this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
             
             
+            // The bytecode mimics the evaluation of expressions with doubles, so we only use it for models with double values.
+            if (this->options.isCompileExpressionsSet() && std::is_same<ValueType, double>::value) {
+                compileGuards();
+            }
+            
             // Build the information structs for the reward models.
             buildRewardModelInformation();
             
@@ -479,7 +487,11 @@ namespace storm {
                 result.addVariable(varInfo.variable);
             }
             for (auto const& varInfo : transientVariableInformation.integerVariableInformation) {
-                result.addVariable(varInfo.variable);
+                if (varInfo.lowerBound && varInfo.upperBound) {
+                    result.addVariable(varInfo.variable, varInfo.lowerBound.get(), varInfo.upperBound.get());
+                } else {
+                    result.addVariable(varInfo.variable);
+                }
             }
             for (auto const& varInfo : transientVariableInformation.rationalVariableInformation) {
                 result.addVariable(varInfo.variable);
@@ -569,7 +581,14 @@ namespace storm {
             // Get all choices for the state.
             result.setExpanded();
             std::vector<Choice<ValueType>> allChoices;
-            if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+            boost::optional<Choice<ValueType>> ampleChoice;
+            if (!partialOrderReduction.empty()) {
+                ampleChoice = getAmpleChoice(locations, *this->state, stateToIdCallback);
+            }
+            if (ampleChoice) {
+                // The choice of an independent edge suffices, the other choices are postponed to its successors.
+                allChoices.push_back(std::move(ampleChoice.get()));
+            } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
                 allChoices = getActionChoices(locations, *this->state, stateToIdCallback, EdgeFilter::WithoutRate);
                 if (allChoices.empty()) {
@@ -952,7 +971,7 @@ namespace storm {
                                     continue;
                                 }
                             }
-                            if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                            if (!evaluateGuard(*indexAndEdge.second)) {
                                 continue;
                             }
                         
@@ -1001,7 +1020,7 @@ namespace storm {
                                     }
                                 }
                             
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!evaluateGuard(*indexAndEdgeIt->second)) {
                                     continue;
                                 }
                             
@@ -1044,7 +1063,7 @@ namespace storm {
                                     }
                                 }
                                 
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!evaluateGuard(*indexAndEdgeIt->second)) {
                                     continue;
                                 }
                                 // If we reach this point, the edge is considered enabled.
@@ -1063,6 +1082,159 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType, typename StateType>
+        bool JaniNextStateGenerator<ValueType, StateType>::enablePartialOrderReduction(StateExistsCallback const& stateExistsCallback) {
+            partialOrderReduction = computePartialOrderReduction();
+            if (partialOrderReduction.empty()) {
+                reductionEdges.clear();
+                return false;
+            }
+            this->stateExistsCallback = stateExistsCallback;
+            STORM_LOG_INFO("Applying a partial-order reduction for " << partialOrderReduction.getCandidates().size() << " of " << reductionEdges.size() << " edge(s).");
+            return true;
+        }
+        
+        template<typename ValueType, typename StateType>
+        PartialOrderReduction JaniNextStateGenerator<ValueType, StateType>::computePartialOrderReduction() {
+            reductionEdges.clear();
+            if (model.getModelType() != storm::jani::ModelType::MDP || !rewardExpressions.empty()) {
+                return PartialOrderReduction();
+            }
+            
+            // Gather the variables that are observed by the labels and the terminal states.
+            std::set<storm::expressions::Variable> visibleVariables;
+            for (auto const& variable : model.getGlobalVariables().getTransientVariables()) {
+                if (variable.isBooleanVariable()) {
+                    if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().find(variable.getName()) != this->options.getLabelNames().end()) {
+                        storm::expressions::Expression labelExpression = model.getLabelExpression(variable.asBooleanVariable(), this->parallelAutomata);
+                        if (!this->arrayEliminatorData.replacements.empty()) {
+                            labelExpression = this->arrayEliminatorData.transformExpression(labelExpression);
+                        }
+                        labelExpression.gatherVariables(visibleVariables);
+                    }
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                expressionLabel.second.gatherVariables(visibleVariables);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                expressionBool.first.gatherVariables(visibleVariables);
+            }
+            
+            // Determine the edges that are expanded on their own (exactly once) along with the corresponding output actions.
+            std::unordered_map<storm::jani::Edge const*, uint64_t> numberOfExpansions;
+            std::unordered_map<storm::jani::Edge const*, uint64_t> outputActionIndices;
+            std::unordered_set<storm::jani::Edge const*> synchronizingEdges;
+            for (OutputAndEdges const& outputAndEdges : edges) {
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            storm::jani::Edge const* edge = indexAndEdge.second;
+                            ++numberOfExpansions[edge];
+                            if (outputAndEdges.second.size() > 1) {
+                                synchronizingEdges.insert(edge);
+                            } else {
+                                outputActionIndices[edge] = outputAndEdges.first ? outputAndEdges.first.get() : edge->getActionIndex();
+                            }
+                        }
+                    }
+                }
+            }
+            
+            // Gather the variables that are read and written by the guards and destinations of the edges.
+            std::vector<PartialOrderReduction::Transition> transitions;
+            for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+                storm::jani::Automaton const& automaton = parallelAutomata[automatonIndex].get();
+                bool hasSeveralLocations = automaton.getNumberOfLocations() > 1;
+                storm::expressions::Variable const& locationVariable = automaton.getLocationExpressionVariable();
+                
+                uint64_t edgeIndex = 0;
+                for (auto const& edge : automaton.getEdges()) {
+                    PartialOrderReduction::Transition transition;
+                    transition.component = automatonIndex;
+                    auto expansionsIt = numberOfExpansions.find(&edge);
+                    transition.synchronizing = expansionsIt == numberOfExpansions.end() || expansionsIt->second != 1 || synchronizingEdges.count(&edge) > 0;
+                    edge.getGuard().gatherVariables(transition.guardVariables);
+                    if (hasSeveralLocations) {
+                        transition.guardVariables.insert(locationVariable);
+                    }
+                    transition.readVariables = transition.guardVariables;
+                    
+                    auto addAssignments = [&transition] (storm::jani::OrderedAssignments const& assignments) {
+                        for (auto const& assignment : assignments) {
+                            if (assignment.isTransient()) {
+                                continue;
+                            }
+                            if (assignment.lValueIsArrayAccess()) {
+                                assignment.getLValue().getArrayIndex().gatherVariables(transition.readVariables);
+                                transition.writtenVariables.insert(assignment.getLValue().getArray().getExpressionVariable());
+                            } else {
+                                transition.writtenVariables.insert(assignment.getExpressionVariable());
+                            }
+                            assignment.getAssignedExpression().gatherVariables(transition.readVariables);
+                        }
+                    };
+                    addAssignments(edge.getAssignments());
+                    for (auto const& destination : edge.getDestinations()) {
+                        destination.getProbability().gatherVariables(transition.readVariables);
+                        addAssignments(destination.getOrderedAssignments());
+                        if (hasSeveralLocations && destination.getLocationIndex() != edge.getSourceLocationIndex()) {
+                            transition.writtenVariables.insert(locationVariable);
+                        }
+                    }
+                    transitions.push_back(std::move(transition));
+                    
+                    auto outputIt = outputActionIndices.find(&edge);
+                    reductionEdges.push_back(ReductionEdge{automatonIndex, edgeIndex, &edge, outputIt != outputActionIndices.end() ? outputIt->second : edge.getActionIndex()});
+                    ++edgeIndex;
+                }
+            }
+            
+            return PartialOrderReduction(transitions, visibleVariables);
+        }
+        
+        template<typename ValueType, typename StateType>
+        boost::optional<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::getAmpleChoice(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            auto isEnabled = [this, &locations] (ReductionEdge const& reductionEdge) {
+                return locations[reductionEdge.automatonIndex] == reductionEdge.edge->getSourceLocationIndex() && evaluateGuard(*reductionEdge.edge);
+            };
+            
+            for (auto const& candidate : partialOrderReduction.getCandidates()) {
+                ReductionEdge const& reductionEdge = reductionEdges[candidate];
+                if (!isEnabled(reductionEdge)) {
+                    continue;
+                }
+                
+                // The edge may only be taken alone if the edges of its automaton that interfere with it are disabled.
+                auto const& dependentTransitions = partialOrderReduction.getDependentTransitions(candidate);
+                if (std::any_of(dependentTransitions.begin(), dependentTransitions.end(), [this, &isEnabled] (uint64_t index) { return isEnabled(reductionEdges[index]); })) {
+                    continue;
+                }
+                
+                // If one of the successors is already known, the edge may close a cycle along which the other choices
+                // would never be expanded. As the successors are only computed along with the choice, the edge is first
+                // expanded without registering them.
+                bool allSuccessorsNew = true;
+                expandNonSynchronizingEdge(*reductionEdge.edge, reductionEdge.outputActionIndex, reductionEdge.automatonIndex, state, [this, &allSuccessorsNew] (CompressedState const& successor) {
+                    if (stateExistsCallback(successor)) {
+                        allSuccessorsNew = false;
+                    }
+                    return static_cast<StateType>(0);
+                });
+                if (!allSuccessorsNew) {
+                    continue;
+                }
+                
+                Choice<ValueType> choice = expandNonSynchronizingEdge(*reductionEdge.edge, reductionEdge.outputActionIndex, reductionEdge.automatonIndex, state, stateToIdCallback);
+                if (this->getOptions().isBuildChoiceOriginsSet()) {
+                    EdgeIndexSet edgeIndex { model.encodeAutomatonAndEdgeIndices(reductionEdge.automatonIndex, reductionEdge.edgeIndex) };
+                    choice.addOriginData(boost::any(std::move(edgeIndex)));
+                }
+                return choice;
+            }
+            return boost::none;
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::checkGlobalVariableWritesValid(AutomataEdgeSets const& enabledEdges) const {
             // Todo: this also throws if the writes are on different assignment level
@@ -1159,6 +1331,37 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::compileGuards() {
+            // Assignments are not compiled, because they may refer to transient variables and are executed in levels.
+            uint64_t numberOfGuards = 0;
+            for (auto const& outputAndEdges : edges) {
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            ++numberOfGuards;
+                            boost::optional<BytecodeExpression> compiledGuard = BytecodeExpression::compile(indexAndEdge.second->getGuard(), this->variableInformation);
+                            if (compiledGuard) {
+                                compiledGuards.emplace(indexAndEdge.second, std::move(compiledGuard.get()));
+                            }
+                        }
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Compiled " << compiledGuards.size() << " of " << numberOfGuards << " guards to bytecode.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool JaniNextStateGenerator<ValueType, StateType>::evaluateGuard(storm::jani::Edge const& edge) const {
+            if (!compiledGuards.empty()) {
+                auto compiledGuardIt = compiledGuards.find(&edge);
+                if (compiledGuardIt != compiledGuards.end()) {
+                    return compiledGuardIt->second.evaluateAsBool(*this->state);
+                }
+            }
+            return this->evaluator->asBool(edge.getGuard());
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformation() {
             // Create synchronizing edges information.
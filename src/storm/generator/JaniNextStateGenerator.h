@@ -1,7 +1,9 @@
 #pragma once
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeExpression.h"
 #include "storm/generator/TransientVariableInformation.h"
+#include "storm/generator/PartialOrderReduction.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ArrayEliminator.h"
@@ -27,6 +29,7 @@ namespace storm {
         class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
         public:
             typedef typename NextStateGenerator<ValueType, StateType>::StateToIdCallback StateToIdCallback;
+            typedef typename NextStateGenerator<ValueType, StateType>::StateExistsCallback StateExistsCallback;
             typedef storm::storage::FlatSet<uint_fast64_t> EdgeIndexSet;
             enum class EdgeFilter {All, WithRate, WithoutRate};
             
@@ -58,6 +61,8 @@ namespace storm {
             /// Adds the valuation for the currently loaded state to the given builder
             virtual void addStateValuation(storm::storage::sparse::state_type const& currentStateIndex, storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const override;
             
+            virtual bool enablePartialOrderReduction(StateExistsCallback const& stateExistsCallback) override;
+            
             virtual std::size_t getNumberOfRewardModels() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
                         
@@ -147,6 +152,27 @@ namespace storm {
             void expandSynchronizingEdgeCombination(AutomataEdgeSets const& edgeCombination, uint64_t outputActionIndex, CompressedState const& state, StateToIdCallback stateToIdCallback, std::vector<Choice<ValueType>>& newChoices);
             void generateSynchronizedDistribution(storm::storage::BitVector const& state, AutomataEdgeSets const& edgeCombination, std::vector<EdgeSetWithIndices::const_iterator> const& iteratorList, storm::builder::jit::Distribution<StateType, ValueType>& distribution, std::vector<ValueType>& stateActionRewards, EdgeIndexSet& edgeIndices, StateToIdCallback stateToIdCallback);
 
+            /*!
+             * Determines the edges that may be taken before all other edges of a state, i.e. the edges that neither
+             * synchronize nor write variables that are observed by the labels and terminal states and that are
+             * independent of the edges of all other automata (as determined by the variables read and written by the
+             * guards and destinations, where the location of an automaton with several locations counts as a variable).
+             * This is only done for MDPs without rewards, as the reduction only preserves the probabilities of
+             * next-free properties.
+             */
+            PartialOrderReduction computePartialOrderReduction();
+            
+            /*!
+             * Retrieves the choice of the first candidate edge that is enabled in the given state while all edges
+             * depending on it are disabled, provided that all successors of this edge are new. As no other edge can
+             * interfere with the edge, all other choices of the state may be postponed to its successors.
+             *
+             * @param locations The current locations of all automata.
+             * @param state The state for which to retrieve the choice.
+             * @return The choice or nothing, if all choices of the state have to be expanded.
+             */
+            boost::optional<Choice<ValueType>> getAmpleChoice(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback);
+            
             /*!
              * Checks the list of enabled edges for multiple synchronized writes to the same global variable.
              */
@@ -172,6 +198,16 @@ namespace storm {
              */
             void createSynchronizationInformation();
             
+            /*!
+             * Compiles the guards of all edges that are to be explored to bytecode (as far as possible).
+             */
+            void compileGuards();
+            
+            /*!
+             * Evaluates the guard of the given edge in the currently loaded state.
+             */
+            bool evaluateGuard(storm::jani::Edge const& edge) const;
+            
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
@@ -206,6 +242,29 @@ namespace storm {
             
             /// Information about the transient variables of the model.
             TransientVariableInformation<ValueType> transientVariableInformation;
+            
+            /// The compiled guards of the edges. Guards that could not be compiled are not contained.
+            std::unordered_map<storm::jani::Edge const*, BytecodeExpression> compiledGuards;
+            
+            /// An edge of one of the automata as it is referred to by the partial-order reduction.
+            struct ReductionEdge {
+                uint64_t automatonIndex;
+                uint64_t edgeIndex;
+                storm::jani::Edge const* edge;
+                
+                /// The output action of the choice of the edge (only meaningful for the candidates of the reduction).
+                uint64_t outputActionIndex;
+            };
+            
+            /// The edges whose choices may be taken before all other choices. Empty if no partial-order reduction is
+            /// applied.
+            PartialOrderReduction partialOrderReduction;
+            
+            /// The edges of all automata in the order in which they are referred to by the partial-order reduction.
+            std::vector<ReductionEdge> reductionEdges;
+            
+            /// The callback that determines whether a state was already discovered (only used for the reduction).
+            StateExistsCallback stateExistsCallback;
         };
         
     }
@@ -18,7 +18,7 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), lazyStateLoading(false), stateLoadedIntoEvaluator(false) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -28,7 +28,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), lazyStateLoading(false), stateLoadedIntoEvaluator(false) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -50,25 +50,38 @@ namespace storm {
         template<typename ValueType, typename StateType>
         storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
             storm::storage::sparse::StateValuationsBuilder result;
+            // The ranges of the integer variables are passed along so that their values can be packed tightly.
             for (auto const& v : variableInformation.locationVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, 0, v.highestValue);
             }
             for (auto const& v : variableInformation.booleanVariables) {
                 result.addVariable(v.variable);
             }
             for (auto const& v : variableInformation.integerVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, v.lowerBound, v.upperBound);
             }
             return result;
         }
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-            
-            // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
+            
+            // Since almost all subsequent operations are based on the evaluator, we load the state into it now (unless
+            // this is deferred until the evaluator is actually needed).
+            stateLoadedIntoEvaluator = false;
+            if (!lazyStateLoading) {
+                ensureStateLoadedIntoEvaluator();
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::ensureStateLoadedIntoEvaluator() const {
+            if (!stateLoadedIntoEvaluator) {
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                stateLoadedIntoEvaluator = true;
+            }
         }
         
         template<typename ValueType, typename StateType>
@@ -76,6 +89,7 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
+            ensureStateLoadedIntoEvaluator();
             return evaluator->asBool(expression);
         }
         
@@ -118,7 +132,8 @@ namespace storm {
                     }
                 }
             }
-            
+            stateLoadedIntoEvaluator = false;
+
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
                 result.addLabel("init");
@@ -208,9 +223,21 @@ namespace storm {
             if (this->mask.size() == 0) {
                 this->mask = computeObservabilityMask(variableInformation);
             }
-            return unpackStateToObservabilityClass(state, evaluateObservationLabels(state), observabilityMap, mask);
+            storm::storage::BitVector observationLabels = evaluateObservationLabels(state);
+            stateLoadedIntoEvaluator = false;
+            return unpackStateToObservabilityClass(state, observationLabels, observabilityMap, mask);
         }
 
+        template<typename ValueType, typename StateType>
+        SymmetryReduction NextStateGenerator<ValueType, StateType>::detectSymmetries() const {
+            return SymmetryReduction();
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::enablePartialOrderReduction(StateExistsCallback const&) {
+            return false;
+        }
+        
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::remapStateIds(std::function<StateType(StateType const&)> const& remapping) {
             if (overlappingGuardStates != boost::none) {
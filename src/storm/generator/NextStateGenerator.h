@@ -18,6 +18,7 @@
 #include "storm/generator/VariableInformation.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/StateBehavior.h"
+#include "storm/generator/SymmetryReduction.h"
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -37,6 +38,7 @@ namespace storm {
         class NextStateGenerator {
         public:
             typedef std::function<StateType (CompressedState const&)> StateToIdCallback;
+            typedef std::function<bool (CompressedState const&)> StateExistsCallback;
 
             NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options);
             
@@ -65,6 +67,23 @@ namespace storm {
             /// Adds the valuation for the currently loaded state to the given builder
             virtual void addStateValuation(storm::storage::sparse::state_type const& currentStateIndex, storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const;
             
+            /*!
+             * Detects the groups of symmetric components of the input whose permutations can be factored out during the
+             * exploration. By default, no symmetries are detected.
+             */
+            virtual SymmetryReduction detectSymmetries() const;
+            
+            /*!
+             * Enables a partial-order reduction, i.e. for states in which a choice that is independent of all other choices
+             * may be taken first without affecting the properties to check, only this choice is expanded.
+             * By default, no reduction is possible.
+             *
+             * @param stateExistsCallback A callback that determines whether a state was already discovered. It is used
+             * to make sure that the other choices are not postponed forever along a cycle.
+             * @return True iff the reduction can be applied.
+             */
+            virtual bool enablePartialOrderReduction(StateExistsCallback const& stateExistsCallback);
+            
             virtual std::size_t getNumberOfRewardModels() const = 0;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const = 0;
             
@@ -96,6 +115,12 @@ namespace storm {
             virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const =0;
 
             void postprocess(StateBehavior<ValueType, StateType>& result);
+
+            /*!
+             * Unpacks the currently loaded state into the evaluator unless this already happened. This is required
+             * before using the evaluator if the state is loaded lazily.
+             */
+            void ensureStateLoadedIntoEvaluator() const;
             
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
@@ -114,6 +139,13 @@ namespace storm {
             
             /// The currently loaded state.
             CompressedState const* state;
+
+            /// A flag indicating whether loading a state only unpacks it into the evaluator once the evaluator is needed.
+            /// This pays off if most expressions are evaluated directly on the compressed state.
+            bool lazyStateLoading;
+
+            /// A flag indicating whether the currently loaded state was unpacked into the evaluator.
+            mutable bool stateLoadedIntoEvaluator;
             
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -0,0 +1,91 @@
+#include "storm/generator/PartialOrderReduction.h"
+
+#include <algorithm>
+#include <map>
+
+namespace storm {
+    namespace generator {
+
+        PartialOrderReduction::PartialOrderReduction(std::vector<Transition> const& transitions, std::set<storm::expressions::Variable> const& visibleVariables) : dependentTransitions(transitions.size()) {
+            // Index the transitions by the variables they access.
+            std::map<storm::expressions::Variable, std::vector<uint64_t>> readers;
+            std::map<storm::expressions::Variable, std::vector<uint64_t>> writers;
+            for (uint64_t index = 0; index < transitions.size(); ++index) {
+                for (auto const& variable : transitions[index].readVariables) {
+                    readers[variable].push_back(index);
+                }
+                for (auto const& variable : transitions[index].writtenVariables) {
+                    writers[variable].push_back(index);
+                }
+            }
+
+            std::vector<bool> isDependent(transitions.size(), false);
+            for (uint64_t candidate = 0; candidate < transitions.size(); ++candidate) {
+                Transition const& transition = transitions[candidate];
+                if (transition.synchronizing) {
+                    continue;
+                }
+                bool visible = std::any_of(transition.writtenVariables.begin(), transition.writtenVariables.end(), [&visibleVariables] (storm::expressions::Variable const& variable) { return visibleVariables.count(variable) > 0; });
+                if (visible) {
+                    continue;
+                }
+
+                // Collect the transitions that depend on the candidate.
+                std::vector<uint64_t> dependent;
+                auto addDependent = [&] (std::map<storm::expressions::Variable, std::vector<uint64_t>> const& accessors, storm::expressions::Variable const& variable) {
+                    auto accessorIt = accessors.find(variable);
+                    if (accessorIt != accessors.end()) {
+                        for (auto const& index : accessorIt->second) {
+                            if (index != candidate && !isDependent[index]) {
+                                isDependent[index] = true;
+                                dependent.push_back(index);
+                            }
+                        }
+                    }
+                };
+                for (auto const& variable : transition.writtenVariables) {
+                    addDependent(readers, variable);
+                    addDependent(writers, variable);
+                }
+                for (auto const& variable : transition.readVariables) {
+                    addDependent(writers, variable);
+                }
+
+                // The candidate has to be independent of the other components and the guards of the dependent
+                // transitions may only be changed by the candidate and the dependent transitions themselves.
+                bool isCandidate = std::all_of(dependent.begin(), dependent.end(), [&] (uint64_t index) { return transitions[index].component == transition.component; });
+                for (auto dependentIt = dependent.begin(); isCandidate && dependentIt != dependent.end(); ++dependentIt) {
+                    for (auto const& variable : transitions[*dependentIt].guardVariables) {
+                        auto writerIt = writers.find(variable);
+                        if (writerIt != writers.end() && !std::all_of(writerIt->second.begin(), writerIt->second.end(), [&] (uint64_t index) { return index == candidate || isDependent[index]; })) {
+                            isCandidate = false;
+                            break;
+                        }
+                    }
+                }
+
+                for (auto const& index : dependent) {
+                    isDependent[index] = false;
+                }
+                if (isCandidate) {
+                    std::sort(dependent.begin(), dependent.end());
+                    candidates.push_back(candidate);
+                    dependentTransitions[candidate] = std::move(dependent);
+                }
+            }
+        }
+
+        bool PartialOrderReduction::empty() const {
+            return candidates.empty();
+        }
+
+        std::vector<uint64_t> const& PartialOrderReduction::getCandidates() const {
+            return candidates;
+        }
+
+        std::vector<uint64_t> const& PartialOrderReduction::getDependentTransitions(uint64_t candidate) const {
+            return dependentTransitions[candidate];
+        }
+
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef STORM_GENERATOR_PARTIALORDERREDUCTION_H_
+#define STORM_GENERATOR_PARTIALORDERREDUCTION_H_
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * The static information needed for an ample-set partial-order reduction of a system that consists of
+         * components (e.g. modules or automata) with transitions (e.g. commands or edges). Two transitions are
+         * dependent if one of them writes a variable that the other one reads or writes.
+         *
+         * A transition is a candidate for a (singleton) ample set if it does not synchronize, does not write a visible
+         * variable and is independent of all transitions of other components. Taking it before all other transitions
+         * of a state is sound if, in addition, all transitions of its own component that depend on it are disabled and
+         * can not be enabled without taking the candidate first. The latter is ensured statically by requiring that
+         * the guards of the dependent transitions only read variables that are written by the candidate and the
+         * dependent transitions themselves. The cycle proviso has to be enforced during the exploration.
+         */
+        class PartialOrderReduction {
+        public:
+            /*!
+             * The variables accessed by a transition.
+             */
+            struct Transition {
+                // The component the transition belongs to.
+                uint64_t component;
+
+                // A flag indicating whether the transition synchronizes with (or is expanded along with) others.
+                bool synchronizing;
+
+                // The variables read by the guard of the transition.
+                std::set<storm::expressions::Variable> guardVariables;
+
+                // All variables read by the transition, including the ones of the guard.
+                std::set<storm::expressions::Variable> readVariables;
+
+                // The variables written by the transition.
+                std::set<storm::expressions::Variable> writtenVariables;
+            };
+
+            /*!
+             * Creates an object without candidates, i.e. no reduction is possible.
+             */
+            PartialOrderReduction() = default;
+
+            /*!
+             * Determines the candidates for ample sets among the given transitions.
+             *
+             * @param transitions The transitions of the system.
+             * @param visibleVariables The variables that are observed by the properties to check.
+             */
+            PartialOrderReduction(std::vector<Transition> const& transitions, std::set<storm::expressions::Variable> const& visibleVariables);
+
+            /*!
+             * Retrieves whether there are no candidates.
+             */
+            bool empty() const;
+
+            /*!
+             * Retrieves the (indices of the) transitions that are candidates for ample sets.
+             */
+            std::vector<uint64_t> const& getCandidates() const;
+
+            /*!
+             * Retrieves the (indices of the) transitions of the same component that depend on the given candidate. The
+             * candidate may only be taken alone in states in which all of them are disabled.
+             *
+             * @param candidate The index of the candidate.
+             */
+            std::vector<uint64_t> const& getDependentTransitions(uint64_t candidate) const;
+
+        private:
+            // The indices of the candidates.
+            std::vector<uint64_t> candidates;
+
+            // For every transition, the dependent transitions of its component (only filled for the candidates).
+            std::vector<std::vector<uint64_t>> dependentTransitions;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_PARTIALORDERREDUCTION_H_ */
@@ -0,0 +1,168 @@
+#include "storm/generator/PrismGuardIndex.h"
+
+#include <limits>
+#include <map>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        const uint64_t PrismGuardIndex::noRequirement = std::numeric_limits<uint64_t>::max();
+        const uint64_t PrismGuardIndex::unsatisfiableRequirement = std::numeric_limits<uint64_t>::max() - 1;
+
+        namespace {
+            // Variables with more bits than this are not used for indexing, as we store a group for every value.
+            uint64_t const maximalBitWidthOfIndexVariable = 10;
+
+            /*!
+             * Collects the constraints of the form 'variable = value' that appear as top-level conjuncts of the given
+             * guard. Boolean variables yield the value 1 (if the conjunct is the variable) or 0 (if it is negated).
+             */
+            void collectEqualityConjuncts(storm::expressions::Expression const& expression, std::vector<std::pair<storm::expressions::Variable, int_fast64_t>>& conjuncts) {
+                if (expression.isVariable()) {
+                    if (expression.hasBooleanType()) {
+                        conjuncts.emplace_back(*expression.getVariables().begin(), 1);
+                    }
+                    return;
+                }
+                if (!expression.isFunctionApplication()) {
+                    return;
+                }
+                switch (expression.getOperator()) {
+                    case storm::expressions::OperatorType::And:
+                        collectEqualityConjuncts(expression.getOperand(0), conjuncts);
+                        collectEqualityConjuncts(expression.getOperand(1), conjuncts);
+                        break;
+                    case storm::expressions::OperatorType::Not:
+                        if (expression.getOperand(0).isVariable()) {
+                            conjuncts.emplace_back(*expression.getOperand(0).getVariables().begin(), 0);
+                        }
+                        break;
+                    case storm::expressions::OperatorType::Equal:
+                        for (uint_fast64_t variableOperand = 0; variableOperand < 2; ++variableOperand) {
+                            storm::expressions::Expression const& variable = expression.getOperand(variableOperand);
+                            storm::expressions::Expression const& value = expression.getOperand(1 - variableOperand);
+                            if (variable.isVariable() && variable.hasIntegerType() && value.hasIntegerType() && !value.containsVariables()) {
+                                conjuncts.emplace_back(*variable.getVariables().begin(), value.evaluateAsInt());
+                                break;
+                            }
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            /*!
+             * The position of a variable within the states.
+             */
+            struct VariablePosition {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+                int_fast64_t upperBound;
+            };
+        }
+
+        PrismGuardIndex::PrismGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation, bool indexGuards) {
+            std::map<storm::expressions::Variable, VariablePosition> positions;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                positions[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0, 1};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitWidth > 0 && integerVariable.bitWidth <= maximalBitWidthOfIndexVariable) {
+                    positions[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound};
+                }
+            }
+
+            uint64_t numberOfIndexedModules = 0;
+            for (auto const& module : program.getModules()) {
+                moduleIndices.emplace_back();
+                ModuleIndex& moduleIndex = moduleIndices.back();
+
+                // Determine for each command the constraints on the variables and choose the variable that is
+                // constrained by the most commands.
+                std::vector<std::map<storm::expressions::Variable, int_fast64_t>> constraintsOfCommands(module.getNumberOfCommands());
+                std::map<storm::expressions::Variable, uint64_t> numberOfConstrainedCommands;
+                for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    std::vector<std::pair<storm::expressions::Variable, int_fast64_t>> conjuncts;
+                    collectEqualityConjuncts(module.getCommand(commandIndex).getGuardExpression(), conjuncts);
+                    for (auto const& conjunct : conjuncts) {
+                        if (positions.count(conjunct.first) > 0 && constraintsOfCommands[commandIndex].emplace(conjunct.first, conjunct.second).second) {
+                            ++numberOfConstrainedCommands[conjunct.first];
+                        }
+                    }
+                }
+                boost::optional<storm::expressions::Variable> indexVariable;
+                uint64_t maximalNumberOfConstrainedCommands = 1;
+                for (auto const& variableCountPair : numberOfConstrainedCommands) {
+                    if (indexGuards && variableCountPair.second > maximalNumberOfConstrainedCommands) {
+                        indexVariable = variableCountPair.first;
+                        maximalNumberOfConstrainedCommands = variableCountPair.second;
+                    }
+                }
+
+                if (indexVariable) {
+                    VariablePosition const& position = positions.at(indexVariable.get());
+                    moduleIndex.indexed = true;
+                    moduleIndex.bitOffset = position.bitOffset;
+                    moduleIndex.bitWidth = position.bitWidth;
+                    moduleIndex.unlabeledCommandsByValue.resize(1ull << position.bitWidth);
+                    for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                        auto constraintIt = constraintsOfCommands[commandIndex].find(indexVariable.get());
+                        if (constraintIt == constraintsOfCommands[commandIndex].end()) {
+                            moduleIndex.requiredValues.push_back(noRequirement);
+                        } else if (constraintIt->second < position.lowerBound || constraintIt->second > position.upperBound) {
+                            moduleIndex.requiredValues.push_back(unsatisfiableRequirement);
+                        } else {
+                            moduleIndex.requiredValues.push_back(static_cast<uint64_t>(constraintIt->second - position.lowerBound));
+                        }
+                        if (!module.getCommand(commandIndex).isLabeled()) {
+                            uint64_t requiredValue = moduleIndex.requiredValues.back();
+                            for (uint64_t value = 0; value < moduleIndex.unlabeledCommandsByValue.size(); ++value) {
+                                if (requiredValue == noRequirement || requiredValue == value) {
+                                    moduleIndex.unlabeledCommandsByValue[value].push_back(commandIndex);
+                                }
+                            }
+                        }
+                    }
+                    ++numberOfIndexedModules;
+                } else {
+                    moduleIndex.requiredValues.resize(module.getNumberOfCommands(), noRequirement);
+                    moduleIndex.unlabeledCommandsByValue.resize(1);
+                    for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                        if (!module.getCommand(commandIndex).isLabeled()) {
+                            moduleIndex.unlabeledCommandsByValue.front().push_back(commandIndex);
+                        }
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Indexed the guards of " << numberOfIndexedModules << " of " << moduleIndices.size() << " modules.");
+        }
+
+        std::vector<uint_fast64_t> const& PrismGuardIndex::getUnlabeledCommandCandidates(uint_fast64_t moduleIndex, CompressedState const& state) const {
+            ModuleIndex const& index = moduleIndices[moduleIndex];
+            if (!index.indexed) {
+                return index.unlabeledCommandsByValue.front();
+            }
+            return index.unlabeledCommandsByValue[state.getAsInt(index.bitOffset, index.bitWidth)];
+        }
+
+        bool PrismGuardIndex::isCandidate(uint_fast64_t moduleIndex, uint_fast64_t commandIndex, CompressedState const& state) const {
+            if (moduleIndices.empty()) {
+                return true;
+            }
+            ModuleIndex const& index = moduleIndices[moduleIndex];
+            uint64_t requiredValue = index.requiredValues[commandIndex];
+            return requiredValue == noRequirement || requiredValue == state.getAsInt(index.bitOffset, index.bitWidth);
+        }
+
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef STORM_GENERATOR_PRISMGUARDINDEX_H_
+#define STORM_GENERATOR_PRISMGUARDINDEX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * An index over the commands of a PRISM program that allows to skip commands whose guards are certainly not
+         * satisfied in a state without evaluating the guards.
+         *
+         * For every module, a variable is selected that most guards of the module compare to a constant in one of their
+         * top-level conjuncts (typically a program counter such as 's=3' or a boolean flag). The commands are then
+         * grouped by the value of this variable that they require. Given a state, only the commands of the group of the
+         * current value and the commands that do not constrain the variable at all can be enabled.
+         */
+        class PrismGuardIndex {
+        public:
+            /*!
+             * Creates an empty index. Such an index may only be queried with isCandidate, which accepts all commands.
+             */
+            PrismGuardIndex() = default;
+
+            /*!
+             * Creates the index for the given program, whose constants must have been substituted.
+             *
+             * @param program The program whose commands to index.
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @param indexGuards If false, no module is indexed, i.e., all commands are candidates in every state.
+             */
+            PrismGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation, bool indexGuards = true);
+
+            /*!
+             * Retrieves the indices of the unlabeled commands of the given module whose guards may be satisfied in the
+             * given state. The indices are sorted in ascending order.
+             *
+             * @param moduleIndex The index of the module.
+             * @param state The state.
+             * @return The (sorted) indices of the commands within the module.
+             */
+            std::vector<uint_fast64_t> const& getUnlabeledCommandCandidates(uint_fast64_t moduleIndex, CompressedState const& state) const;
+
+            /*!
+             * Checks whether the guard of the given command may be satisfied in the given state. If false is returned,
+             * the guard is certainly not satisfied.
+             *
+             * @param moduleIndex The index of the module.
+             * @param commandIndex The index of the command within the module.
+             * @param state The state.
+             */
+            bool isCandidate(uint_fast64_t moduleIndex, uint_fast64_t commandIndex, CompressedState const& state) const;
+
+        private:
+            /*!
+             * The index of a single module.
+             */
+            struct ModuleIndex {
+                // Whether there is a variable by which the commands are grouped.
+                bool indexed = false;
+
+                // The position of the variable within the states.
+                uint64_t bitOffset = 0;
+                uint64_t bitWidth = 0;
+
+                // For every command of the module the (encoded) value of the variable that the guard requires or
+                // noRequirement if the guard does not constrain the variable.
+                std::vector<uint64_t> requiredValues;
+
+                // For every (encoded) value of the variable, the unlabeled commands that may be enabled. If the module
+                // is not indexed, there is only one group that contains all unlabeled commands.
+                std::vector<std::vector<uint_fast64_t>> unlabeledCommandsByValue;
+            };
+
+            // The indices of all modules.
+            std::vector<ModuleIndex> moduleIndices;
+
+            static const uint64_t noRequirement;
+            static const uint64_t unsatisfiableRequirement;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_PRISMGUARDINDEX_H_ */
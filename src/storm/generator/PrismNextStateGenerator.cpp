@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -38,6 +40,9 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            // Index the guards, so we do not need to check all commands in every state.
+            guardIndex = PrismGuardIndex(program, this->variableInformation, options.isIndexGuardsSet());
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -80,6 +85,82 @@ namespace storm {
                     }
                 }
             }
+            
+            // The bytecode mimics the evaluation of expressions with doubles, so we only use it for models with double values.
+            if (this->options.isCompileExpressionsSet() && std::is_same<ValueType, double>::value) {
+                compileExpressions();
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            uint_fast64_t numberOfCommands = 0;
+            uint_fast64_t numberOfUpdates = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    numberOfCommands = std::max(numberOfCommands, command.getGlobalIndex() + 1);
+                    for (auto const& update : command.getUpdates()) {
+                        numberOfUpdates = std::max(numberOfUpdates, update.getGlobalIndex() + 1);
+                    }
+                }
+            }
+            compiledGuards.resize(numberOfCommands);
+            compiledLikelihoods.resize(numberOfUpdates);
+            compiledAssignments.resize(numberOfUpdates);
+            
+            bool allCompiled = true;
+            uint_fast64_t numberOfInstructions = 0;
+            auto compile = [&] (storm::expressions::Expression const& expression) {
+                boost::optional<BytecodeExpression> result = BytecodeExpression::compile(expression, this->variableInformation);
+                if (result) {
+                    numberOfInstructions += result->getNumberOfInstructions();
+                } else {
+                    allCompiled = false;
+                }
+                return result;
+            };
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    compiledGuards[command.getGlobalIndex()] = compile(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        compiledLikelihoods[update.getGlobalIndex()] = compile(update.getLikelihoodExpression());
+                        std::vector<BytecodeExpression> assignments;
+                        for (auto const& assignment : update.getAssignments()) {
+                            boost::optional<BytecodeExpression> compiledAssignment = compile(assignment.getExpression());
+                            if (!compiledAssignment) {
+                                assignments.clear();
+                                break;
+                            }
+                            assignments.push_back(std::move(compiledAssignment.get()));
+                        }
+                        if (assignments.size() == update.getNumberOfAssignments()) {
+                            compiledAssignments[update.getGlobalIndex()] = std::move(assignments);
+                        }
+                    }
+                }
+            }
+            
+            // If all expressions of the commands were compiled, the evaluator is only needed for rewards and terminal states.
+            this->lazyStateLoading = allCompiled;
+            STORM_LOG_DEBUG("Compiled the expressions of the commands to " << numberOfInstructions << " bytecode instructions" << (allCompiled ? "." : " (some expressions are left to the evaluator)."));
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::evaluateGuard(storm::prism::Command const& command) const {
+            if (!compiledGuards.empty() && compiledGuards[command.getGlobalIndex()]) {
+                return compiledGuards[command.getGlobalIndex()]->evaluateAsBool(*this->state);
+            }
+            this->ensureStateLoadedIntoEvaluator();
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateLikelihood(storm::prism::Update const& update) const {
+            if (!compiledLikelihoods.empty() && compiledLikelihoods[update.getGlobalIndex()]) {
+                return storm::utility::convertNumber<ValueType>(compiledLikelihoods[update.getGlobalIndex()]->evaluateAsDouble(*this->state));
+            }
+            this->ensureStateLoadedIntoEvaluator();
+            return this->evaluator->asRational(update.getLikelihoodExpression());
         }
 
         template<typename ValueType, typename StateType>
@@ -263,6 +344,9 @@ namespace storm {
             
             // First, construct the state rewards, as we may return early if there are no choices later and we already
             // need the state rewards then.
+            if (!rewardModels.empty() || !this->terminalStates.empty()) {
+                this->ensureStateLoadedIntoEvaluator();
+            }
             for (auto const& rewardModel : rewardModels) {
                 ValueType stateRewardValue = storm::utility::zero<ValueType>();
                 if (rewardModel.get().hasStateRewards()) {
@@ -288,7 +372,14 @@ namespace storm {
             result.setExpanded();
             
             std::vector<Choice<ValueType>> allChoices;
-            if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+            boost::optional<Choice<ValueType>> ampleChoice;
+            if (!partialOrderReduction.empty()) {
+                ampleChoice = getAmpleChoice(*this->state, stateToIdCallback);
+            }
+            if (ampleChoice) {
+                // The choice of an independent command suffices, the other choices are postponed to its successors.
+                allChoices.push_back(std::move(ampleChoice.get()));
+            } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
                 allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
                 addLabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -390,13 +481,27 @@ namespace storm {
             auto assignmentIt = update.getAssignments().begin();
             auto assignmentIte = update.getAssignments().end();
             
+            // The expressions are evaluated in the currently loaded state, either by their compiled bytecode or by the evaluator.
+            std::vector<BytecodeExpression> const* compiledAssignmentsOfUpdate = nullptr;
+            if (!compiledAssignments.empty() && !compiledAssignments[update.getGlobalIndex()].empty()) {
+                compiledAssignmentsOfUpdate = &compiledAssignments[update.getGlobalIndex()];
+            } else {
+                this->ensureStateLoadedIntoEvaluator();
+            }
+            auto compiledAssignmentIt = compiledAssignmentsOfUpdate ? compiledAssignmentsOfUpdate->begin() : std::vector<BytecodeExpression>::const_iterator();
+            
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
             for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                if (compiledAssignmentsOfUpdate) {
+                    newState.set(boolIt->bitOffset, compiledAssignmentIt->evaluateAsBool(*this->state));
+                    ++compiledAssignmentIt;
+                } else {
+                    newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                }
             }
             
             // Iterate over all integer assignments and carry them out.
@@ -405,7 +510,13 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue;
+                if (compiledAssignmentsOfUpdate) {
+                    assignedValue = compiledAssignmentIt->evaluateAsInt(*this->state);
+                    ++compiledAssignmentIt;
+                } else {
+                    assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                }
                 if (this->options.isAddOutOfBoundsStateSet()) {
                     if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                         return this->outOfBoundsState;
@@ -425,9 +536,10 @@ namespace storm {
         }
         
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(uint_fast64_t moduleIndex, storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : moduleIndex(moduleIndex), modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
                 // Intentionally left empty
             }
+            uint_fast64_t moduleIndex;
             storm::prism::Module const* modulePtr;
             std::set<uint_fast64_t> const* commandIndicesPtr;
             typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
@@ -462,6 +574,9 @@ namespace storm {
                 // Look up commands by their indices and check if the guard evaluates to true in the given state.
                 bool hasOneEnabledCommand = false;
                 for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
+                    if (!guardIndex.isCandidate(i, *commandIndexIt, *this->state)) {
+                        continue;
+                    }
                     storm::prism::Command const& command = module.getCommand(*commandIndexIt);
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -469,10 +584,10 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (evaluateGuard(command)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
-                        activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                        activeCommands.emplace_back(i, &module, &commandIndices, commandIndexIt);
                         break;
                     }
                 }
@@ -496,6 +611,9 @@ namespace storm {
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
                 auto commandIndexIte = activeCommand.commandIndicesPtr->end();
                 for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
+                    if (!guardIndex.isCandidate(activeCommand.moduleIndex, *commandIndexIt, *this->state)) {
+                        continue;
+                    }
                     storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -503,7 +621,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (evaluateGuard(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -523,13 +641,10 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
                 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all unlabeled commands whose guards may be satisfied.
+                for (uint_fast64_t j : guardIndex.getUnlabeledCommandCandidates(i, state)) {
                     storm::prism::Command const& command = module.getCommand(j);
                     
-                    // Only consider unlabeled commands.
-                    if (command.isLabeled()) continue;
-                    
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
                         if ((commandFilter == CommandFilter::Markovian) != command.isMarkovian()) {
@@ -538,7 +653,7 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!evaluateGuard(command)) {
                         continue;
                     }
                     
@@ -556,7 +671,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = evaluateLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -607,7 +722,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * evaluateLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -737,6 +852,132 @@ namespace storm {
         }
 
 
+        template<typename ValueType, typename StateType>
+        SymmetryReduction PrismNextStateGenerator<ValueType, StateType>::detectSymmetries() const {
+            // Besides the program itself, the labels and terminal states that were requested have to be symmetric.
+            std::vector<storm::expressions::Expression> additionalExpressions;
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                additionalExpressions.push_back(expressionLabel.second);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                additionalExpressions.push_back(expressionBool.first);
+            }
+            return SymmetryReduction(program, this->variableInformation, additionalExpressions);
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::enablePartialOrderReduction(StateExistsCallback const& stateExistsCallback) {
+            partialOrderReduction = computePartialOrderReduction();
+            if (partialOrderReduction.empty()) {
+                return false;
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    reductionCommands.push_back(command);
+                }
+            }
+            this->stateExistsCallback = stateExistsCallback;
+            STORM_LOG_INFO("Applying a partial-order reduction for " << partialOrderReduction.getCandidates().size() << " of " << reductionCommands.size() << " command(s).");
+            return true;
+        }
+        
+        template<typename ValueType, typename StateType>
+        PartialOrderReduction PrismNextStateGenerator<ValueType, StateType>::computePartialOrderReduction() const {
+            if (program.getModelType() != storm::prism::Program::ModelType::MDP || !rewardModels.empty()) {
+                return PartialOrderReduction();
+            }
+            
+            // Gather the variables that are observed by the labels and the terminal states.
+            std::set<storm::expressions::Variable> visibleVariables;
+            if (this->options.isBuildAllLabelsSet()) {
+                for (auto const& label : program.getLabels()) {
+                    label.getStatePredicateExpression().gatherVariables(visibleVariables);
+                }
+            } else {
+                for (auto const& labelName : this->options.getLabelNames()) {
+                    if (program.hasLabel(labelName)) {
+                        program.getLabelExpression(labelName).gatherVariables(visibleVariables);
+                    }
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                expressionLabel.second.gatherVariables(visibleVariables);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                expressionBool.first.gatherVariables(visibleVariables);
+            }
+            
+            // Gather the variables that are read and written by the guards and updates of the commands.
+            std::vector<PartialOrderReduction::Transition> transitions;
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    PartialOrderReduction::Transition transition;
+                    transition.component = moduleIndex;
+                    transition.synchronizing = command.isLabeled() && program.getModuleIndicesByActionIndex(command.getActionIndex()).size() > 1;
+                    command.getGuardExpression().gatherVariables(transition.guardVariables);
+                    transition.readVariables = transition.guardVariables;
+                    for (auto const& update : command.getUpdates()) {
+                        update.getLikelihoodExpression().gatherVariables(transition.readVariables);
+                        for (auto const& assignment : update.getAssignments()) {
+                            transition.writtenVariables.insert(assignment.getVariable());
+                            assignment.getExpression().gatherVariables(transition.readVariables);
+                        }
+                    }
+                    transitions.push_back(std::move(transition));
+                }
+            }
+            
+            return PartialOrderReduction(transitions, visibleVariables);
+        }
+        
+        template<typename ValueType, typename StateType>
+        boost::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            for (auto const& candidate : partialOrderReduction.getCandidates()) {
+                storm::prism::Command const& command = reductionCommands[candidate];
+                if (!evaluateGuard(command)) {
+                    continue;
+                }
+                
+                // The command may only be taken alone if the commands of its module that interfere with it are disabled.
+                auto const& dependentTransitions = partialOrderReduction.getDependentTransitions(candidate);
+                if (std::any_of(dependentTransitions.begin(), dependentTransitions.end(), [this] (uint64_t index) { return evaluateGuard(reductionCommands[index]); })) {
+                    continue;
+                }
+                
+                // If one of the successors is already known, the command may close a cycle along which the other
+                // choices would never be expanded.
+                std::vector<std::pair<CompressedState, ValueType>> successors;
+                bool allSuccessorsNew = true;
+                for (auto const& update : command.getUpdates()) {
+                    ValueType probability = evaluateLikelihood(update);
+                    if (!storm::utility::isZero(probability)) {
+                        successors.emplace_back(applyUpdate(state, update), probability);
+                        if (stateExistsCallback(successors.back().first)) {
+                            allSuccessorsNew = false;
+                            break;
+                        }
+                    }
+                }
+                if (!allSuccessorsNew) {
+                    continue;
+                }
+                
+                Choice<ValueType> choice(command.getActionIndex());
+                if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+                    choice.addLabel(program.getActionName(command.getActionIndex()));
+                }
+                if (this->options.isBuildChoiceOriginsSet()) {
+                    CommandSet commandIndex { command.getGlobalIndex() };
+                    choice.addOriginData(boost::any(std::move(commandIndex)));
+                }
+                for (auto const& successor : successors) {
+                    choice.addProbability(stateToIdCallback(successor.first), successor.second);
+                }
+                return choice;
+            }
+            return boost::none;
+        }
+
         template<typename ValueType, typename StateType>
         std::size_t PrismNextStateGenerator<ValueType, StateType>::getNumberOfRewardModels() const {
             return rewardModels.size();
@@ -2,6 +2,9 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeExpression.h"
+#include "storm/generator/PrismGuardIndex.h"
+#include "storm/generator/PartialOrderReduction.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -20,6 +23,7 @@ namespace storm {
         class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
         public:
             typedef typename NextStateGenerator<ValueType, StateType>::StateToIdCallback StateToIdCallback;
+            typedef typename NextStateGenerator<ValueType, StateType>::StateExistsCallback StateExistsCallback;
             typedef storm::storage::FlatSet<uint_fast64_t> CommandSet;
             enum class CommandFilter {All, Markovian, Probabilistic};
 
@@ -40,6 +44,10 @@ namespace storm {
 
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
 
+            virtual SymmetryReduction detectSymmetries() const override;
+
+            virtual bool enablePartialOrderReduction(StateExistsCallback const& stateExistsCallback) override;
+
             virtual std::size_t getNumberOfRewardModels() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
             
@@ -57,6 +65,22 @@ namespace storm {
              */
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool flag);
             
+            /*!
+             * Compiles the guards, likelihoods and assignments of all commands to bytecode (as far as possible). If
+             * all of them can be compiled, the state is only unpacked into the evaluator when it is actually needed.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Evaluates the guard of the given command in the currently loaded state.
+             */
+            bool evaluateGuard(storm::prism::Command const& command) const;
+            
+            /*!
+             * Evaluates the likelihood of the given update in the currently loaded state.
+             */
+            ValueType evaluateLikelihood(storm::prism::Update const& update) const;
+            
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
@@ -101,6 +125,25 @@ namespace storm {
              */
             void addLabeledChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
 
+            /*!
+             * Determines the commands that may be taken before all other commands of a state, i.e. the commands that
+             * neither synchronize nor write variables that are observed by the labels and terminal states and that are
+             * independent of the commands of all other modules (as determined by the variables read and written by the
+             * guards and updates). This is only done for MDPs without rewards, as the reduction only preserves the
+             * probabilities of next-free properties.
+             */
+            PartialOrderReduction computePartialOrderReduction() const;
+
+            /*!
+             * Retrieves the choice of the first candidate command that is enabled in the given state while all commands
+             * depending on it are disabled, provided that all successors of this command are new. As no other command
+             * can interfere with the command, all other choices of the state may be postponed to its successors.
+             *
+             * @param state The state for which to retrieve the choice.
+             * @return The choice or nothing, if all choices of the state have to be expanded.
+             */
+            boost::optional<Choice<ValueType>> getAmpleChoice(CompressedState const& state, StateToIdCallback stateToIdCallback);
+
 
             /*!
              * Evaluate observation labels
@@ -120,6 +163,29 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // The commands whose choices may be taken before all other choices. Empty if no partial-order reduction is
+            // applied.
+            PartialOrderReduction partialOrderReduction;
+            
+            // The commands of all modules in the order in which they are referred to by the partial-order reduction.
+            std::vector<std::reference_wrapper<storm::prism::Command const>> reductionCommands;
+            
+            // The callback that determines whether a state was already discovered (only used for the reduction).
+            StateExistsCallback stateExistsCallback;
+            
+            // An index that allows to skip commands whose guards are certainly not satisfied.
+            PrismGuardIndex guardIndex;
+            
+            // The compiled guards indexed by the global indices of the commands. Empty if expressions are not compiled.
+            std::vector<boost::optional<BytecodeExpression>> compiledGuards;
+            
+            // The compiled likelihoods indexed by the global indices of the updates.
+            std::vector<boost::optional<BytecodeExpression>> compiledLikelihoods;
+            
+            // The compiled right-hand sides of the assignments indexed by the global indices of the updates. If one of
+            // the assignments of an update could not be compiled, the corresponding vector is empty.
+            std::vector<std::vector<BytecodeExpression>> compiledAssignments;
         };
         
     }
@@ -0,0 +1,404 @@
+#include "storm/generator/SymmetryReduction.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            /*!
+             * The position and range of a variable within the states.
+             */
+            struct VariablePosition {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+                int_fast64_t upperBound;
+            };
+
+            bool isCommutative(storm::expressions::OperatorType operatorType) {
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::And:
+                    case storm::expressions::OperatorType::Or:
+                    case storm::expressions::OperatorType::Xor:
+                    case storm::expressions::OperatorType::Iff:
+                    case storm::expressions::OperatorType::Plus:
+                    case storm::expressions::OperatorType::Times:
+                    case storm::expressions::OperatorType::Min:
+                    case storm::expressions::OperatorType::Max:
+                    case storm::expressions::OperatorType::Equal:
+                    case storm::expressions::OperatorType::NotEqual:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            bool isAssociative(storm::expressions::OperatorType operatorType) {
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::And:
+                    case storm::expressions::OperatorType::Or:
+                    case storm::expressions::OperatorType::Plus:
+                    case storm::expressions::OperatorType::Times:
+                    case storm::expressions::OperatorType::Min:
+                    case storm::expressions::OperatorType::Max:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            std::string normalize(storm::expressions::Expression const& expression);
+
+            /*!
+             * Collects the (normalized) operands of nested applications of the given associative operator.
+             */
+            void collectOperands(storm::expressions::Expression const& expression, storm::expressions::OperatorType operatorType, std::vector<std::string>& operands) {
+                if (expression.isFunctionApplication() && expression.getOperator() == operatorType) {
+                    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                        collectOperands(expression.getOperand(operandIndex), operatorType, operands);
+                    }
+                } else {
+                    operands.push_back(normalize(expression));
+                }
+            }
+
+            /*!
+             * Computes a string representation of the given expression that is the same for expressions that only
+             * differ by the order (and nesting) of the operands of commutative (and associative) operators.
+             */
+            std::string normalize(storm::expressions::Expression const& expression) {
+                if (!expression.isFunctionApplication()) {
+                    return expression.toString();
+                }
+                storm::expressions::OperatorType operatorType = expression.getOperator();
+                std::vector<std::string> operands;
+                for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                    if (isAssociative(operatorType)) {
+                        collectOperands(expression.getOperand(operandIndex), operatorType, operands);
+                    } else {
+                        operands.push_back(normalize(expression.getOperand(operandIndex)));
+                    }
+                }
+                if (isCommutative(operatorType)) {
+                    std::sort(operands.begin(), operands.end());
+                }
+                std::stringstream stream;
+                stream << operatorType << "(";
+                for (uint64_t operandIndex = 0; operandIndex < operands.size(); ++operandIndex) {
+                    stream << (operandIndex > 0 ? "," : "") << operands[operandIndex];
+                }
+                stream << ")";
+                return stream.str();
+            }
+
+            /*!
+             * Checks whether the given expression is (syntactically) invariant under the given permutations of the
+             * variables of a group.
+             */
+            bool isInvariant(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable> const& groupVariables, std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> const& permutations) {
+                if (!expression.isInitialized()) {
+                    return true;
+                }
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                if (std::none_of(variables.begin(), variables.end(), [&groupVariables] (storm::expressions::Variable const& variable) { return groupVariables.count(variable) > 0; })) {
+                    return true;
+                }
+                std::string normalizedExpression = normalize(expression);
+                for (auto const& permutation : permutations) {
+                    if (normalize(expression.substitute(permutation)) != normalizedExpression) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /*!
+             * Retrieves the guard, the probabilities and the assigned expressions of the given command.
+             */
+            std::vector<storm::expressions::Expression> getExpressionsOfCommand(storm::prism::Command const& command) {
+                std::vector<storm::expressions::Expression> result = {command.getGuardExpression()};
+                for (auto const& update : command.getUpdates()) {
+                    result.push_back(update.getLikelihoodExpression());
+                    for (auto const& assignment : update.getAssignments()) {
+                        result.push_back(assignment.getExpression());
+                    }
+                }
+                return result;
+            }
+
+            std::vector<storm::expressions::Variable> getLocalVariables(storm::prism::Module const& module) {
+                std::vector<storm::expressions::Variable> result;
+                for (auto const& variable : module.getBooleanVariables()) {
+                    result.push_back(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getIntegerVariables()) {
+                    result.push_back(variable.getExpressionVariable());
+                }
+                return result;
+            }
+
+            /*!
+             * Retrieves whether the given action only occurs in the given module.
+             */
+            bool isActionLocalToModule(storm::prism::Program const& program, std::string const& actionName, uint64_t moduleIndex) {
+                if (!program.hasAction(actionName)) {
+                    return false;
+                }
+                std::set<uint_fast64_t> const& moduleIndices = program.getModuleIndicesByActionIndex(program.getActionIndex(actionName));
+                return moduleIndices.size() == 1 && *moduleIndices.begin() == moduleIndex;
+            }
+
+            /*!
+             * Determines the local variables of the given modules, where the first one is the base module of the others,
+             * such that the i-th variables of all modules correspond to each other under the renamings. Fails if a
+             * renaming affects more than the local variables and the actions that only the respective modules use.
+             *
+             * @param moduleVariables Is filled with the variables of the modules.
+             * @param renamedActions Is filled with the names of the actions that are affected by the renamings.
+             * @return An explanation of the failure or the empty string.
+             */
+            std::string getCorrespondingVariables(storm::prism::Program const& program, std::vector<uint64_t> const& moduleIndices, std::vector<std::vector<storm::expressions::Variable>>& moduleVariables, std::set<std::string>& renamedActions) {
+                storm::prism::Module const& baseModule = program.getModule(moduleIndices.front());
+                if (baseModule.getNumberOfClockVariables() > 0 || baseModule.hasInvariant()) {
+                    return "the modules have clock variables";
+                }
+                moduleVariables.push_back(getLocalVariables(baseModule));
+                std::set<std::string> baseVariableNames;
+                for (auto const& variable : moduleVariables.front()) {
+                    baseVariableNames.insert(variable.getName());
+                }
+
+                for (uint64_t memberIndex = 1; memberIndex < moduleIndices.size(); ++memberIndex) {
+                    storm::prism::Module const& module = program.getModule(moduleIndices[memberIndex]);
+                    std::map<std::string, storm::expressions::Variable> localVariables;
+                    for (auto const& variable : getLocalVariables(module)) {
+                        localVariables.emplace(variable.getName(), variable);
+                    }
+
+                    std::vector<storm::expressions::Variable> variables;
+                    for (auto const& baseVariable : moduleVariables.front()) {
+                        auto renamingIt = module.getRenaming().find(baseVariable.getName());
+                        if (renamingIt == module.getRenaming().end() || localVariables.count(renamingIt->second) == 0) {
+                            return "variable '" + baseVariable.getName() + "' is not renamed to a variable of module '" + module.getName() + "'";
+                        }
+                        variables.push_back(localVariables.at(renamingIt->second));
+                    }
+                    if (variables.size() != localVariables.size()) {
+                        return "module '" + module.getName() + "' has additional variables";
+                    }
+
+                    for (auto const& renamingPair : module.getRenaming()) {
+                        if (baseVariableNames.count(renamingPair.first) > 0) {
+                            continue;
+                        }
+                        if (!isActionLocalToModule(program, renamingPair.first, moduleIndices.front()) || !isActionLocalToModule(program, renamingPair.second, moduleIndices[memberIndex])) {
+                            return "module '" + module.getName() + "' renames '" + renamingPair.first + "', which is neither a local variable nor a local action";
+                        }
+                        renamedActions.insert(renamingPair.first);
+                        renamedActions.insert(renamingPair.second);
+                    }
+                    moduleVariables.push_back(std::move(variables));
+                }
+                return "";
+            }
+        }
+
+        SymmetryReduction::SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& additionalExpressions) {
+            std::map<storm::expressions::Variable, VariablePosition> positions;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                positions[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0, 1};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                positions[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound};
+            }
+
+            for (uint64_t baseModuleIndex = 0; baseModuleIndex < program.getNumberOfModules(); ++baseModuleIndex) {
+                storm::prism::Module const& baseModule = program.getModule(baseModuleIndex);
+                if (baseModule.isRenamedFromModule()) {
+                    continue;
+                }
+                std::vector<uint64_t> moduleIndices = {baseModuleIndex};
+                for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    storm::prism::Module const& module = program.getModule(moduleIndex);
+                    if (module.isRenamedFromModule() && module.getBaseModule() == baseModule.getName()) {
+                        moduleIndices.push_back(moduleIndex);
+                    }
+                }
+                if (moduleIndices.size() < 2) {
+                    continue;
+                }
+
+                std::vector<std::vector<storm::expressions::Variable>> moduleVariables;
+                std::set<std::string> renamedActions;
+                std::string failureReason = getCorrespondingVariables(program, moduleIndices, moduleVariables, renamedActions);
+
+                // The corresponding variables have to be stored in the same way.
+                Group group;
+                std::set<storm::expressions::Variable> groupVariables;
+                for (uint64_t memberIndex = 0; failureReason.empty() && memberIndex < moduleIndices.size(); ++memberIndex) {
+                    group.moduleFields.emplace_back();
+                    for (uint64_t variableIndex = 0; variableIndex < moduleVariables[memberIndex].size(); ++variableIndex) {
+                        auto const& variable = moduleVariables[memberIndex][variableIndex];
+                        VariablePosition const& position = positions.at(variable);
+                        VariablePosition const& basePosition = positions.at(moduleVariables.front()[variableIndex]);
+                        if (position.bitWidth != basePosition.bitWidth || position.lowerBound != basePosition.lowerBound || position.upperBound != basePosition.upperBound) {
+                            failureReason = "the range of variable '" + variable.getName() + "' differs from the one of the corresponding variable";
+                            break;
+                        }
+                        group.moduleFields.back().push_back({position.bitOffset, position.bitWidth});
+                        groupVariables.insert(variable);
+                    }
+                }
+                if (failureReason.empty() && groupVariables.empty()) {
+                    failureReason = "the modules do not have variables";
+                }
+
+                // The modules of the group may only access their own variables (among the ones of the group).
+                for (uint64_t memberIndex = 0; failureReason.empty() && memberIndex < moduleIndices.size(); ++memberIndex) {
+                    std::set<storm::expressions::Variable> ownVariables(moduleVariables[memberIndex].begin(), moduleVariables[memberIndex].end());
+                    for (auto const& command : program.getModule(moduleIndices[memberIndex]).getCommands()) {
+                        for (auto const& expression : getExpressionsOfCommand(command)) {
+                            for (auto const& variable : expression.getVariables()) {
+                                if (groupVariables.count(variable) > 0 && ownVariables.count(variable) == 0) {
+                                    failureReason = "module '" + program.getModule(moduleIndices[memberIndex]).getName() + "' accesses variable '" + variable.getName() + "' of another module of the group";
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // All permutations of the modules are generated by swapping the first two modules and by shifting all
+                // modules by one. It therefore suffices to check the invariance under these two permutations.
+                std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> permutations;
+                if (failureReason.empty()) {
+                    std::vector<std::vector<uint64_t>> targetModules;
+                    std::vector<uint64_t> swap(moduleIndices.size());
+                    std::iota(swap.begin(), swap.end(), 0);
+                    std::swap(swap[0], swap[1]);
+                    targetModules.push_back(swap);
+                    if (moduleIndices.size() > 2) {
+                        std::vector<uint64_t> shift;
+                        for (uint64_t memberIndex = 0; memberIndex < moduleIndices.size(); ++memberIndex) {
+                            shift.push_back((memberIndex + 1) % moduleIndices.size());
+                        }
+                        targetModules.push_back(shift);
+                    }
+                    for (auto const& targets : targetModules) {
+                        permutations.emplace_back();
+                        for (uint64_t memberIndex = 0; memberIndex < moduleIndices.size(); ++memberIndex) {
+                            for (uint64_t variableIndex = 0; variableIndex < moduleVariables[memberIndex].size(); ++variableIndex) {
+                                permutations.back()[moduleVariables[memberIndex][variableIndex]] = moduleVariables[targets[memberIndex]][variableIndex].getExpression();
+                            }
+                        }
+                    }
+                }
+
+                // The remainder of the program has to treat all modules of the group alike.
+                std::set<uint64_t> members(moduleIndices.begin(), moduleIndices.end());
+                for (uint64_t moduleIndex = 0; failureReason.empty() && moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    if (members.count(moduleIndex) > 0) {
+                        continue;
+                    }
+                    for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                        for (auto const& expression : getExpressionsOfCommand(command)) {
+                            if (!isInvariant(expression, groupVariables, permutations)) {
+                                failureReason = "a command of module '" + program.getModule(moduleIndex).getName() + "' is not symmetric";
+                            }
+                        }
+                    }
+                }
+                for (auto const& label : program.getLabels()) {
+                    if (failureReason.empty() && !isInvariant(label.getStatePredicateExpression(), groupVariables, permutations)) {
+                        failureReason = "label '" + label.getName() + "' is not symmetric";
+                    }
+                }
+                for (auto const& rewardModel : program.getRewardModels()) {
+                    bool symmetric = true;
+                    for (auto const& stateReward : rewardModel.getStateRewards()) {
+                        symmetric &= isInvariant(stateReward.getStatePredicateExpression(), groupVariables, permutations) && isInvariant(stateReward.getRewardValueExpression(), groupVariables, permutations);
+                    }
+                    for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+                        symmetric &= renamedActions.count(stateActionReward.getActionName()) == 0;
+                        symmetric &= isInvariant(stateActionReward.getStatePredicateExpression(), groupVariables, permutations) && isInvariant(stateActionReward.getRewardValueExpression(), groupVariables, permutations);
+                    }
+                    for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
+                        symmetric &= renamedActions.count(transitionReward.getActionName()) == 0;
+                        symmetric &= isInvariant(transitionReward.getSourceStatePredicateExpression(), groupVariables, permutations) && isInvariant(transitionReward.getTargetStatePredicateExpression(), groupVariables, permutations) && isInvariant(transitionReward.getRewardValueExpression(), groupVariables, permutations);
+                    }
+                    if (failureReason.empty() && !symmetric) {
+                        failureReason = "reward model '" + rewardModel.getName() + "' is not symmetric";
+                    }
+                }
+                for (auto const& expression : additionalExpressions) {
+                    if (failureReason.empty() && !isInvariant(expression, groupVariables, permutations)) {
+                        failureReason = "expression '" + expression.toString() + "' is not symmetric";
+                    }
+                }
+
+                if (failureReason.empty()) {
+                    STORM_LOG_INFO("Exploiting the symmetry of the " << moduleIndices.size() << " modules renamed from module '" << baseModule.getName() << "'.");
+                    groups.push_back(std::move(group));
+                } else {
+                    STORM_LOG_INFO("Not exploiting the symmetry of the modules renamed from module '" << baseModule.getName() << "', because " << failureReason << ".");
+                }
+            }
+        }
+
+        bool SymmetryReduction::empty() const {
+            return groups.empty();
+        }
+
+        uint64_t SymmetryReduction::getNumberOfGroups() const {
+            return groups.size();
+        }
+
+        void SymmetryReduction::canonicalize(CompressedState& state) const {
+            std::vector<uint64_t> values;
+            std::vector<uint64_t> order;
+            for (auto const& group : groups) {
+                uint64_t numberOfModules = group.moduleFields.size();
+                uint64_t numberOfFields = group.moduleFields.front().size();
+
+                // Extract the values of the variables of all modules.
+                values.resize(numberOfModules * numberOfFields);
+                for (uint64_t module = 0; module < numberOfModules; ++module) {
+                    for (uint64_t field = 0; field < numberOfFields; ++field) {
+                        Field const& position = group.moduleFields[module][field];
+                        values[module * numberOfFields + field] = position.bitWidth == 0 ? 0 : state.getAsInt(position.bitOffset, position.bitWidth);
+                    }
+                }
+
+                // Sort the modules lexicographically by their values and write back the values in this order.
+                order.resize(numberOfModules);
+                std::iota(order.begin(), order.end(), 0);
+                auto lessThan = [&values, numberOfFields] (uint64_t first, uint64_t second) {
+                    return std::lexicographical_compare(values.begin() + first * numberOfFields, values.begin() + (first + 1) * numberOfFields, values.begin() + second * numberOfFields, values.begin() + (second + 1) * numberOfFields);
+                };
+                if (std::is_sorted(order.begin(), order.end(), lessThan)) {
+                    continue;
+                }
+                std::sort(order.begin(), order.end(), lessThan);
+                for (uint64_t module = 0; module < numberOfModules; ++module) {
+                    for (uint64_t field = 0; field < numberOfFields; ++field) {
+                        Field const& position = group.moduleFields[module][field];
+                        if (position.bitWidth > 0) {
+                            state.setFromInt(position.bitOffset, position.bitWidth, values[order[module] * numberOfFields + field]);
+                        }
+                    }
+                }
+            }
+        }
+
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef STORM_GENERATOR_SYMMETRYREDUCTION_H_
+#define STORM_GENERATOR_SYMMETRYREDUCTION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class Expression;
+    }
+
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * Groups of modules of a PRISM program that are fully symmetric, i.e. that can be permuted arbitrarily without
+         * changing the behavior of the program. This is the case for modules that are obtained by renaming the same
+         * (base) module, provided that the remainder of the program (the other modules, the labels and the reward
+         * models) treats all modules of the group alike.
+         *
+         * As all states that only differ by such a permutation are bisimilar, it suffices to explore one representative
+         * of them. The representative is obtained by sorting the modules of each group by the values of their variables.
+         */
+        class SymmetryReduction {
+        public:
+            /*!
+             * Creates an object without groups of symmetric modules. Such an object leaves all states unchanged.
+             */
+            SymmetryReduction() = default;
+
+            /*!
+             * Detects the groups of symmetric modules of the given program, whose constants and formulas must have been
+             * substituted. Groups for which the symmetry can not be established syntactically are dropped.
+             *
+             * @param program The program whose symmetries to detect.
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @param additionalExpressions Further expressions that have to be invariant under permutations of the
+             * modules of a group, e.g. the expressions of the labels and terminal states requested by the properties.
+             */
+            SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& additionalExpressions = {});
+
+            /*!
+             * Retrieves whether there are no groups of symmetric modules.
+             */
+            bool empty() const;
+
+            /*!
+             * Retrieves the number of groups of symmetric modules.
+             */
+            uint64_t getNumberOfGroups() const;
+
+            /*!
+             * Replaces the given state by the representative of all states that are obtained by permuting the modules
+             * of the groups.
+             *
+             * @param state The state to replace by its representative.
+             */
+            void canonicalize(CompressedState& state) const;
+
+        private:
+            /*!
+             * The position of a variable within the states.
+             */
+            struct Field {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+            };
+
+            /*!
+             * A group of symmetric modules. For every module, the positions of its variables are stored such that the
+             * i-th positions of all modules belong to variables that correspond to each other under the renaming.
+             */
+            struct Group {
+                std::vector<std::vector<Field>> moduleFields;
+            };
+
+            // The groups of symmetric modules.
+            std::vector<Group> groups;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_SYMMETRYREDUCTION_H_ */
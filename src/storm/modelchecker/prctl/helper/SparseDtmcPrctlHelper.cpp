@@ -9,6 +9,7 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/storage/DynamicPriorityQueue.h"
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+#include "storm/storage/SparseSubmatrixView.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
@@ -54,7 +55,7 @@ namespace storm {
                     maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
                 } else {
                     maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, stepBound);
-                    maybeStates &= ~psiStates;
+                    maybeStates.andNot(psiStates);
                 }
                 
                 STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
@@ -63,7 +64,8 @@ namespace storm {
                 
                 if (!maybeStates.empty()) {
                     // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
-                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
+                    // As we only multiply with the submatrix, it does not need to be copied.
+                    storm::storage::SparseSubmatrixView<ValueType> submatrix(transitionMatrix, true, maybeStates, maybeStates);
                     
                     // Create the vector of one-step probabilities to go to target states.
                     std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
@@ -225,14 +227,6 @@ namespace storm {
                         storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
-                        // We can eliminate the rows and columns from the original transition probability matrix.
-                        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
-                        if (convertToEquationSystem) {
-                            // Converting the matrix from the fixpoint notation to the form needed for the equation
-                            // system. That is, we go from x = A*x + b to (I-A)x = b.
-                            submatrix.convertToEquationSystem();
-                        }
-                        
                         // Initialize the x vector with the hint (if available) or with 0.5 for each element.
                         // This is the initial guess for the iterative solvers. It should be safe as for all
                         // 'maybe' states we know that the probability is strictly larger than 0.
@@ -247,10 +241,24 @@ namespace storm {
                         // the accumulated probability of going from state i to some 'yes' state.
                         std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1);
                         
-                        // Now solve the created system of linear equations.
+                        // Create the solver for the rows and columns of the maybe states.
                         goal.restrictRelevantValues(maybeStates);
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+                        if (convertToEquationSystem) {
+                            // Converting the matrix from the fixpoint notation to the form needed for the equation
+                            // system. That is, we go from x = A*x + b to (I-A)x = b.
+                            storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
+                            submatrix.convertToEquationSystem();
+                            solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix));
+                        } else {
+                            // In the fixpoint notation, the solver can work on a view of the submatrix, which saves
+                            // copying the entries of the maybe states.
+                            storm::storage::SparseSubmatrixView<ValueType> submatrix(transitionMatrix, true, maybeStates, maybeStates);
+                            solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, submatrix);
+                        }
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                        
+                        // Now solve the created system of linear equations.
                         solver->solveEquations(env, x, b);
                         
                         // Set values of resulting vector according to result.
@@ -483,8 +491,7 @@ namespace storm {
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
                         // In this case we have to compute the reward values for the remaining states.
-                        // We can eliminate the rows and columns from the original transition probability matrix.
-                        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
+                        uint64_t numberOfMaybeStates = maybeStates.getNumberOfSetBits();
                         
                         // Initialize the x vector with the hint (if available) or with 1 for each element.
                         // This is the initial guess for the iterative solvers.
@@ -492,17 +499,25 @@ namespace storm {
                         if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint()) {
                             x = storm::utility::vector::filterVector(hint.template asExplicitModelCheckerHint<ValueType>().getResultHint(), maybeStates);
                         } else {
-                            x = std::vector<ValueType>(submatrix.getColumnCount(), storm::utility::one<ValueType>());
+                            x = std::vector<ValueType>(numberOfMaybeStates, storm::utility::one<ValueType>());
                         }
                         
                         // Prepare the right-hand side of the equation system.
-                        std::vector<ValueType> b = totalStateRewardVectorGetter(submatrix.getRowCount(), transitionMatrix, maybeStates);
+                        std::vector<ValueType> b = totalStateRewardVectorGetter(numberOfMaybeStates, transitionMatrix, maybeStates);
 
                         storm::solver::LinearEquationSolverRequirements requirements = linearEquationSolverFactory.getRequirements(env);
                         boost::optional<std::vector<ValueType>> upperRewardBounds;
                         requirements.clearLowerBounds();
+                        
+                        // We can eliminate the rows and columns from the original transition probability matrix. An
+                        // explicit submatrix is only needed for the equation system format and for the upper bounds.
+                        // Otherwise, the solver works on a view of the submatrix.
+                        boost::optional<storm::storage::SparseMatrix<ValueType>> submatrix;
+                        if (convertToEquationSystem || requirements.upperBounds()) {
+                            submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
+                        }
                         if (requirements.upperBounds()) {
-                            upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
+                            upperRewardBounds = computeUpperRewardBounds(submatrix.get(), b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
                             requirements.clearUpperBounds();
                         }
                         STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
@@ -510,12 +525,18 @@ namespace storm {
                         // If necessary, convert the matrix from the fixpoint notation to the form needed for the equation system.
                         if (convertToEquationSystem) {
                             // go from x = A*x + b to (I-A)x = b.
-                            submatrix.convertToEquationSystem();
+                            submatrix->convertToEquationSystem();
                         }
 
                         // Create the solver.
                         goal.restrictRelevantValues(maybeStates);
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+                        if (submatrix) {
+                            solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix.get()));
+                        } else {
+                            storm::storage::SparseSubmatrixView<ValueType> submatrixView(transitionMatrix, true, maybeStates, maybeStates);
+                            solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, submatrixView);
+                        }
                         solver->setLowerBound(storm::utility::zero<ValueType>());
                         if (upperRewardBounds) {
                             solver->setUpperBounds(std::move(upperRewardBounds.get()));
@@ -11,6 +11,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseSubmatrixView.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -67,14 +68,15 @@ namespace storm {
                     } else {
                         maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, stepBound);
                     }
-                    maybeStates &= ~psiStates;
+                    maybeStates.andNot(psiStates);
                 }
                 
                 STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
                 
                 if (!maybeStates.empty()) {
                     // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
-                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+                    // As we only multiply with the submatrix, it does not need to be copied.
+                    storm::storage::SparseSubmatrixView<ValueType> submatrix(transitionMatrix, true, maybeStates, maybeStates);
                     std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
                     
                     // Create the vector with which to multiply.
@@ -434,15 +436,15 @@ namespace storm {
                 boost::optional<std::vector<uint64_t>> scheduler;
             };
             
-            template<typename ValueType>
-            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+            template<typename ValueType, typename MatrixType>
+            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, MatrixType&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
                 
                 // Initialize the solution vector.
                 std::vector<ValueType> x = hint.hasValueHint() ? std::move(hint.getValueHint()) : std::vector<ValueType>(submatrix.getRowGroupCount(), hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<ValueType>());
                 
                 // Set up the solver.
                 storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::forward<MatrixType>(submatrix));
                 solver->setRequirementsChecked();
                 solver->setHasUniqueSolution(hint.hasUniqueSolution());
                 solver->setHasNoEndComponents(hint.hasNoEndComponents());
@@ -569,11 +571,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b) {
-                // First, we can eliminate the rows and columns from the original transition probability matrix for states
-                // whose probabilities are already known.
-                submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
-                
+            void computeFixedPointVectorUntilProbabilities(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, std::vector<ValueType>& b) {
                 // Prepare the right-hand side of the equation system. For entry i this corresponds to
                 // the accumulated probability of going from state i to some state that has probability 1.
                 b = transitionMatrix.getConstrainedRowGroupSumVector(qualitativeStateSets.maybeStates, qualitativeStateSets.statesWithProbability1);
@@ -582,6 +580,15 @@ namespace storm {
                 goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
             }
             
+            template<typename ValueType>
+            void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b) {
+                // First, we can eliminate the rows and columns from the original transition probability matrix for states
+                // whose probabilities are already known.
+                submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
+                
+                computeFixedPointVectorUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, b);
+            }
+            
             template<typename ValueType>
             boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
                 
@@ -665,12 +672,13 @@ namespace storm {
                         if (hintInformation.getEliminateEndComponents()) {
                             ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler);
                         } else {
-                            // Otherwise, we compute the standard equations.
-                            computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
+                            // Otherwise, we compute the standard equations. Their matrix is the submatrix of the maybe
+                            // states, so the solver can work on a view of it instead of a copy.
+                            computeFixedPointVectorUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, b);
                         }
                         
                         // Now compute the results for the maybe states.
-                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                        MaybeStateResult<ValueType> resultForMaybeStates = hintInformation.getEliminateEndComponents() ? computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation) : computeValuesForMaybeStates(env, std::move(goal), storm::storage::SparseSubmatrixView<ValueType>(transitionMatrix, true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates), b, produceScheduler, hintInformation);
                         
                         // If we eliminated end components, we need to extract the result differently.
                         if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -219,7 +219,7 @@ namespace storm {
                 }
                 ++currentIndex;
             }
-            regularStatesInBsccs &= ~bsccRepresentativesAsBitVector;
+            regularStatesInBsccs.andNot(bsccRepresentativesAsBitVector);
             
             // Compute the average time to stay in each state for all states in BSCCs.
             std::vector<ValueType> averageTimeInStates(stateValues.size(), storm::utility::one<ValueType>());
@@ -335,7 +335,7 @@ namespace storm {
             // Start by determining the states that have a non-zero probability of reaching the target states within the
             // time bound.
             storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(this->getModel().getBackwardTransitions(), phiStates, psiStates, true, pathFormula.getUpperBound<uint64_t>());
-            statesWithProbabilityGreater0 &= ~psiStates;
+            statesWithProbabilityGreater0.andNot(psiStates);
             
             // Determine whether we need to perform some further computation.
             bool furtherComputationNeeded = true;
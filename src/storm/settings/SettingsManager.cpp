@@ -637,9 +637,17 @@ namespace storm {
             return dynamic_cast<storm::settings::modules::BuildSettings&>(mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName));
         }
         
+        storm::settings::modules::CoreSettings& mutableCoreSettings() {
+            return dynamic_cast<storm::settings::modules::CoreSettings&>(mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName));
+        }
+        
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
             return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
         }
+
+        storm::settings::modules::SylvanSettings& mutableSylvanSettings() {
+            return dynamic_cast<storm::settings::modules::SylvanSettings&>(mutableManager().getModule(storm::settings::modules::SylvanSettings::moduleName));
+        }
         
         void initializeAll(std::string const& name, std::string const& executableName) {
             storm::settings::mutableManager().setName(name, executableName);
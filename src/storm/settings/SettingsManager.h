@@ -13,8 +13,10 @@ namespace storm {
     namespace settings {
         namespace modules {
             class BuildSettings;
+            class CoreSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class SylvanSettings;
         }
         class Option;
         
@@ -311,6 +313,14 @@ namespace storm {
          */
         storm::settings::modules::BuildSettings& mutableBuildSettings();
         
+        /*!
+         * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the core settings.
+         */
+        storm::settings::modules::CoreSettings& mutableCoreSettings();
+        
         /*!
          * Retrieves the abstraction settings in a mutable form. This is only meant to be used for debug purposes or very
          * rare cases where it is necessary.
@@ -318,6 +328,14 @@ namespace storm {
          * @return An object that allows accessing and modifying the abstraction settings.
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
+
+        /*!
+         * Retrieves the Sylvan settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the Sylvan settings.
+         */
+        storm::settings::modules::SylvanSettings& mutableSylvanSettings();
         
     } // namespace settings
 } // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/settings/modules/BuildSettings.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -22,6 +25,17 @@ namespace storm {
             const std::string explorationOrderOptionShortName = "eo";
             const std::string explorationChecksOptionName = "explchecks";
             const std::string explorationChecksOptionShortName = "ec";
+            const std::string explorationThreadsOptionName = "explthreads";
+            const std::string noExpressionCompilationOptionName = "no-expression-compilation";
+            const std::string noGuardIndexOptionName = "no-guard-index";
+            const std::string outOfCoreOptionName = "outofcore";
+            const std::string outOfCoreBufferOptionName = "outofcore-buffer";
+            const std::string symmetryReductionOptionName = "symmetry";
+            const std::string compositionalOptionName = "compositional";
+            const std::string partialOrderReductionOptionName = "por";
+            const std::string ddVariableOrderOptionName = "ddvarorder";
+            const std::string ddVariableOrderInputOptionName = "ddvarorder-import";
+            const std::string ddVariableOrderOutputOptionName = "ddvarorder-export";
             const std::string prismCompatibilityOptionName = "prismcompat";
             const std::string prismCompatibilityOptionShortName = "pc";
             const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -52,6 +66,24 @@ namespace storm {
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName).setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false, "Sets the number of threads that explore the state space of explicit models (only for breadth-first exploration of PRISM and JANI models).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. If 0, one thread per available core is used.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreOptionName, false, "If set, the transitions of explicit models are written to disk during exploration, which lowers the peak memory consumption during the construction (only for breadth-first exploration). The final model is held in memory.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which to store the transitions. If empty, the system's temporary directory is used.").setDefaultValueString("").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreBufferOptionName, false, "Sets the number of transitions that are held in memory before they are written to disk (see outofcore).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of transitions.").setDefaultValueUnsignedInteger(1ull << 22).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, the exploration of explicit models maps every state to a representative modulo permutations of fully symmetric modules (only for PRISM programs whose modules are renamed copies).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, the exploration of explicit MDPs postpones choices that are independent of an invisible command or edge, which preserves the probabilities of properties without next operators (only without rewards).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compositionalOptionName, false, "If set, the modules are built and minimized with respect to bisimulation one after the other (only for PRISM CTMCs whose modules neither synchronize nor share variables).").setIsAdvanced().build());
+                std::vector<std::string> ddVariableOrderHeuristics = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false, "Sets the heuristic that orders the variables of symbolic models before any decision diagram is built.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. 'force' places variables that occur in the same command (edge) close to each other.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderHeuristics)).setDefaultValueString("declaration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderInputOptionName, false, "Reads the order of the variables of symbolic models from the given file (one variable name per line).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOutputOptionName, false, "Writes the order of the variables of symbolic models to the given file, from which it can be imported again.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noExpressionCompilationOptionName, false, "If set, guards and updates are not compiled to bytecode but evaluated by the expression evaluator during explicit model exploration.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noGuardIndexOptionName, false, "If set, the guards of all commands of PRISM programs are evaluated in every state during explicit model exploration instead of only those that an index over the guards deems possibly enabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
@@ -125,10 +157,76 @@ namespace storm {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isNoExpressionCompilationSet() const {
+                return this->getOption(noExpressionCompilationOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isNoGuardIndexSet() const {
+                return this->getOption(noGuardIndexOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isOutOfCoreSet() const {
+                return this->getOption(outOfCoreOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getOutOfCoreDirectory() const {
+                return this->getOption(outOfCoreOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            uint64_t BuildSettings::getOutOfCoreBufferSize() const {
+                return this->getOption(outOfCoreBufferOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isCompositionalSet() const {
+                return this->getOption(compositionalOptionName).getHasOptionBeenSet();
+            }
+
+            storm::builder::DdVariableOrderHeuristic BuildSettings::getDdVariableOrderHeuristic() const {
+                std::string heuristicAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+                if (heuristicAsString == "declaration") {
+                    return storm::builder::DdVariableOrderHeuristic::Declaration;
+                } else if (heuristicAsString == "force") {
+                    return storm::builder::DdVariableOrderHeuristic::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable order heuristic '" << heuristicAsString << "'.");
+            }
+
+            bool BuildSettings::isDdVariableOrderInputSet() const {
+                return this->getOption(ddVariableOrderInputOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getDdVariableOrderInputFilename() const {
+                return this->getOption(ddVariableOrderInputOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool BuildSettings::isDdVariableOrderOutputSet() const {
+                return this->getOption(ddVariableOrderOutputOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getDdVariableOrderOutputFilename() const {
+                return this->getOption(ddVariableOrderOutputOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             uint64_t BuildSettings::getBitsForUnboundedVariables() const {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+                uint64_t numberOfThreads = this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+                }
+                return numberOfThreads;
+            }
+
         }
 
 
@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrder.h"
 
 namespace storm {
     namespace settings {
@@ -31,6 +32,20 @@ namespace storm {
                  */
                 bool isExplorationChecksSet() const;
 
+                /*!
+                 * Retrieves whether the compilation of guards and updates to bytecode is disabled.
+                 *
+                 * @return True iff expressions are to be evaluated by the expression evaluator only.
+                 */
+                bool isNoExpressionCompilationSet() const;
+
+                /*!
+                 * Retrieves whether the index over the guards of PRISM commands is disabled.
+                 *
+                 * @return True iff the guards of all commands are to be evaluated in every state.
+                 */
+                bool isNoGuardIndexSet() const;
+
                 /*!
                  * Retrieves the exploration order if it was set.
                  *
@@ -116,6 +131,94 @@ namespace storm {
                  */
                 uint64_t getBitsForUnboundedVariables() const;
 
+                /*!
+                 * Retrieves the number of threads that are to be used to explore the state space of an explicit model.
+                 *
+                 * @return The number of exploration threads (where 0 is replaced by the number of available cores).
+                 */
+                uint64_t getNumberOfExplorationThreads() const;
+
+                /*!
+                 * Retrieves whether the transitions of explicit models are to be stored on disk during exploration.
+                 * This only lowers the peak memory consumption during the construction, the final model is held in
+                 * memory.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isOutOfCoreSet() const;
+
+                /*!
+                 * Retrieves the directory in which the transitions are stored during an out-of-core exploration.
+                 *
+                 * @return The directory (or the empty string for the system's temporary directory).
+                 */
+                std::string getOutOfCoreDirectory() const;
+
+                /*!
+                 * Retrieves the number of transitions that are held in memory before they are written to disk during an
+                 * out-of-core exploration.
+                 *
+                 * @return The number of transitions.
+                 */
+                uint64_t getOutOfCoreBufferSize() const;
+
+                /*!
+                 * Retrieves whether symmetric modules are to be exploited during the exploration of explicit models.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether a partial-order reduction is to be applied during the exploration of explicit models.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isPartialOrderReductionSet() const;
+
+                /*!
+                 * Retrieves whether explicit models are to be built compositionally, i.e. module by module with
+                 * intermediate bisimulation minimization.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isCompositionalSet() const;
+
+                /*!
+                 * Retrieves the heuristic that orders the variables of symbolic models.
+                 *
+                 * @return The heuristic.
+                 */
+                storm::builder::DdVariableOrderHeuristic getDdVariableOrderHeuristic() const;
+
+                /*!
+                 * Retrieves whether the order of the variables of symbolic models is to be read from a file.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdVariableOrderInputSet() const;
+
+                /*!
+                 * Retrieves the name of the file from which the order of the variables of symbolic models is read.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getDdVariableOrderInputFilename() const;
+
+                /*!
+                 * Retrieves whether the order of the variables of symbolic models is to be written to a file.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdVariableOrderOutputSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the order of the variables of symbolic models is written.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getDdVariableOrderOutputFilename() const;
+
 
                 // The name of the module.
                 static const std::string moduleName;
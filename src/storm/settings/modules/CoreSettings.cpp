@@ -1,5 +1,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
+#include <thread>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -31,6 +33,7 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::threadsOptionName = "threads";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
                 std::vector<std::string> engines;
@@ -59,6 +62,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used for numerical computations and for parsing and exporting DRN files.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 uses one thread per available core).").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             storm::solver::EquationSolverType  CoreSettings::getEquationSolver() const {
@@ -134,6 +139,18 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            uint64_t CoreSettings::getNumberOfThreads() const {
+                uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+                }
+                return numberOfThreads;
+            }
+
+            void CoreSettings::setNumberOfThreads(uint64_t numberOfThreads) {
+                this->getOption(threadsOptionName).getArgumentByName("count").setFromStringValue(std::to_string(numberOfThreads));
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
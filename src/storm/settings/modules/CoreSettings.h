@@ -103,6 +103,20 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Retrieves the number of threads to use for numerical computations and for parsing DRN files.
+                 *
+                 * @return The number of threads (at least one).
+                 */
+                uint64_t getNumberOfThreads() const;
+
+                /*!
+                 * Sets the number of threads to use for numerical computations and for parsing DRN files.
+                 *
+                 * @param numberOfThreads The number of threads (0 uses one thread per available core).
+                 */
+                void setNumberOfThreads(uint64_t numberOfThreads);
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -142,6 +156,7 @@ namespace storm {
                 static const std::string ddLibraryOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
+                static const std::string threadsOptionName;
                 static const std::string cudaOptionName;
             };
 
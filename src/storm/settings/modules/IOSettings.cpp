@@ -20,6 +20,7 @@ namespace storm {
             const std::string IOSettings::exportDotOptionName = "exportdot";
             const std::string IOSettings::exportDotMaxWidthOptionName = "dot-maxwidth";
             const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
+            const std::string IOSettings::exportBinaryOptionName = "exportbinary";
             const std::string IOSettings::exportDdOptionName = "exportdd";
             const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
             const std::string IOSettings::exportCdfOptionName = "exportcdf";
@@ -30,6 +31,8 @@ namespace storm {
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
             const std::string IOSettings::explicitDrnOptionShortName = "drn";
+            const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+            const std::string IOSettings::explicitBinaryOptionShortName = "bin";
             const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
             const std::string IOSettings::explicitImcaOptionShortName = "imca";
             const std::string IOSettings::prismInputOptionName = "prism";
@@ -63,9 +66,11 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCdfOptionName, false, "Exports the cumulative density function for reward bounded properties into a .csv file.").setIsAdvanced().setShortName(exportCdfOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "A path to an existing directory where the cdf files will be stored.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false, "Exports the choices of an optimal scheduler to the given file (if supported by engine).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportMonotonicityName, false, "Exports the result of monotonicity checking to the given file.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build()).build());
-                this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format.")
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format. If the file name ends with .gz, the file is compressed.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  preventDRNPlaceholderOptionName, true, "If given, the exported DRN contains no placeholders").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportBinaryOptionName, "", "If given, the loaded model will be written to the specified file in the binary format, which can be loaded without parsing.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportDdOptionName, "", "If given, the loaded model will be written to the specified file in the drdd format.")
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitOptionName, false, "Parses the model given in an explicit (sparse) representation.").setShortName(explicitOptionShortName)
@@ -74,6 +79,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.").setShortName(explicitDrnOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary format (as written by --" + exportBinaryOptionName + ").").setShortName(explicitBinaryOptionShortName).setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
+                                .build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.").setShortName(explicitImcaOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
@@ -144,6 +152,14 @@ namespace storm {
                 return this->getOption(preventDRNPlaceholderOptionName).getHasOptionBeenSet();
             }
 
+            bool IOSettings::isExportBinarySet() const {
+                return this->getOption(exportBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportBinaryFilename() const {
+                return this->getOption(exportBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             bool IOSettings::isExportDdSet() const {
                 return this->getOption(exportDdOptionName).getHasOptionBeenSet();
             }
@@ -200,6 +216,14 @@ namespace storm {
                 return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
             }
 
+            bool IOSettings::isExplicitBinarySet() const {
+                return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExplicitBinaryFilename() const {
+                return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitIMCASet() const {
                 return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
             }
@@ -336,6 +360,7 @@ namespace storm {
                 // Ensure that not two explicit input models were given.
                 uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
                 numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+                numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
                 numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
                 STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
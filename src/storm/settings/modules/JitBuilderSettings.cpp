@@ -19,6 +19,8 @@ namespace storm {
             const std::string JitBuilderSettings::stormIncludeDirectoryOptionName = "storm";
             const std::string JitBuilderSettings::boostIncludeDirectoryOptionName = "boost";
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
+            const std::string JitBuilderSettings::sparseppIncludeDirectoryOptionName = "sparsepp";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cache";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
 
@@ -32,6 +34,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory containing the boost headers version >= 1.61.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, carlIncludeDirectoryOptionName, false, "The include directory of carl.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory containing the carl headers.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseppIncludeDirectoryOptionName, false, "The include directory of sparsepp.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory containing the sparsepp headers.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "If set, compiled builders are kept in the given directory and reused for identical models.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which to store the compiled builders.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, compilerFlagsOptionName, false, "The flags passed to the compiler.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.").setIsAdvanced()
@@ -70,6 +76,22 @@ namespace storm {
                 return this->getOption(carlIncludeDirectoryOptionName).getArgumentByName("dir").getValueAsString();
             }
 
+            bool JitBuilderSettings::isSparseppIncludeDirectorySet() const {
+                return this->getOption(sparseppIncludeDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getSparseppIncludeDirectory() const {
+                return this->getOption(sparseppIncludeDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
             bool JitBuilderSettings::isDoctorSet() const {
                 return this->getOption(doctorOptionName).getHasOptionBeenSet();
             }
@@ -27,6 +27,12 @@ namespace storm {
                 bool isCarlIncludeDirectorySet() const;
                 std::string getCarlIncludeDirectory() const;
 
+                bool isSparseppIncludeDirectorySet() const;
+                std::string getSparseppIncludeDirectory() const;
+
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+
                 bool isCompilerFlagsSet() const;
                 std::string getCompilerFlags() const;
                 
@@ -42,6 +48,8 @@ namespace storm {
                 static const std::string stormIncludeDirectoryOptionName;
                 static const std::string boostIncludeDirectoryOptionName;
                 static const std::string carlIncludeDirectoryOptionName;
+                static const std::string sparseppIncludeDirectoryOptionName;
+                static const std::string cacheDirectoryOptionName;
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
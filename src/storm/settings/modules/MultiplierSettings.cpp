@@ -13,12 +13,17 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::compactStorageOptionName = "compact";
+            const std::string MultiplierSettings::multicolorGaussSeidelOptionName = "multicolor";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+                std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactStorageOptionName, false, "Sets whether the native multiplier uses a copy of the matrix with 32-bit column indices kept apart from the values. This reduces the memory traffic of the multiplications, but requires memory for the copy.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, multicolorGaussSeidelOptionName, false, "Sets whether Gauss-Seidel multiplications of the native multiplier process the states in a multicolor order such that states of the same color can be updated in parallel (see --threads).").setIsAdvanced().build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -27,6 +32,8 @@ namespace storm {
                     return storm::solver::MultiplierType::Native;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
+                } else if (type == "simd") {
+                    return storm::solver::MultiplierType::Simd;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -35,6 +42,14 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isCompactStorageSet() const {
+                return this->getOption(compactStorageOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MultiplierSettings::isMulticolorGaussSeidelSet() const {
+                return this->getOption(multicolorGaussSeidelOptionName).getHasOptionBeenSet();
+            }
         }
     }
 }
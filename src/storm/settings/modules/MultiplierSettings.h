@@ -22,11 +22,29 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether the native multiplier should operate on a compact copy of the matrix that stores
+                 * the column indices with 32 bits and separately from the values.
+                 *
+                 * @return True iff the compact storage is to be used.
+                 */
+                bool isCompactStorageSet() const;
+                
+                /*!
+                 * Retrieves whether Gauss-Seidel multiplications of the native multiplier should process the states in
+                 * a multicolor order, which allows to update states of the same color in parallel.
+                 *
+                 * @return True iff the multicolor order is to be used.
+                 */
+                bool isMulticolorGaussSeidelSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string compactStorageOptionName;
+                static const std::string multicolorGaussSeidelOptionName;
             };
             
         }
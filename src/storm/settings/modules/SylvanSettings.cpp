@@ -32,6 +32,10 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            void SylvanSettings::setNumberOfThreads(uint64_t numberOfThreads) {
+                this->getOption(threadCountOptionName).getArgumentByName("value").setFromStringValue(std::to_string(numberOfThreads));
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
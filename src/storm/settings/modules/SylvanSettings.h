@@ -36,6 +36,14 @@ namespace storm {
                  * Retrieves whether the number of threads to use was set.
                  */
                 bool isNumberOfThreadsSet() const;
+
+                /*!
+                 * Sets the number of threads available to Sylvan (zero means that the number is auto-detected). This
+                 * only takes effect when Sylvan is initialized the next time, i.e., when no DD manager of Sylvan exists.
+                 *
+                 * @param numberOfThreads The number of threads.
+                 */
+                void setNumberOfThreads(uint64_t numberOfThreads);
                 
                 // The name of the module.
                 static const std::string moduleName;
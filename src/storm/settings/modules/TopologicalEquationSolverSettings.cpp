@@ -24,14 +24,19 @@ namespace storm {
             const std::string TopologicalEquationSolverSettings::moduleName = "topological";
             const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
             const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+            const std::string TopologicalEquationSolverSettings::parallelSccSchedulingOptionName = "parallel";
+            const std::string TopologicalEquationSolverSettings::trivialSccBatchSizeOptionName = "batchsize";
             
             TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, underlyingEquationSolverOptionName, true, "Sets which solver is considered for solving the underlying equation systems.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the used solver.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(linearEquationSolver)).setDefaultValueString("gmm++").build()).build());
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi", "mcgs", "multicolor-gaussseidel"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true, "Sets which minmax method is considered for solving the underlying minmax equation systems.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the used min max method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("value-iteration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelSccSchedulingOptionName, false, "If set, an SCC is solved as soon as all SCCs it depends on are solved, such that independent SCCs are solved in parallel (see --threads).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, trivialSccBatchSizeOptionName, false, "Sets the maximal number of consecutive trivial SCCs that are solved together when SCCs are solved in parallel.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of trivial SCCs per task.").setDefaultValueUnsignedInteger(256).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
 
             bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -82,11 +87,21 @@ namespace storm {
                     return storm::solver::MinMaxMethod::OptimisticValueIteration;
                 } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
                     return storm::solver::MinMaxMethod::ViToPi;
+                } else if (minMaxEquationSolvingTechnique == "multicolor-gaussseidel" || minMaxEquationSolvingTechnique == "mcgs") {
+                    return storm::solver::MinMaxMethod::MulticolorGaussSeidel;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
             }
             
+            bool TopologicalEquationSolverSettings::isParallelSccSchedulingSet() const {
+                return this->getOption(parallelSccSchedulingOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t TopologicalEquationSolverSettings::getTrivialSccBatchSize() const {
+                return this->getOption(trivialSccBatchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool TopologicalEquationSolverSettings::check() const {
                 if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
                     STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
@@ -61,6 +61,21 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves whether independent SCCs are to be solved in parallel.
+                 *
+                 * @return True iff the SCCs are to be solved in parallel.
+                 */
+                bool isParallelSccSchedulingSet() const;
+                
+                /*!
+                 * Retrieves the maximal number of consecutive trivial SCCs that are solved together as one task when
+                 * the SCCs are solved in parallel.
+                 *
+                 * @return The maximal number of trivial SCCs per task.
+                 */
+                uint64_t getTrivialSccBatchSize() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +85,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string parallelSccSchedulingOptionName;
+                static const std::string trivialSccBatchSizeOptionName;
             };
             
         } // namespace modules
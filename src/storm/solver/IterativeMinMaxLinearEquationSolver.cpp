@@ -5,8 +5,11 @@
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
+#include "storm/storage/SparseSubmatrixView.h"
+
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -36,6 +39,50 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        void IterativeMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
+            StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(matrix);
+            submatrixView.reset();
+        }
+        
+        template<typename ValueType>
+        void IterativeMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) {
+            StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(std::move(matrix));
+            submatrixView.reset();
+        }
+        
+        template<typename ValueType>
+        void IterativeMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) {
+            this->localA.reset();
+            this->A = nullptr;
+            this->clearCache();
+            submatrixView = std::make_unique<storm::storage::SparseSubmatrixView<ValueType>>(view);
+        }
+        
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& IterativeMinMaxLinearEquationSolver<ValueType>::getMatrix() const {
+            if (!this->A) {
+                STORM_LOG_ASSERT(submatrixView, "No matrix was set.");
+                STORM_LOG_INFO("Copying the submatrix, because the solution method needs an explicit matrix.");
+                this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(submatrixView->toSparseMatrix());
+                this->A = this->localA.get();
+            }
+            return *this->A;
+        }
+        
+        template<typename ValueType>
+        uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::getMatrixRowGroupCount() const {
+            return this->A ? this->A->getRowGroupCount() : submatrixView->getRowGroupCount();
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> IterativeMinMaxLinearEquationSolver<ValueType>::createMultiplier(Environment const& env) const {
+            if (!this->A && submatrixView) {
+                return storm::solver::MultiplierFactory<ValueType>().create(env, *submatrixView);
+            }
+            return storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
+        }
+        
         template<typename ValueType>
         MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
             // Adjust the method if none was specified and we want exact or sound computations.
@@ -56,7 +103,7 @@ namespace storm {
                     STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
                 }
             }
-            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
+            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::MulticolorGaussSeidel, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
             return method;
         }
         
@@ -85,6 +132,9 @@ namespace storm {
                 case MinMaxMethod::ViToPi:
                     result = solveEquationsViToPi(env, dir, x, b);
                     break;
+                case MinMaxMethod::MulticolorGaussSeidel:
+                    result = solveEquationsMulticolorGaussSeidel(env, dir, x, b);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
             }
@@ -92,17 +142,30 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only plain value iteration is batched. Initial schedulers, bounds for systems without a unique solution
+            // and custom termination conditions refer to a single system. Also, the scheduler is only tracked for
+            // single systems.
+            bool isValueIteration = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == MinMaxMethod::ValueIteration;
+            bool isRegularMultiplication = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular;
+            if (isValueIteration && isRegularMultiplication && !this->hasInitialScheduler() && this->hasUniqueSolution() && !this->hasCustomTerminationCondition() && !this->isTrackSchedulerSet()) {
+                return solveEquationsValueIterationBatch(env, dir, x, b);
+            }
+            return MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, dir, x, b);
+        }
+
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
             assert(subB.size() == x.size());
             
             // Resolve the nondeterminism according to the given scheduler.
             bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> submatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
+            storm::storage::SparseMatrix<ValueType> submatrix = this->getMatrix().selectRowsFromRowGroups(scheduler, convertToEquationSystem);
             if (convertToEquationSystem) {
                 submatrix.convertToEquationSystem();
             }
-            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
+            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->getMatrix().getRowGroupIndices(), originalB);
             
             // Check whether the linear equation solver is already initialized
             if (!linearEquationSolver) {
@@ -121,7 +184,7 @@ namespace storm {
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
-            std::vector<storm::storage::sparse::state_type> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<storm::storage::sparse::state_type>(this->A->getRowGroupCount());
+            std::vector<storm::storage::sparse::state_type> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<storm::storage::sparse::state_type>(this->getMatrixRowGroupCount());
             return performPolicyIteration(env, dir, x, b, std::move(scheduler));
         }
         
@@ -130,7 +193,7 @@ namespace storm {
             std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
             // Get a vector for storing the right-hand side of the inner equation system.
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
@@ -166,17 +229,17 @@ namespace storm {
                 
                 // Go through the multiplication result and see whether we can improve any of the choices.
                 bool schedulerImproved = false;
-                for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+                for (uint_fast64_t group = 0; group < this->getMatrixRowGroupCount(); ++group) {
                     uint_fast64_t currentChoice = scheduler[group];
-                    for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
+                    for (uint_fast64_t choice = this->getMatrix().getRowGroupIndices()[group]; choice < this->getMatrix().getRowGroupIndices()[group + 1]; ++choice) {
                         // If the choice is the currently selected one, we can skip it.
-                        if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
+                        if (choice - this->getMatrix().getRowGroupIndices()[group] == currentChoice) {
                             continue;
                         }
                         
                         // Create the value of the choice.
                         ValueType choiceValue = storm::utility::zero<ValueType>();
-                        for (auto const& entry : this->A->getRow(choice)) {
+                        for (auto const& entry : this->getMatrix().getRow(choice)) {
                             choiceValue += entry.getValue() * x[entry.getColumn()];
                         }
                         choiceValue += b[choice];
@@ -186,7 +249,7 @@ namespace storm {
                         // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
                         if (valueImproved(dir, x[group], choiceValue)) {
                             schedulerImproved = true;
-                            scheduler[group] = choice - this->A->getRowGroupIndices()[group];
+                            scheduler[group] = choice - this->getMatrix().getRowGroupIndices()[group];
                             x[group] = std::move(choiceValue);
                         }
                     }
@@ -235,11 +298,11 @@ namespace storm {
             // Check whether a linear equation solver is needed and potentially start with its requirements
             bool needsLinEqSolver = false;
             needsLinEqSolver |= method == MinMaxMethod::PolicyIteration;
-            needsLinEqSolver |= method == MinMaxMethod::ValueIteration && (this->hasInitialScheduler() || hasInitialScheduler);
+            needsLinEqSolver |= (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::MulticolorGaussSeidel) && (this->hasInitialScheduler() || hasInitialScheduler);
             needsLinEqSolver |= method == MinMaxMethod::ViToPi;
             MinMaxLinearEquationSolverRequirements requirements = needsLinEqSolver ? MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env)) : MinMaxLinearEquationSolverRequirements();
 
-            if (method == MinMaxMethod::ValueIteration) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::MulticolorGaussSeidel) {
                 if (!this->hasUniqueSolution()) { // Traditional value iteration has no requirements if the solution is unique.
                     // Computing a scheduler is only possible if the solution is unique
                     if (this->isTrackSchedulerSet()) {
@@ -361,14 +424,14 @@ namespace storm {
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = this->createMultiplier(env);
             }
 
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             if (!auxiliaryRowGroupVector2) {
-                auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
 
             // By default, we can not provide any guarantee
@@ -418,7 +481,7 @@ namespace storm {
 
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrixRowGroupCount());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
@@ -433,11 +496,11 @@ namespace storm {
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = this->createMultiplier(env);
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             
             // By default, we can not provide any guarantee
@@ -504,7 +567,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrixRowGroupCount());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
             
@@ -515,6 +578,49 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIterationBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            if (!this->multiplierA) {
+                this->multiplierA = this->createMultiplier(env);
+            }
+            
+            uint64_t numberOfVectors = x.size();
+            std::vector<ValueType> currentX = storm::utility::vector::interleave(x);
+            std::vector<ValueType> newX(currentX.size());
+            std::vector<ValueType> interleavedB = storm::utility::vector::interleave(b);
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            
+            this->startMeasureProgress();
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress) {
+                // Compute x_i' = min/max(A*x_i + b_i) for all systems.
+                this->multiplierA->multiplyAndReduceBatch(env, dir, numberOfVectors, currentX, &interleavedB, newX);
+                
+                // The convergence criterion is checked entry-wise, so it holds for the interleaved vectors iff it holds for all systems.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                status = this->updateStatus(status, false, iterations, maximalNumberOfIterations);
+                this->showProgressIterative(iterations);
+            }
+            storm::utility::vector::deinterleave(currentX, x);
+            
+            this->reportStatus(status, iterations);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -531,11 +637,11 @@ namespace storm {
             STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
 
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = this->createMultiplier(env);
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             
             // Allow aliased multiplications.
@@ -543,7 +649,7 @@ namespace storm {
             
             std::vector<ValueType>* lowerX = &x;
             this->createLowerBoundsVector(*lowerX);
-            this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
+            this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->getMatrixRowGroupCount());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
             std::vector<ValueType>* tmp = nullptr;
@@ -688,7 +794,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrixRowGroupCount());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
             
@@ -703,12 +809,12 @@ namespace storm {
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             // Prepare the solution vectors and the helper.
-            assert(x.size() == this->A->getRowGroupCount());
+            assert(x.size() == this->getMatrixRowGroupCount());
             if (!this->auxiliaryRowGroupVector) {
                 this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(this->getMatrix(), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
             } else {
                 this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
             }
@@ -746,8 +852,8 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-                this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrixRowGroupCount());
+                this->getMatrix().multiplyAndReduce(dir, this->getMatrix().getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
 
             this->reportStatus(status, iterations);
@@ -766,7 +872,7 @@ namespace storm {
             {
                 Environment viEnv = env;
                 viEnv.solver().minMax().setMethod(MinMaxMethod::ValueIteration);
-                auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->A->template toValueType<double>());
+                auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->getMatrix().template toValueType<double>());
                 impreciseSolver->setHasUniqueSolution(this->hasUniqueSolution());
                 impreciseSolver->setTrackScheduler(true);
                 if (this->hasInitialScheduler()) {
@@ -783,6 +889,17 @@ namespace storm {
             return performPolicyIteration(env, dir, x, b, std::move(initialSched));
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsMulticolorGaussSeidel(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            // Value iteration with Gauss-Seidel multiplications in which the native multiplier updates the states of
+            // one color in parallel. This preserves the monotonicity of Gauss-Seidel value iteration.
+            Environment multicolorEnv = env;
+            multicolorEnv.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+            multicolorEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            multicolorEnv.solver().multiplier().setMulticolorGaussSeidel(true);
+            return solveEquationsValueIteration(multicolorEnv, dir, x, b);
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -836,20 +953,20 @@ namespace storm {
             // Version for when the overall value type is imprecise.
 
             // Create a rational representation of the input so we can check for a proper solution later.
-            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->A->template toValueType<storm::RationalNumber>();
+            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->getMatrix().template toValueType<storm::RationalNumber>();
             std::vector<storm::RationalNumber> rationalX(x.size());
             std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
             
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = this->createMultiplier(env);
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, dir, *this, rationalA, rationalX, rationalB, *this->A, x, b, *auxiliaryRowGroupVector);
+            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, dir, *this, rationalA, rationalX, rationalB, this->getMatrix(), x, b, *auxiliaryRowGroupVector);
             
             // Translate back rational result to imprecise result.
             auto targetIt = x.begin();
@@ -870,15 +987,15 @@ namespace storm {
             // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
             
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = this->createMultiplier(env);
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, *this, *this->A, x, b, *this->A, *auxiliaryRowGroupVector, b, x);
+            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, *this, this->getMatrix(), x, b, this->getMatrix(), *auxiliaryRowGroupVector, b, x);
 
             if (!this->isCachingEnabled()) {
                 this->clearCache();
@@ -894,7 +1011,7 @@ namespace storm {
             // problem using the imprecise data type and fall back to the exact type as needed.
             
             // Translate A to its imprecise version.
-            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->A->template toValueType<ImpreciseType>();
+            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->getMatrix().template toValueType<ImpreciseType>();
             
             // Translate x to its imprecise version.
             std::vector<ImpreciseType> impreciseX(x.size());
@@ -926,13 +1043,13 @@ namespace storm {
             bool converged = false;
             try {
                 // Forward the call to the core rational search routine.
-                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, impreciseSolver, *this->A, x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
+                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, impreciseSolver, this->getMatrix(), x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
                 impreciseSolver.clearCache();
             } catch (storm::exceptions::PrecisionExceededException const& e) {
                 STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
                 
                 if (!auxiliaryRowGroupVector) {
-                    auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                    auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowGroupCount());
                 }
 
                 // Translate the imprecise value iteration result to the one we are going to use from now on.
@@ -948,11 +1065,11 @@ namespace storm {
                 impreciseA = storm::storage::SparseMatrix<ImpreciseType>();
 
                 if (!this->multiplierA) {
-                    this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                    this->multiplierA = this->createMultiplier(env);
                 }
                 
                 // Forward the call to the core rational search routine, but now with our value type as the imprecise value type.
-                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, dir, *this, *this->A, x, b, *this->A, *auxiliaryRowGroupVector, b, x);
+                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, dir, *this, this->getMatrix(), x, b, this->getMatrix(), *auxiliaryRowGroupVector, b, x);
             }
             
             if (!this->isCachingEnabled()) {
@@ -1060,17 +1177,17 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::computeOptimalValueForRowGroup(uint_fast64_t group, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint_fast64_t* choice) const {
-            uint64_t row = this->A->getRowGroupIndices()[group];
-            uint64_t groupEnd = this->A->getRowGroupIndices()[group + 1];
+            uint64_t row = this->getMatrix().getRowGroupIndices()[group];
+            uint64_t groupEnd = this->getMatrix().getRowGroupIndices()[group + 1];
             assert(row != groupEnd);
             
             auto bIt = b.begin() + row;
             ValueType& xi = x[group];
-            xi = this->A->multiplyRowWithVector(row, x) + *bIt;
+            xi = this->getMatrix().multiplyRowWithVector(row, x) + *bIt;
             uint64_t optimalRow = row;
             
             for (++row, ++bIt; row < groupEnd; ++row, ++bIt) {
-                ValueType choiceVal = this->A->multiplyRowWithVector(row, x) + *bIt;
+                ValueType choiceVal = this->getMatrix().multiplyRowWithVector(row, x) + *bIt;
                 if (minimize(dir)) {
                     if (choiceVal < xi) {
                         xi = choiceVal;
@@ -1084,7 +1201,7 @@ namespace storm {
                 }
             }
             if (choice != nullptr) {
-                *choice = optimalRow - this->A->getRowGroupIndices()[group];
+                *choice = optimalRow - this->getMatrix().getRowGroupIndices()[group];
             }
         }
         
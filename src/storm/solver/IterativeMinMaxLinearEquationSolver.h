@@ -11,6 +11,8 @@
 
 #include "storm/solver/SolverStatus.h"
 
+#include "storm/storage/SparseSubmatrixView.h"
+
 namespace storm {
     
     class Environment;
@@ -24,7 +26,17 @@ namespace storm {
             IterativeMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory);
             IterativeMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory);
             
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) override;
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) override;
+            
+            /*!
+             * Sets the matrix to the given submatrix view. Value iteration (and its variants that only multiply with
+             * the matrix) operates on the view. The other methods copy the submatrix upon their first invocation.
+             */
+            virtual void setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) override;
+            
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
 
             virtual void clearCache() const override;
             
@@ -40,10 +52,17 @@ namespace storm {
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
             bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Performs value iteration for several vectors b at once. The vectors are stored interleaved, so that each
+             * iteration traverses the matrix only once for all systems.
+             */
+            bool solveEquationsValueIterationBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
             bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsMulticolorGaussSeidel(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
@@ -77,9 +96,28 @@ namespace storm {
             
             void createLinearEquationSolver(Environment const& env) const;
             
+            /*!
+             * Retrieves the matrix. If the matrix was given as a view, the submatrix is copied upon the first
+             * invocation.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+            
+            /*!
+             * Retrieves the number of row groups of the matrix (without copying a submatrix view).
+             */
+            uint64_t getMatrixRowGroupCount() const;
+            
+            /*!
+             * Creates a multiplier for the matrix, which operates on the view unless the submatrix was already copied.
+             */
+            std::unique_ptr<Multiplier<ValueType>> createMultiplier(Environment const& env) const;
+            
             /// The factory used to obtain linear equation solvers.
             std::unique_ptr<LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
             
+            // The view on the submatrix (if the matrix was given as a view).
+            std::unique_ptr<storm::storage::SparseSubmatrixView<ValueType>> submatrixView;
+            
             // possibly cached data
             mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplierA;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
@@ -10,11 +10,14 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 #include "storm/solver/AcyclicLinearEquationSolver.h"
 
+#include "storm/storage/SparseSubmatrixView.h"
+
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -26,11 +29,34 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) {
+            this->setMatrix(view.toSparseMatrix());
+        }
+        
         template<typename ValueType>
         bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             return this->internalSolveEquations(env, x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::InvalidArgumentException, "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+            if (x.empty()) {
+                return true;
+            }
+            return this->internalSolveEquationsBatch(env, x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                result &= this->internalSolveEquations(env, x[i], b[i]);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
             return LinearEquationSolverRequirements();
@@ -69,6 +95,13 @@ namespace storm {
             return solver;
         }
         
+        template<typename ValueType>
+        std::unique_ptr<LinearEquationSolver<ValueType>> LinearEquationSolverFactory<ValueType>::create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view) const {
+            std::unique_ptr<LinearEquationSolver<ValueType>> solver = this->create(env);
+            solver->setMatrix(view);
+            return solver;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat LinearEquationSolverFactory<ValueType>::getEquationProblemFormat(Environment const& env) const {
             return this->create(env)->getEquationProblemFormat(env);
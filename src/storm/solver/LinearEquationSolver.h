@@ -18,6 +18,11 @@ namespace storm {
     
     class Environment;
     
+    namespace storage {
+        template<typename ValueType>
+        class SparseSubmatrixView;
+    }
+    
     namespace solver {
         
         /*!
@@ -34,6 +39,13 @@ namespace storm {
 
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) = 0;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) = 0;
+            
+            /*!
+             * Sets the matrix to the submatrix given by the view, which must outlive the solver (or the next call to
+             * setMatrix). The view is meant for problems in the fixed point format. Solvers that do not support views
+             * copy the submatrix, which is also the default behavior.
+             */
+            virtual void setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view);
 
             /*!
              * If the solver expects the equation system format, it solves Ax = b. If it it expects a fixed point
@@ -48,6 +60,19 @@ namespace storm {
              */
             bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+            /*!
+             * Solves the equation systems for several right-hand sides b_1, ..., b_k at once (see solveEquations). The
+             * iterative solvers can treat the vectors as a batch, so that the matrix is traversed only once per
+             * iteration for all systems. Otherwise, the systems are solved one after another.
+             *
+             * @param x The solution vectors that have to be computed. There must be one vector for every right-hand
+             * side and the length of each vector must be equal to the number of rows of A.
+             * @param b The right-hand sides. The length of each vector must be equal to the number of rows of A.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+
             /*!
              * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
              * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -78,6 +103,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides. By default, this solves the systems one after
+             * another.
+             */
+            virtual bool internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
@@ -124,6 +155,15 @@ namespace storm {
              */
             std::unique_ptr<LinearEquationSolver<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) const;
 
+            /*!
+             * Creates a new linear equation solver instance for the submatrix given by the view (see
+             * LinearEquationSolver::setMatrix).
+             *
+             * @param view The view on the submatrix that defines the equation system. It must outlive the solver.
+             * @return A pointer to the newly created solver.
+             */
+            std::unique_ptr<LinearEquationSolver<ValueType>> create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view) const;
+
             /*!
              * Creates an equation solver with the current settings, but without a matrix.
              */
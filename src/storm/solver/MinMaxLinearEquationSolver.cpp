@@ -11,7 +11,10 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/storage/SparseSubmatrixView.h"
+
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -28,6 +31,11 @@ namespace storm {
         MinMaxLinearEquationSolver<ValueType>::~MinMaxLinearEquationSolver() {
             // Intentionally left empty.
         }
+        
+        template<typename ValueType>
+        void MinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) {
+            this->setMatrix(view.toSparseMatrix());
+        }
 
         template<typename ValueType>
         bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
@@ -40,6 +48,25 @@ namespace storm {
             STORM_LOG_THROW(isSet(this->direction), storm::exceptions::IllegalFunctionCallException, "Optimization direction not set.");
             solveEquations(env, convert(this->direction), x, b);
         }
+        
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::InvalidArgumentException, "The number of solution vectors (" << x.size() << ") does not match the number of vectors b (" << b.size() << ").");
+            if (x.empty()) {
+                return true;
+            }
+            return internalSolveEquationsBatch(env, d, x, b);
+        }
+        
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                result &= internalSolveEquations(env, d, x[i], b[i]);
+            }
+            return result;
+        }
 
         template<typename ValueType>
         void MinMaxLinearEquationSolver<ValueType>::setOptimizationDirection(OptimizationDirection d) {
@@ -195,6 +222,13 @@ namespace storm {
             return solver;
         }
         
+        template<typename ValueType>
+        std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> MinMaxLinearEquationSolverFactory<ValueType>::create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view) const {
+            std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> solver = this->create(env);
+            solver->setMatrix(view);
+            return solver;
+        }
+        
         template<typename ValueType>
         GeneralMinMaxLinearEquationSolverFactory<ValueType>::GeneralMinMaxLinearEquationSolverFactory() : MinMaxLinearEquationSolverFactory<ValueType>() {
             // Intentionally left empty.
@@ -204,7 +238,7 @@ namespace storm {
         std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquationSolverFactory<ValueType>::create(Environment const& env) const {
             std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result;
             auto method = env.solver().minMax().getMethod();
-            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::MulticolorGaussSeidel) {
                 result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
             } else if (method == MinMaxMethod::Topological) {
                 result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
@@ -225,7 +259,7 @@ namespace storm {
         std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMaxLinearEquationSolverFactory<storm::RationalNumber>::create(Environment const& env) const {
             std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> result;
             auto method = env.solver().minMax().getMethod();
-            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::MulticolorGaussSeidel) {
                 result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
             } else if (method == MinMaxMethod::LinearProgramming) {
                 result = std::make_unique<LpMinMaxLinearEquationSolver<storm::RationalNumber>>(std::make_unique<storm::utility::solver::LpSolverFactory<storm::RationalNumber>>());
@@ -23,6 +23,7 @@ namespace storm {
     
     namespace storage {
         template<typename T> class SparseMatrix;
+        template<typename T> class SparseSubmatrixView;
     }
     
     namespace solver {
@@ -41,6 +42,12 @@ namespace storm {
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) = 0;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) = 0;
             
+            /*!
+             * Sets the matrix to the submatrix given by the view, which must outlive the solver (or the next call to
+             * setMatrix). Solvers that do not support views copy the submatrix, which is also the default behavior.
+             */
+            virtual void setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view);
+            
             /*!
              * Solves the equation system x = min/max(A*x + b) given by the parameters. Note that the matrix A has
              * to be given upon construction time of the solver object.
@@ -60,6 +67,19 @@ namespace storm {
              */
             void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
+            /*!
+             * Solves the equation systems x_i = min/max(A*x_i + b_i) for several vectors b_1, ..., b_k at once (see
+             * solveEquations). The iterative solvers can treat the vectors as a batch, so that the matrix is traversed
+             * only once per iteration for all systems. Otherwise, the systems are solved one after another.
+             *
+             * @param d The optimization direction (which is the same for all systems).
+             * @param x The solution vectors x_1, ..., x_k. The initial values represent a guess of the real values to
+             * the solver, but may be ignored.
+             * @param b The vectors to add after matrix-vector multiplication.
+             * @return true iff all systems were solved.
+             */
+            bool solveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+            
             /*!
              * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
              */
@@ -170,6 +190,11 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several vectors b. By default, this solves the systems one after another.
+             */
+            virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
             OptimizationDirectionSetting direction;
@@ -205,6 +230,7 @@ namespace storm {
             
             std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) const;
             std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) const;
+            std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view) const;
             virtual std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(Environment const& env) const = 0;
             
             /*!
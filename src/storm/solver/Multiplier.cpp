@@ -3,14 +3,18 @@
 #include "storm-config.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseSubmatrixView.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
+#include "storm/solver/SimdMultiplier.h"
+#include "storm/solver/SubmatrixViewMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/utility/SignalHandler.h"
@@ -31,12 +35,57 @@ namespace storm {
         
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-            multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
+            multiplyAndReduce(env, dir, this->getRowGroupIndices(), x, b, result, choices);
         }
 
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
+            multiplyAndReduceGaussSeidel(env, dir, this->getRowGroupIndices(), x, b, choices, backwards);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<std::vector<ValueType>> separateX(numberOfVectors);
+            storm::utility::vector::deinterleave(x, separateX);
+            std::vector<std::vector<ValueType>> separateB(b ? numberOfVectors : 0);
+            if (b) {
+                storm::utility::vector::deinterleave(*b, separateB);
+            }
+            std::vector<std::vector<ValueType>> separateResults(numberOfVectors, std::vector<ValueType>(this->getRowCount()));
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                multiply(env, separateX[i], b ? &separateB[i] : nullptr, separateResults[i]);
+            }
+            result = storm::utility::vector::interleave(separateResults);
+        }
+
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            multiplyAndReduceBatch(env, dir, this->getRowGroupIndices(), numberOfVectors, x, b, result);
+        }
+
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<std::vector<ValueType>> separateX(numberOfVectors);
+            storm::utility::vector::deinterleave(x, separateX);
+            std::vector<std::vector<ValueType>> separateB(b ? numberOfVectors : 0);
+            if (b) {
+                storm::utility::vector::deinterleave(*b, separateB);
+            }
+            std::vector<std::vector<ValueType>> separateResults(numberOfVectors, std::vector<ValueType>(rowGroupIndices.size() - 1));
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                multiplyAndReduce(env, dir, rowGroupIndices, separateX[i], b ? &separateB[i] : nullptr, separateResults[i]);
+            }
+            result = storm::utility::vector::interleave(separateResults);
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& Multiplier<ValueType>::getRowGroupIndices() const {
+            return this->matrix.getRowGroupIndices();
+        }
+        
+        template<typename ValueType>
+        uint64_t Multiplier<ValueType>::getRowCount() const {
+            return this->matrix.getRowCount();
         }
     
         template<typename ValueType>
@@ -74,32 +123,53 @@ namespace storm {
             multiplyRow(rowIndex, x2, val2);
         }
         
-        template<typename ValueType>
-        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
-            auto type = env.solver().multiplier().getType();
-            
-            // Adjust the multiplier type if an eqsolver was specified but not a multiplier
-            if (!env.solver().isLinearEquationSolverTypeSetFromDefaultValue() && env.solver().multiplier().isTypeSetFromDefault()) {
-                bool changed = false;
-                if (env.solver().getLinearEquationSolverType() == EquationSolverType::Gmmxx && type != MultiplierType::Gmmxx) {
-                    type = MultiplierType::Gmmxx;
-                    changed = true;
-                } else if (env.solver().getLinearEquationSolverType() == EquationSolverType::Native && type != MultiplierType::Native) {
-                    type = MultiplierType::Native;
-                    changed = true;
+        namespace {
+            /*!
+             * Retrieves the multiplier type requested by the environment (adjusted to the selected equation solver).
+             */
+            MultiplierType getMultiplierType(Environment const& env) {
+                auto type = env.solver().multiplier().getType();
+                
+                // Adjust the multiplier type if an eqsolver was specified but not a multiplier
+                if (!env.solver().isLinearEquationSolverTypeSetFromDefaultValue() && env.solver().multiplier().isTypeSetFromDefault()) {
+                    bool changed = false;
+                    if (env.solver().getLinearEquationSolverType() == EquationSolverType::Gmmxx && type != MultiplierType::Gmmxx) {
+                        type = MultiplierType::Gmmxx;
+                        changed = true;
+                    } else if (env.solver().getLinearEquationSolverType() == EquationSolverType::Native && type != MultiplierType::Native) {
+                        type = MultiplierType::Native;
+                        changed = true;
+                    }
+                    STORM_LOG_INFO_COND(!changed, "Selecting '" + toString(type) + "' as the multiplier type to match the selected equation solver. If you want to override this, please explicitly specify a different multiplier type.");
                 }
-                STORM_LOG_INFO_COND(!changed, "Selecting '" + toString(type) + "' as the multiplier type to match the selected equation solver. If you want to override this, please explicitly specify a different multiplier type.");
+                return type;
             }
-            
-            switch (type) {
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
+            switch (getMultiplierType(env)) {
                 case MultiplierType::Gmmxx:
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::Simd:
+                    return std::make_unique<SimdMultiplier<ValueType>>(matrix);
             }
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
         
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& matrix) {
+            auto type = getMultiplierType(env);
+            STORM_LOG_INFO_COND(type == MultiplierType::Native, "Copying the submatrix, because the '" + toString(type) + "' multiplier needs an explicit matrix.");
+            // The multicolor ordering of the native multiplier is computed on an explicit matrix.
+            bool multicolor = type == MultiplierType::Native && env.solver().multiplier().isMulticolorGaussSeidelSet();
+            STORM_LOG_INFO_COND(!multicolor, "Copying the submatrix, because multicolor Gauss-Seidel needs an explicit matrix.");
+            bool materialize = type != MultiplierType::Native || multicolor;
+            return std::make_unique<SubmatrixViewMultiplier<ValueType>>(env, matrix, materialize);
+        }
+        
         template class Multiplier<double>;
         template class MultiplierFactory<double>;
         
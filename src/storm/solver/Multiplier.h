@@ -13,6 +13,9 @@ namespace storm {
     namespace storage {
         template<typename ValueType>
         class SparseMatrix;
+        
+        template<typename ValueType>
+        class SparseSubmatrixView;
     }
     
     namespace solver {
@@ -87,7 +90,36 @@ namespace storm {
              */
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const = 0;
-            
+
+            /*!
+             * Performs the matrix-vector multiplications x_i' = A*x_i + b_i for a batch of k vectors at once. All
+             * vectors are stored interleaved (see storm::utility::vector::interleave), i.e., the j-th entry of the
+             * i-th vector is at position j * k + i. This allows to read every matrix entry only once for all vectors.
+             * The default implementation multiplies the vectors one after another.
+             *
+             * @param numberOfVectors The number k of vectors in the batch.
+             * @param x The interleaved input vectors. The length must be k times the number of columns of A.
+             * @param b If non-null, these interleaved vectors are added after the multiplication. If given, the length
+             * must be k times the number of rows of A.
+             * @param result The target vector into which to write the interleaved results. Can be the same as x.
+             */
+            virtual void multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+            /*!
+             * Performs the multiplications of multiplyBatch and then minimizes/maximizes over the row groups (for every
+             * vector independently) so that each resulting vector has the size of number of row groups of A.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param numberOfVectors The number k of vectors in the batch.
+             * @param x The interleaved input vectors. The length must be k times the number of columns of A.
+             * @param b If non-null, these interleaved vectors are added after the multiplication. If given, the length
+             * must be k times the number of rows of A.
+             * @param result The target vector into which to write the interleaved results. Can be the same as x.
+             */
+            void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            virtual void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -135,6 +167,16 @@ namespace storm {
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const;
             
         protected:
+            /*!
+             * Retrieves the row groups that are used if no row groups are given explicitly.
+             */
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const;
+            
+            /*!
+             * Retrieves the number of rows of the matrix that is multiplied.
+             */
+            virtual uint64_t getRowCount() const;
+            
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
@@ -146,6 +188,13 @@ namespace storm {
             ~MultiplierFactory() = default;
 
             std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix);
+            
+            /*!
+             * Creates a multiplier for the given submatrix view. The native multiplier works directly on the view. The
+             * other multipliers need an explicit matrix, so they operate on a copy of the submatrix.
+             * The view (and its original matrix) must outlive the multiplier.
+             */
+            std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& matrix);
         };
         
     }
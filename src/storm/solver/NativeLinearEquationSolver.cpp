@@ -3,11 +3,17 @@
 #include <limits>
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/storage/SparseSubmatrixView.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
@@ -42,6 +48,7 @@ namespace storm {
             localA.reset();
             this->A = &A;
             clearCache();
+            submatrixView.reset();
         }
 
         template<typename ValueType>
@@ -49,6 +56,34 @@ namespace storm {
             localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
             this->A = localA.get();
             clearCache();
+            submatrixView.reset();
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) {
+            localA.reset();
+            this->A = nullptr;
+            clearCache();
+            submatrixView = std::make_unique<storm::storage::SparseSubmatrixView<ValueType>>(view);
+        }
+        
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& NativeLinearEquationSolver<ValueType>::getMatrix() const {
+            if (!this->A) {
+                STORM_LOG_ASSERT(submatrixView, "No matrix was set.");
+                STORM_LOG_INFO("Copying the submatrix, because the solution method needs an explicit matrix.");
+                localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(submatrixView->toSparseMatrix());
+                this->A = localA.get();
+            }
+            return *this->A;
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> NativeLinearEquationSolver<ValueType>::createMultiplier(Environment const& env) const {
+            if (!this->A && submatrixView) {
+                return storm::solver::MultiplierFactory<ValueType>().create(env, *submatrixView);
+            }
+            return storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
         }
 
         template<typename ValueType>
@@ -69,7 +104,7 @@ namespace storm {
             
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
-                A->performSuccessiveOverRelaxationStep(omega, x, b);
+                this->getMatrix().performSuccessiveOverRelaxationStep(omega, x, b);
                 
                 // Now check if the process already converged within our precision.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
@@ -116,7 +151,7 @@ namespace storm {
             
             // Get a Jacobi decomposition of the matrix A.
             if (!jacobiDecomposition) {
-                jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, *A);
+                jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, this->getMatrix());
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -126,6 +161,15 @@ namespace storm {
             std::vector<ValueType>* currentX = &x;
             std::vector<ValueType>* nextX = this->cachedRowVector.get();
             
+            // If multiple threads are to be used, the pointwise updates are split into blocks of equal size. Within a
+            // task (e.g. when solving the SCCs of a topological solver in parallel), the updates are done sequentially.
+            uint64_t numberOfThreads = storm::utility::ThreadPool::isExecutingTask() ? 1 : storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+            std::vector<uint64_t> blocks;
+            if (numberOfThreads > 1) {
+                blocks = storm::utility::computeBalancedBlocks(x.size(), numberOfThreads, [] (uint64_t) { return 0; });
+            }
+            std::vector<ValueType> const& dVector = jacobiDecomposition->DVector;
+            
             // Set up additional environment variables.
             uint_fast64_t iterations = 0;
             SolverStatus status = SolverStatus::InProgress;
@@ -134,8 +178,17 @@ namespace storm {
             while (status == SolverStatus::InProgress && iterations < maxIter) {
                 // Compute D^-1 * (b - LU * x) and store result in nextX.
                 jacobiDecomposition->multiplier->multiply(env, *currentX, nullptr, *nextX);
-                storm::utility::vector::subtractVectors(b, *nextX, *nextX);
-                storm::utility::vector::multiplyVectorsPointwise(jacobiDecomposition->DVector, *nextX, *nextX);
+                if (blocks.size() > 2) {
+                    std::vector<ValueType>& target = *nextX;
+                    storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                        for (uint64_t row = blocks[block], end = blocks[block + 1]; row < end; ++row) {
+                            target[row] = dVector[row] * (b[row] - target[row]);
+                        }
+                    });
+                } else {
+                    storm::utility::vector::subtractVectors(b, *nextX, *nextX);
+                    storm::utility::vector::multiplyVectorsPointwise(dVector, *nextX, *nextX);
+                }
                 
                 // Now check if the process already converged within our precision.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, precision, relative)) {
@@ -232,7 +285,7 @@ namespace storm {
             
             // (1) Compute an equivalent equation system that has only non-negative coefficients.
             if (!walkerChaeData) {
-                walkerChaeData = std::make_unique<WalkerChaeData>(env, *this->A, b);
+                walkerChaeData = std::make_unique<WalkerChaeData>(env, this->getMatrix(), b);
             }
 
             // (2) Enlarge the vectors x and b to account for additional variables.
@@ -295,7 +348,7 @@ namespace storm {
             }
 
             // Resize the solution to the right size.
-            x.resize(this->A->getRowCount());
+            x.resize(this->getMatrixRowCount());
             
             // Finalize solution vector.
             storm::utility::vector::applyPointwise(x, x, [this] (ValueType const& value) -> ValueType { return value - walkerChaeData->t; } );
@@ -351,7 +404,7 @@ namespace storm {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = this->createMultiplier(env);
             }
             std::vector<ValueType>* currentX = &x;
             SolverGuarantee guarantee = SolverGuarantee::None;
@@ -385,6 +438,49 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsPowerBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t numberOfVectors = x.size();
+            STORM_LOG_INFO("Solving " << numberOfVectors << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (Power, batched)");
+            
+            if (!this->multiplier) {
+                this->multiplier = this->createMultiplier(env);
+            }
+            std::vector<ValueType> currentX = storm::utility::vector::interleave(x);
+            std::vector<ValueType> newX(currentX.size());
+            std::vector<ValueType> interleavedB = storm::utility::vector::interleave(b);
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t maxIterations = env.solver().native().getMaximalNumberOfIterations();
+            
+            this->startMeasureProgress();
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress && iterations < maxIterations) {
+                this->multiplier->multiplyBatch(env, numberOfVectors, currentX, &interleavedB, newX);
+                
+                // The convergence criterion is checked entry-wise, so it holds for the interleaved vectors iff it holds for all systems.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                status = this->updateStatus(status, false, iterations, maxIterations);
+                this->showProgressIterative(iterations);
+            }
+            storm::utility::vector::deinterleave(currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, iterations);
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -428,7 +524,7 @@ namespace storm {
             }
             
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = this->createMultiplier(env);
             }
 
             SolverStatus status = SolverStatus::InProgress;
@@ -578,16 +674,28 @@ namespace storm {
         }
         
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsMulticolorGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            // This is the power method with Gauss-Seidel multiplications in which the native multiplier updates the
+            // states of one color in parallel. As this is still a Gauss-Seidel scheme (only with a different order
+            // of the states), the values approach the solution monotonically if the initial values are bounds.
+            Environment multicolorEnv = env;
+            multicolorEnv.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+            multicolorEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            multicolorEnv.solver().multiplier().setMulticolorGaussSeidel(true);
+            return solveEquationsPower(multicolorEnv, x, b);
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             // Prepare the solution vectors and the helper.
-            assert(x.size() == this->A->getRowCount());
+            assert(x.size() == this->getMatrixRowCount());
             if (!this->cachedRowVector) {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(this->getMatrix(), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
             } else {
                 this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
             }
@@ -638,14 +746,14 @@ namespace storm {
         bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplier = this->createMultiplier(env);
             }
 
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowCount());
             }
             if (!this->cachedRowVector2) {
-                this->cachedRowVector2 = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector2 = std::make_unique<std::vector<ValueType>>(this->getMatrixRowCount());
             }
 
             // By default, we can not provide any guarantee
@@ -808,19 +916,19 @@ namespace storm {
             // Version for when the overall value type is imprecise.
             
             // Create a rational representation of the input so we can check for a proper solution later.
-            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->A->template toValueType<storm::RationalNumber>();
+            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->getMatrix().template toValueType<storm::RationalNumber>();
             std::vector<storm::RationalNumber> rationalX(x.size());
             std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
                         
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = this->createMultiplier(env);
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, *this, rationalA, rationalX, rationalB, *this->A, x, b, *this->cachedRowVector);
+            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, *this, rationalA, rationalX, rationalB, this->getMatrix(), x, b, *this->cachedRowVector);
             
             // Translate back rational result to imprecise result.
             auto targetIt = x.begin();
@@ -841,14 +949,14 @@ namespace storm {
             // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
             
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrixRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = this->createMultiplier(env);
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, *this, *this->A, x, b, *this->A, *this->cachedRowVector, b, x);
+            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, *this, this->getMatrix(), x, b, this->getMatrix(), *this->cachedRowVector, b, x);
             
             if (!this->isCachingEnabled()) {
                 this->clearCache();
@@ -864,7 +972,7 @@ namespace storm {
             // problem using the imprecise data type and fall back to the exact type as needed.
             
             // Translate A to its imprecise version.
-            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->A->template toValueType<ImpreciseType>();
+            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->getMatrix().template toValueType<ImpreciseType>();
             
             // Translate x to its imprecise version.
             std::vector<ImpreciseType> impreciseX(x.size());
@@ -896,16 +1004,16 @@ namespace storm {
             bool converged = false;
             try {
                 // Forward the call to the core rational search routine.
-                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, impreciseSolver, *this->A, x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
+                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, impreciseSolver, this->getMatrix(), x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
                 impreciseSolver.clearCache();
             } catch (storm::exceptions::PrecisionExceededException const& e) {
                 STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
                 
                 if (!this->cachedRowVector) {
-                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
                 }
                 if (!this->multiplier) {
-                    this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                    this->multiplier = this->createMultiplier(env);
                 }
                 // Translate the imprecise value iteration result to the one we are going to use from now on.
                 auto targetIt = this->cachedRowVector->begin();
@@ -920,7 +1028,7 @@ namespace storm {
                 impreciseA = storm::storage::SparseMatrix<ImpreciseType>();
                 
                 // Forward the call to the core rational search routine, but now with our value type as the imprecise value type.
-                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, *this, *this->A, x, b, *this->A, *this->cachedRowVector, b, x);
+                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, *this, this->getMatrix(), x, b, this->getMatrix(), *this->cachedRowVector, b, x);
             }
             
             if (!this->isCachingEnabled()) {
@@ -1018,15 +1126,28 @@ namespace storm {
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return this->solveEquationsRationalSearch(env, x, b);
+                case NativeLinearEquationSolverMethod::MulticolorGaussSeidel:
+                    return this->solveEquationsMulticolorGaussSeidel(env, x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only the plain power method is batched. Gauss-Seidel style multiplications would have to update the
+            // vectors row by row and custom termination conditions refer to a single vector.
+            bool isPower = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == NativeLinearEquationSolverMethod::Power;
+            if (isPower && env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular && !this->hasCustomTerminationCondition()) {
+                return this->solveEquationsPowerBatch(env, x, b);
+            }
+            return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, x, b);
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
-            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration) {
+            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::MulticolorGaussSeidel || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration) {
                 return LinearEquationSolverProblemFormat::FixedPointSystem;
             } else {
                 return LinearEquationSolverProblemFormat::EquationSystem;
@@ -1059,12 +1180,12 @@ namespace storm {
         
         template<typename ValueType>
         uint64_t NativeLinearEquationSolver<ValueType>::getMatrixRowCount() const {
-            return this->A->getRowCount();
+            return this->A ? this->A->getRowCount() : submatrixView->getRowCount();
         }
         
         template<typename ValueType>
         uint64_t NativeLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
-            return this->A->getColumnCount();
+            return this->A ? this->A->getColumnCount() : submatrixView->getColumnCount();
         }
         
         template<typename ValueType>
@@ -10,6 +10,8 @@
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 
+#include "storm/storage/SparseSubmatrixView.h"
+
 #include "storm/utility/NumberTraits.h"
 
 namespace storm {
@@ -31,6 +33,12 @@ namespace storm {
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
             
+            /*!
+             * Sets the matrix to the given submatrix view. The methods that only multiply with the matrix (e.g. the
+             * power method) operate on the view. The other methods copy the submatrix upon their first invocation.
+             */
+            virtual void setMatrix(storm::storage::SparseSubmatrixView<ValueType> const& view) override;
+            
             virtual LinearEquationSolverProblemFormat getEquationProblemFormat(storm::Environment const& env) const override;
             virtual LinearEquationSolverRequirements getRequirements(Environment const& env) const override;
 
@@ -38,6 +46,7 @@ namespace storm {
 
         protected:
             virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsBatch(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
             
         private:
             struct PowerIterationResult {
@@ -56,6 +65,17 @@ namespace storm {
             
             void logIterations(bool converged, bool terminate, uint64_t iterations) const;
             
+            /*!
+             * Retrieves the matrix of the equation system. If the matrix was given as a view, the submatrix is copied
+             * upon the first invocation.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+            
+            /*!
+             * Creates a multiplier for the matrix, which operates on the view unless the submatrix was already copied.
+             */
+            std::unique_ptr<Multiplier<ValueType>> createMultiplier(Environment const& env) const;
+            
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
 
@@ -65,10 +85,17 @@ namespace storm {
             virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsPower(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Performs the power method for several right-hand sides at once. The vectors are stored interleaved, so
+             * that each iteration traverses the matrix only once for all systems.
+             */
+            bool solveEquationsPowerBatch(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
             virtual bool solveEquationsSoundValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsMulticolorGaussSeidel(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -83,12 +110,15 @@ namespace storm {
             static bool isSolution(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b);
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
-            // when the solver is destructed.
-            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            // when the solver is destructed. This also holds the copy of a submatrix view (if any).
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-            // the pointer refers to localA.
-            storm::storage::SparseMatrix<ValueType> const* A;
+            // the pointer refers to localA. If the matrix is given as a view, this is null until the view is copied.
+            mutable storm::storage::SparseMatrix<ValueType> const* A;
+            
+            // The view on the submatrix (if the matrix was given as a view).
+            std::unique_ptr<storm::storage::SparseSubmatrixView<ValueType>> submatrixView;
             
             // An object to dispatch all multiplication operations.
             mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
@@ -7,21 +7,85 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/IntelTbbAdapter.h"
 
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace solver {
         
+        namespace {
+            // Using more blocks than threads allows idle threads to take over work from busy ones.
+            uint64_t const blocksPerThread = 4;
+            
+            // Smaller blocks are not worth the synchronization overhead.
+            uint64_t const minimalEntriesPerBlock = 4096;
+            
+            uint64_t getNumberOfBlocks(uint64_t numberOfThreads, uint64_t numberOfEntries) {
+                return std::min(numberOfThreads * blocksPerThread, std::max<uint64_t>(1, numberOfEntries / minimalEntriesPerBlock));
+            }
+            
+            /*!
+             * Multiplies the given row with a batch of interleaved vectors and writes the results for all vectors to
+             * the range starting at the given target.
+             */
+            template<typename ValueType, typename Iterator>
+            void multiplyRowWithBatch(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t row, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, Iterator target) {
+                Iterator targetEnd = target + numberOfVectors;
+                if (b) {
+                    std::copy(b->begin() + row * numberOfVectors, b->begin() + (row + 1) * numberOfVectors, target);
+                } else {
+                    std::fill(target, targetEnd, storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : matrix.getRow(row)) {
+                    auto xIt = x.begin() + entry.getColumn() * numberOfVectors;
+                    for (Iterator targetIt = target; targetIt != targetEnd; ++targetIt, ++xIt) {
+                        *targetIt += entry.getValue() * *xIt;
+                    }
+                }
+            }
+        }
+        
         template<typename ValueType>
-        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), compactMatrixUnavailable(false) {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        NativeMultiplier<ValueType>::~NativeMultiplier() {
+            // Intentionally left empty (but required here, because the compact matrix is an incomplete type in the header).
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            compactMatrix.reset();
+            compactMatrixUnavailable = false;
+            multicolorOrdering.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        storm::storage::CompactSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getCompactMatrix(Environment const& env) const {
+            if (!compactMatrix && !compactMatrixUnavailable && env.solver().multiplier().isCompactStorageSet()) {
+                if (storm::storage::CompactSparseMatrix<ValueType>::isRepresentable(this->matrix)) {
+                    compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix);
+                } else {
+                    STORM_LOG_WARN("The matrix has too many columns for the compact storage. Falling back to the default storage.");
+                    compactMatrixUnavailable = true;
+                }
+            }
+            return compactMatrix.get();
+        }
+        
         template<typename ValueType>
         bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
@@ -31,6 +95,20 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType>
+        uint64_t NativeMultiplier<ValueType>::getNumberOfThreads() const {
+            // If the multiplier is used within a task (e.g. when solving the SCCs of a topological solver in
+            // parallel), the threads are already busy, so we multiply sequentially.
+            if (storm::utility::ThreadPool::isExecutingTask()) {
+                return 1;
+            }
+            // Without the core settings (e.g. when storm is used as a library), we multiply sequentially.
+            if (!storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+                return 1;
+            }
+            return storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             std::vector<ValueType>* target = &result;
@@ -42,8 +120,13 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
+            uint64_t numberOfThreads = getNumberOfThreads();
             if (parallelize(env)) {
                 multAddParallel(x, b, *target);
+            } else if (numberOfThreads > 1) {
+                multAddThreadPool(numberOfThreads, getCompactMatrix(env), x, b, *target);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyWithVector(x, *target, b);
             } else {
                 multAdd(x, b, *target);
             }
@@ -54,7 +137,28 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
-            if (backwards) {
+            if (env.solver().multiplier().isMulticolorGaussSeidelSet()) {
+                storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+                storm::storage::CompactSparseMatrix<ValueType> const* compact = getCompactMatrix(env);
+                MulticolorOrdering const& ordering = getMulticolorOrdering(matrix.getRowGroupIndices());
+                std::vector<uint64_t> const& states = ordering.states;
+                multiplyGaussSeidelMulticolor(ordering, backwards, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t index = first; index < end; ++index) {
+                        uint64_t state = states[index];
+                        ValueType value = compact ? compact->multiplyRowWithVector(state, x) : matrix.multiplyRowWithVector(state, x);
+                        if (b) {
+                            value += (*b)[state];
+                        }
+                        x[state] = std::move(value);
+                    }
+                });
+            } else if (auto compact = getCompactMatrix(env)) {
+                if (backwards) {
+                    compact->multiplyWithVectorBackward(x, x, b);
+                } else {
+                    compact->multiplyWithVectorForward(x, x, b);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyWithVectorBackward(x, x, b);
             } else {
                 this->matrix.multiplyWithVectorForward(x, x, b);
@@ -72,8 +176,13 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
+            uint64_t numberOfThreads = getNumberOfThreads();
             if (parallelize(env)) {
                 multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (numberOfThreads > 1) {
+                multAddReduceThreadPool(numberOfThreads, getCompactMatrix(env), dir, rowGroupIndices, x, b, *target, choices);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -84,15 +193,103 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            if (backwards) {
+            if (env.solver().multiplier().isMulticolorGaussSeidelSet()) {
+                storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+                storm::storage::CompactSparseMatrix<ValueType> const* compact = getCompactMatrix(env);
+                MulticolorOrdering const& ordering = getMulticolorOrdering(rowGroupIndices);
+                std::vector<uint64_t> const& states = ordering.states;
+                multiplyGaussSeidelMulticolor(ordering, backwards, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t index = first; index < end; ++index) {
+                        if (compact) {
+                            compact->multiplyAndReduceRange(dir, rowGroupIndices, states[index], states[index] + 1, x, b, x, choices);
+                        } else {
+                            matrix.multiplyAndReduceRange(dir, rowGroupIndices, states[index], states[index] + 1, x, b, x, choices);
+                        }
+                    }
+                });
+            } else if (auto compact = getCompactMatrix(env)) {
+                if (backwards) {
+                    compact->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+                } else {
+                    compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
             } else {
                 this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
             }
         }
         
+        template<typename ValueType>
+        typename NativeMultiplier<ValueType>::MulticolorOrdering const& NativeMultiplier<ValueType>::getMulticolorOrdering(std::vector<uint64_t> const& rowGroupIndices) const {
+            // The ordering depends on the row groups, which may be different from the ones of the matrix (and thus from
+            // the ones of a previous call) even if their number is the same.
+            if (!multicolorOrdering || multicolorOrdering->rowGroupIndices != rowGroupIndices) {
+                std::vector<uint64_t> colors = storm::utility::graph::getGreedyColoring(this->matrix, rowGroupIndices);
+                uint64_t numberOfStates = colors.size();
+                
+                // Sort the states by their color (and by their index within a color).
+                multicolorOrdering = std::make_unique<MulticolorOrdering>();
+                multicolorOrdering->rowGroupIndices = rowGroupIndices;
+                std::vector<uint64_t>& colorIndications = multicolorOrdering->colorIndications;
+                for (auto const& color : colors) {
+                    if (color + 2 > colorIndications.size()) {
+                        colorIndications.resize(color + 2, 0);
+                    }
+                    ++colorIndications[color + 1];
+                }
+                if (colorIndications.empty()) {
+                    colorIndications.push_back(0);
+                }
+                for (uint64_t color = 1; color < colorIndications.size(); ++color) {
+                    colorIndications[color] += colorIndications[color - 1];
+                }
+                std::vector<uint64_t> insertPositions(colorIndications.begin(), colorIndications.end() - 1);
+                multicolorOrdering->states.resize(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    multicolorOrdering->states[insertPositions[colors[state]]++] = state;
+                }
+                
+                multicolorOrdering->entryOffsets.reserve(numberOfStates + 1);
+                multicolorOrdering->entryOffsets.push_back(0);
+                for (auto const& state : multicolorOrdering->states) {
+                    uint64_t numberOfEntries = this->matrix.begin(rowGroupIndices[state + 1]) - this->matrix.begin(rowGroupIndices[state]);
+                    multicolorOrdering->entryOffsets.push_back(multicolorOrdering->entryOffsets.back() + numberOfEntries);
+                }
+                STORM_LOG_INFO("Multicolor Gauss-Seidel uses " << colorIndications.size() - 1 << " colors for " << numberOfStates << " states.");
+            }
+            return *multicolorOrdering;
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyGaussSeidelMulticolor(MulticolorOrdering const& ordering, bool backwards, std::function<void(uint64_t first, uint64_t end)> const& updateStates) const {
+            uint64_t numberOfThreads = getNumberOfThreads();
+            uint64_t numberOfColors = ordering.colorIndications.size() - 1;
+            for (uint64_t step = 0; step < numberOfColors; ++step) {
+                uint64_t color = backwards ? numberOfColors - 1 - step : step;
+                uint64_t first = ordering.colorIndications[color];
+                uint64_t end = ordering.colorIndications[color + 1];
+                if (numberOfThreads == 1) {
+                    updateStates(first, end);
+                    continue;
+                }
+                
+                uint64_t numberOfBlocks = getNumberOfBlocks(numberOfThreads, ordering.entryOffsets[end] - ordering.entryOffsets[first]);
+                std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(end - first, numberOfBlocks, [&ordering, &first] (uint64_t index) { return ordering.entryOffsets[first + index]; });
+                storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                    updateStates(first + blocks[block], first + blocks[block + 1]);
+                });
+            }
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            if (compactMatrix) {
+                for (auto const& entry : compactMatrix->getRow(rowIndex)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+                return;
+            }
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
                 value += entry.getValue() * x[entry.getColumn()];
             }
@@ -100,6 +297,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
+            if (compactMatrix) {
+                for (auto const& entry : compactMatrix->getRow(rowIndex)) {
+                    val1 += entry.getValue() * x1[entry.getColumn()];
+                    val2 += entry.getValue() * x2[entry.getColumn()];
+                }
+                return;
+            }
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
                 val1 += entry.getValue() * x1[entry.getColumn()];
                 val2 += entry.getValue() * x2[entry.getColumn()];
@@ -136,6 +340,142 @@ namespace storm {
 #endif
         }
 
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddThreadPool(uint64_t numberOfThreads, storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            // The compact matrix has the same structure, so the blocks can be computed on the original matrix.
+            storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+            std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(matrix.getRowCount(), getNumberOfBlocks(numberOfThreads, matrix.getEntryCount()), [&matrix] (uint64_t row) { return static_cast<uint64_t>(matrix.begin(row) - matrix.begin()); });
+            storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                if (compact) {
+                    compact->multiplyWithVectorRange(blocks[block], blocks[block + 1], x, result, b);
+                } else {
+                    matrix.multiplyWithVectorRange(blocks[block], blocks[block + 1], x, result, b);
+                }
+            });
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceThreadPool(uint64_t numberOfThreads, storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+            std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(rowGroupIndices.size() - 1, getNumberOfBlocks(numberOfThreads, matrix.getEntryCount()), [&matrix, &rowGroupIndices] (uint64_t group) { return static_cast<uint64_t>(matrix.begin(rowGroupIndices[group]) - matrix.begin()); });
+            storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                if (compact) {
+                    compact->multiplyAndReduceRange(dir, rowGroupIndices, blocks[block], blocks[block + 1], x, b, result, choices);
+                } else {
+                    matrix.multiplyAndReduceRange(dir, rowGroupIndices, blocks[block], blocks[block + 1], x, b, result, choices);
+                }
+            });
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+            uint64_t resultSize = matrix.getRowCount() * numberOfVectors;
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(resultSize);
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(resultSize);
+                }
+                target = this->cachedVector.get();
+            } else {
+                result.resize(resultSize);
+            }
+            uint64_t numberOfThreads = getNumberOfThreads();
+            if (numberOfThreads > 1) {
+                std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(matrix.getRowCount(), getNumberOfBlocks(numberOfThreads, matrix.getEntryCount() * numberOfVectors), [&matrix] (uint64_t row) { return static_cast<uint64_t>(matrix.begin(row) - matrix.begin()); });
+                storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                    multAddBatchRange(blocks[block], blocks[block + 1], numberOfVectors, x, b, *target);
+                });
+            } else {
+                multAddBatchRange(0, matrix.getRowCount(), numberOfVectors, x, b, *target);
+            }
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            storm::storage::SparseMatrix<ValueType> const& matrix = this->matrix;
+            uint64_t numberOfRowGroups = rowGroupIndices.size() - 1;
+            uint64_t resultSize = numberOfRowGroups * numberOfVectors;
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(resultSize);
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(resultSize);
+                }
+                target = this->cachedVector.get();
+            } else {
+                result.resize(resultSize);
+            }
+            uint64_t numberOfThreads = getNumberOfThreads();
+            if (numberOfThreads > 1) {
+                std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(numberOfRowGroups, getNumberOfBlocks(numberOfThreads, matrix.getEntryCount() * numberOfVectors), [&matrix, &rowGroupIndices] (uint64_t group) { return static_cast<uint64_t>(matrix.begin(rowGroupIndices[group]) - matrix.begin()); });
+                storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(blocks.size() - 1, [&] (uint64_t block) {
+                    multAddReduceBatchRange(dir, rowGroupIndices, blocks[block], blocks[block + 1], numberOfVectors, x, b, *target);
+                });
+            } else {
+                multAddReduceBatchRange(dir, rowGroupIndices, 0, numberOfRowGroups, numberOfVectors, x, b, *target);
+            }
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddBatchRange(uint64_t startRow, uint64_t endRow, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            for (uint64_t row = startRow; row < endRow; ++row) {
+                multiplyRowWithBatch(this->matrix, row, numberOfVectors, x, b, result.begin() + row * numberOfVectors);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceBatchRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multAddReduceBatchRange<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, numberOfVectors, x, b, result);
+            } else {
+                multAddReduceBatchRange<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, numberOfVectors, x, b, result);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void NativeMultiplier<ValueType>::multAddReduceBatchRange(std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            Compare compare;
+            std::vector<ValueType> rowValues(numberOfVectors);
+            for (uint64_t group = startRowGroup; group < endRowGroup; ++group) {
+                auto groupResult = result.begin() + group * numberOfVectors;
+                uint64_t row = rowGroupIndices[group];
+                uint64_t groupEnd = rowGroupIndices[group + 1];
+                if (row == groupEnd) {
+                    std::fill(groupResult, groupResult + numberOfVectors, storm::utility::zero<ValueType>());
+                    continue;
+                }
+                
+                // The first row initializes the values of the group, the remaining rows replace values that are better.
+                multiplyRowWithBatch(this->matrix, row, numberOfVectors, x, b, groupResult);
+                for (++row; row < groupEnd; ++row) {
+                    multiplyRowWithBatch(this->matrix, row, numberOfVectors, x, b, rowValues.begin());
+                    for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                        if (compare(rowValues[i], groupResult[i])) {
+                            groupResult[i] = std::move(rowValues[i]);
+                        }
+                    }
+                }
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multAddReduceBatchRange(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, uint64_t, uint64_t, uint64_t, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
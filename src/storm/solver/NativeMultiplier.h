@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
@@ -8,6 +12,9 @@ namespace storm {
     namespace storage {
         template<typename ValueType>
         class SparseMatrix;
+        
+        template<typename ValueType>
+        class CompactSparseMatrix;
     }
     
     namespace solver {
@@ -16,7 +23,7 @@ namespace storm {
         class NativeMultiplier : public Multiplier<ValueType> {
         public:
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-            virtual ~NativeMultiplier() = default;
+            virtual ~NativeMultiplier();
             
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
@@ -24,10 +31,27 @@ namespace storm {
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void clearCache() const override;
 
         private:
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves the number of threads that are to be used by the built-in thread pool.
+             */
+            uint64_t getNumberOfThreads() const;
+            
+            /*!
+             * Retrieves the compact copy of the matrix if the environment asks for it and the matrix can be stored in
+             * the compact format. The copy is created upon the first request and kept in addition to the matrix, so it
+             * reduces the memory traffic of the multiplications at the cost of additional memory.
+             *
+             * @return The compact matrix or nullptr if the original matrix is to be used.
+             */
+            storm::storage::CompactSparseMatrix<ValueType> const* getCompactMatrix(Environment const& env) const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
@@ -35,6 +59,69 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            /*!
+             * Variants of multAdd and multAddReduce that distribute blocks of rows (row groups) with roughly the same
+             * number of entries among the threads of the built-in thread pool. If a compact matrix is given, it is
+             * used instead of the original one.
+             */
+            void multAddThreadPool(uint64_t numberOfThreads, storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduceThreadPool(uint64_t numberOfThreads, storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+            /*!
+             * Multiplies the rows startRow, ..., endRow - 1 with a batch of interleaved vectors (see multiplyBatch).
+             * Every matrix entry is read once and applied to all vectors of the batch.
+             */
+            void multAddBatchRange(uint64_t startRow, uint64_t endRow, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
+            /*!
+             * Multiplies the row groups startRowGroup, ..., endRowGroup - 1 with a batch of interleaved vectors and
+             * reduces every vector over the rows of each group (see multiplyAndReduceBatch).
+             */
+            void multAddReduceBatchRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
+            template<typename Compare>
+            void multAddReduceBatchRange(std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
+            struct MulticolorOrdering {
+                // The row groups for which the ordering was computed.
+                std::vector<uint64_t> rowGroupIndices;
+                
+                // The states sorted by their color.
+                std::vector<uint64_t> states;
+                
+                // The i-th color consists of the states states[colorIndications[i]], ..., states[colorIndications[i + 1] - 1].
+                std::vector<uint64_t> colorIndications;
+                
+                // The accumulated number of entries of the states in the order given above.
+                std::vector<uint64_t> entryOffsets;
+            };
+            
+            /*!
+             * Retrieves an ordering of the row groups such that row groups of the same color do not read the values of
+             * each other. The ordering is created upon the first request and recomputed if it is requested for other
+             * row groups. As the multiplier refers to the matrix, clearCache has to be called if the matrix changes.
+             */
+            MulticolorOrdering const& getMulticolorOrdering(std::vector<uint64_t> const& rowGroupIndices) const;
+            
+            /*!
+             * Performs a Gauss-Seidel step in which the row groups are processed color by color according to the
+             * multicolor ordering (see getMulticolorOrdering). As the row groups of the same color do not depend on
+             * each other, they are distributed among the threads of the built-in thread pool. The result only depends
+             * on the ordering and not on the number of threads.
+             *
+             * @param updateStates A function that updates the states with the given indices in the ordering, i.e.,
+             * the states ordering.states[first], ..., ordering.states[end - 1].
+             */
+            void multiplyGaussSeidelMulticolor(MulticolorOrdering const& ordering, bool backwards, std::function<void(uint64_t first, uint64_t end)> const& updateStates) const;
+            
+            // A copy of the matrix in the compact format (if requested).
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactMatrix;
+            
+            // A flag indicating that the matrix was found to be not representable in the compact format.
+            mutable bool compactMatrixUnavailable;
+            
+            // The ordering used for multicolor Gauss-Seidel (if requested).
+            mutable std::unique_ptr<MulticolorOrdering> multicolorOrdering;
         };
         
     }
@@ -0,0 +1,252 @@
+#include "storm/solver/SimdMultiplier.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), compactMatrixUnavailable(false), instructionSet(storm::utility::simd::InstructionSet::Scalar) {
+            if (std::is_same<ValueType, double>::value) {
+                if (storm::utility::simd::isColumnCountSupported(matrix.getColumnCount())) {
+                    instructionSet = storm::utility::simd::getSupportedInstructionSet();
+                } else {
+                    STORM_LOG_WARN("The matrix has too many columns for the vectorized kernels. Falling back to the scalar kernel.");
+                }
+                STORM_LOG_INFO("Using the " << storm::utility::simd::toString(instructionSet) << " kernel for matrix-vector multiplications.");
+            } else {
+                STORM_LOG_INFO("Vectorized kernels are only available for double values. Using the scalar kernel for matrix-vector multiplications.");
+            }
+        }
+
+        template<typename ValueType>
+        SimdMultiplier<ValueType>::~SimdMultiplier() {
+            // Intentionally left empty (but required here, because the compact matrix is an incomplete type in the header).
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::clearCache() const {
+            compactMatrix.reset();
+            compactMatrixUnavailable = false;
+            rowValues = std::vector<ValueType>();
+            Multiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        storm::utility::simd::InstructionSet const& SimdMultiplier<ValueType>::getInstructionSet() const {
+            return instructionSet;
+        }
+
+        template<typename ValueType>
+        storm::storage::CompactSparseMatrix<ValueType> const* SimdMultiplier<ValueType>::initialize() const {
+            if (!compactMatrix && !compactMatrixUnavailable) {
+                if (storm::storage::CompactSparseMatrix<ValueType>::isRepresentable(this->matrix)) {
+                    compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix);
+                } else {
+                    STORM_LOG_WARN("The matrix has too many columns for the compact storage. Falling back to the default storage.");
+                    compactMatrixUnavailable = true;
+                }
+            }
+            return compactMatrix.get();
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRows(ValueType const* x, ValueType const* b, ValueType* result, uint64_t firstRow, uint64_t endRow, bool backwards) const {
+            auto const& rowIndications = compactMatrix->getRowIndications();
+            auto const& columns = compactMatrix->getColumns();
+            auto const& values = compactMatrix->getValues();
+            for (uint64_t i = firstRow; i < endRow; ++i) {
+                uint64_t row = backwards ? endRow - 1 - (i - firstRow) : i;
+                ValueType value = b ? b[row] : storm::utility::zero<ValueType>();
+                for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                    value += values[entry] * x[columns[entry]];
+                }
+                result[row - firstRow] = std::move(value);
+            }
+        }
+
+        template<>
+        void SimdMultiplier<double>::multiplyRows(double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards) const {
+            storm::utility::simd::multiplyRows(instructionSet, compactMatrix->getRowIndications().data(), compactMatrix->getColumns().data(), compactMatrix->getValues().data(), x, b, result, firstRow, endRow, backwards);
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (!initialize()) {
+                this->matrix.multiplyWithVector(x, result, b);
+                return;
+            }
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            multiplyRows(x.data(), b ? b->data() : nullptr, target->data(), 0, this->matrix.getRowCount(), false);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            if (initialize()) {
+                // The kernels finish each row before writing its result, so x can be updated in place.
+                multiplyRows(x.data(), b ? b->data() : nullptr, x.data(), 0, this->matrix.getRowCount(), backwards);
+            } else if (backwards) {
+                this->matrix.multiplyWithVectorBackward(x, x, b);
+            } else {
+                this->matrix.multiplyWithVectorForward(x, x, b);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (!initialize()) {
+                this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            } else if (dir == storm::OptimizationDirection::Minimize) {
+                multAddReduce<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, result, choices);
+            } else {
+                multAddReduce<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            if (!initialize()) {
+                if (backwards) {
+                    this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+                } else {
+                    this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+                }
+            } else if (dir == storm::OptimizationDirection::Minimize) {
+                multAddReduceGaussSeidel<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+            } else {
+                multAddReduceGaussSeidel<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+            }
+        }
+
+        namespace {
+            /*!
+             * Reduces the values of the rows of one row group. The choice is only updated if the new value is strictly
+             * better than the value of the previously selected row. Ties are resolved towards the row that is
+             * processed first (the first row of the group in forward and the last row in backward direction).
+             */
+            template<typename ValueType, typename Compare>
+            void reduceRowGroup(ValueType const* rowValues, uint64_t groupSize, ValueType& target, uint_fast64_t* choice, bool backwards) {
+                Compare compare;
+                uint64_t selectedChoice = backwards ? groupSize - 1 : 0;
+                ValueType const* bestValue = rowValues + selectedChoice;
+                if (backwards) {
+                    for (uint64_t i = groupSize - 1; i > 0;) {
+                        --i;
+                        if (compare(rowValues[i], *bestValue)) {
+                            bestValue = rowValues + i;
+                            selectedChoice = i;
+                        }
+                    }
+                } else {
+                    for (uint64_t i = 1; i < groupSize; ++i) {
+                        if (compare(rowValues[i], *bestValue)) {
+                            bestValue = rowValues + i;
+                            selectedChoice = i;
+                        }
+                    }
+                }
+                if (choice && compare(*bestValue, rowValues[*choice])) {
+                    *choice = selectedChoice;
+                }
+                target = *bestValue;
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void SimdMultiplier<ValueType>::multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            // Multiply all rows at once, so that the kernel runs without interruption. Since x is not read after
+            // this point, result may be the same vector as x.
+            uint64_t rowCount = rowGroupIndices.back();
+            rowValues.resize(rowCount);
+            multiplyRows(x.data(), b ? b->data() : nullptr, rowValues.data(), 0, rowCount, false);
+
+            for (uint64_t group = 0, groupCount = rowGroupIndices.size() - 1; group < groupCount; ++group) {
+                uint64_t groupStart = rowGroupIndices[group];
+                uint64_t groupSize = rowGroupIndices[group + 1] - groupStart;
+                if (groupSize > 0) {
+                    reduceRowGroup<ValueType, Compare>(rowValues.data() + groupStart, groupSize, result[group], choices ? &(*choices)[group] : nullptr, false);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void SimdMultiplier<ValueType>::multAddReduceGaussSeidel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+            uint64_t groupCount = rowGroupIndices.size() - 1;
+            uint64_t maxGroupSize = 0;
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                maxGroupSize = std::max<uint64_t>(maxGroupSize, rowGroupIndices[group + 1] - rowGroupIndices[group]);
+            }
+            rowValues.resize(maxGroupSize);
+
+            for (uint64_t i = 0; i < groupCount; ++i) {
+                uint64_t group = backwards ? groupCount - 1 - i : i;
+                uint64_t groupStart = rowGroupIndices[group];
+                uint64_t groupEnd = rowGroupIndices[group + 1];
+                if (groupStart < groupEnd) {
+                    multiplyRows(x.data(), b ? b->data() : nullptr, rowValues.data(), groupStart, groupEnd, backwards);
+                    reduceRowGroup<ValueType, Compare>(rowValues.data(), groupEnd - groupStart, x[group], choices ? &(*choices)[group] : nullptr, backwards);
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        template<typename Compare>
+        void SimdMultiplier<storm::RationalFunction>::multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& x, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported for this data type.");
+        }
+
+        template<>
+        template<typename Compare>
+        void SimdMultiplier<storm::RationalFunction>::multAddReduceGaussSeidel(std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported for this data type.");
+        }
+#endif
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            if (initialize()) {
+                for (auto const& entry : compactMatrix->getRow(rowIndex)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+            } else {
+                for (auto const& entry : this->matrix.getRow(rowIndex)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+            }
+        }
+
+        template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class SimdMultiplier<storm::RationalNumber>;
+        template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
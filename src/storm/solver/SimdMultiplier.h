@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        template<typename ValueType>
+        class CompactSparseMatrix;
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier that operates on a compact copy of the matrix (32-bit column indices kept apart from the
+         * values). For double values, the rows are multiplied with gather-based AVX2 or AVX-512 kernels, depending
+         * on what the processor supports. Other value types use the scalar kernel on the same storage.
+         */
+        template<typename ValueType>
+        class SimdMultiplier : public Multiplier<ValueType> {
+        public:
+            SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            virtual ~SimdMultiplier();
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual void clearCache() const override;
+
+            /*!
+             * Retrieves the instruction set that is used for the multiplications.
+             */
+            storm::utility::simd::InstructionSet const& getInstructionSet() const;
+
+        private:
+            /*!
+             * Creates the compact copy of the matrix (if not already done).
+             *
+             * @return The compact matrix or nullptr if the matrix can not be stored in the compact format.
+             */
+            storm::storage::CompactSparseMatrix<ValueType> const* initialize() const;
+
+            /*!
+             * Multiplies the rows firstRow, ..., endRow - 1 of the compact matrix with x and adds b (if given). The
+             * result for row i is written to result[i - firstRow].
+             */
+            void multiplyRows(ValueType const* x, ValueType const* b, ValueType* result, uint64_t firstRow, uint64_t endRow, bool backwards) const;
+
+            template<typename Compare>
+            void multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+            template<typename Compare>
+            void multAddReduceGaussSeidel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+            // A copy of the matrix in the compact format.
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactMatrix;
+
+            // A flag indicating that the matrix was found to be not representable in the compact format.
+            mutable bool compactMatrixUnavailable;
+
+            // The instruction set used for the multiplications.
+            storm::utility::simd::InstructionSet instructionSet;
+
+            // Storage for the values of the individual rows before they are reduced.
+            mutable std::vector<ValueType> rowValues;
+        };
+
+    }
+}
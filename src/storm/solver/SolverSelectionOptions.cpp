@@ -26,6 +26,8 @@ namespace storm {
                     return "vi-to-pi";
                 case MinMaxMethod::Acyclic:
                     return "vi-to-pi";
+                case MinMaxMethod::MulticolorGaussSeidel:
+                    return "multicolor-gaussseidel";
             }
             return "invalid";
         }
@@ -36,6 +38,8 @@ namespace storm {
                     return "Native";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
+                case MultiplierType::Simd:
+                    return "Simd";
             }
             return "invalid";
         }
@@ -134,6 +138,8 @@ namespace storm {
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return "RationalSearch";
+                case NativeLinearEquationSolverMethod::MulticolorGaussSeidel:
+                    return "MulticolorGaussSeidel";
             }
             return "invalid";
         }
@@ -0,0 +1,163 @@
+#include "storm/solver/SubmatrixViewMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseSubmatrixView.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        SubmatrixViewMultiplier<ValueType>::SubmatrixViewMultiplier(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view, bool materialize) : Multiplier<ValueType>(view.getOriginalMatrix()), view(view) {
+            if (materialize) {
+                materializedMatrix = std::make_unique<storm::storage::SparseMatrix<ValueType>>(view.toSparseMatrix());
+                materializedMultiplier = MultiplierFactory<ValueType>().create(env, *materializedMatrix);
+            }
+        }
+
+        template<typename ValueType>
+        SubmatrixViewMultiplier<ValueType>::~SubmatrixViewMultiplier() {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool SubmatrixViewMultiplier<ValueType>::isMaterialized() const {
+            return materializedMultiplier != nullptr;
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::clearCache() const {
+            if (materializedMultiplier) {
+                materializedMultiplier->clearCache();
+            }
+            Multiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& SubmatrixViewMultiplier<ValueType>::getRowGroupIndices() const {
+            return view.getRowGroupIndices();
+        }
+
+        template<typename ValueType>
+        uint64_t SubmatrixViewMultiplier<ValueType>::getRowCount() const {
+            return view.getRowCount();
+        }
+
+        template<typename ValueType>
+        uint64_t SubmatrixViewMultiplier<ValueType>::getNumberOfThreads() const {
+            // Within a task (e.g. when solving the SCCs of a topological solver in parallel), we multiply sequentially.
+            if (storm::utility::ThreadPool::isExecutingTask()) {
+                return 1;
+            }
+            // Without the core settings (e.g. when storm is used as a library), we multiply sequentially.
+            if (!storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+                return 1;
+            }
+            return storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType>& SubmatrixViewMultiplier<ValueType>::getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const {
+            if (&x != &result) {
+                return result;
+            }
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            return *this->cachedVector;
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (materializedMultiplier) {
+                materializedMultiplier->multiply(env, x, b, result);
+                return;
+            }
+            std::vector<ValueType>& target = getTarget(x, result);
+            target.resize(view.getRowCount());
+            uint64_t numberOfThreads = getNumberOfThreads();
+            if (numberOfThreads > 1) {
+                storm::utility::executeInBlocks(storm::utility::ThreadPool::getGlobalInstance(numberOfThreads), view.getRowCount(), [&] (uint64_t firstRow, uint64_t endRow) {
+                    view.multiplyWithVectorRange(firstRow, endRow, x, target, b);
+                });
+            } else {
+                view.multiplyWithVectorRange(0, view.getRowCount(), x, target, b);
+            }
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            if (materializedMultiplier) {
+                materializedMultiplier->multiplyGaussSeidel(env, x, b, backwards);
+            } else if (backwards) {
+                view.multiplyWithVectorBackward(x, x, b);
+            } else {
+                view.multiplyWithVectorForward(x, x, b);
+            }
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (materializedMultiplier) {
+                materializedMultiplier->multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+                return;
+            }
+            std::vector<ValueType>& target = getTarget(x, result);
+            uint64_t numberOfRowGroups = rowGroupIndices.size() - 1;
+            target.resize(numberOfRowGroups);
+            uint64_t numberOfThreads = getNumberOfThreads();
+            if (numberOfThreads > 1) {
+                storm::utility::executeInBlocks(storm::utility::ThreadPool::getGlobalInstance(numberOfThreads), numberOfRowGroups, [&] (uint64_t firstRowGroup, uint64_t endRowGroup) {
+                    view.multiplyAndReduceRange(dir, rowGroupIndices, firstRowGroup, endRowGroup, x, b, target, choices);
+                });
+            } else {
+                view.multiplyAndReduceRange(dir, rowGroupIndices, 0, numberOfRowGroups, x, b, target, choices);
+            }
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            if (materializedMultiplier) {
+                materializedMultiplier->multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+            } else if (backwards) {
+                view.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else {
+                view.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void SubmatrixViewMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            if (materializedMultiplier) {
+                materializedMultiplier->multiplyRow(rowIndex, x, value);
+            } else {
+                value += view.multiplyRowWithVector(rowIndex, x);
+            }
+        }
+
+        template class SubmatrixViewMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class SubmatrixViewMultiplier<storm::RationalNumber>;
+        template class SubmatrixViewMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        template<typename ValueType>
+        class SparseSubmatrixView;
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier for a submatrix that is given as a view on the original matrix, which saves copying the
+         * submatrix. The multiplications are performed row by row like in the native multiplier (using the built-in
+         * thread pool if several threads are requested). If the submatrix is to be materialized, the multiplier
+         * instead copies the submatrix and delegates all operations to a multiplier for the copy.
+         */
+        template<typename ValueType>
+        class SubmatrixViewMultiplier : public Multiplier<ValueType> {
+        public:
+            /*!
+             * Creates a multiplier for the given view. The view must outlive the multiplier.
+             *
+             * @param env The environment that is used to create the multiplier for the copy (if any).
+             * @param view The submatrix.
+             * @param materialize If set, the submatrix is copied.
+             */
+            SubmatrixViewMultiplier(Environment const& env, storm::storage::SparseSubmatrixView<ValueType> const& view, bool materialize);
+            virtual ~SubmatrixViewMultiplier();
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual void clearCache() const override;
+
+            /*!
+             * Retrieves whether the multiplier operates on a copy of the submatrix.
+             */
+            bool isMaterialized() const;
+
+        protected:
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const override;
+            virtual uint64_t getRowCount() const override;
+
+        private:
+            /*!
+             * Retrieves the number of threads that are to be used by the built-in thread pool.
+             */
+            uint64_t getNumberOfThreads() const;
+
+            /*!
+             * Retrieves the vector to which the result is written, which is the cached vector if the input and the
+             * result vector coincide.
+             */
+            std::vector<ValueType>& getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const;
+
+            storm::storage::SparseSubmatrixView<ValueType> const& view;
+
+            // The copy of the submatrix and the multiplier for it (if the submatrix is materialized).
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> materializedMatrix;
+            std::unique_ptr<Multiplier<ValueType>> materializedMultiplier;
+        };
+
+    }
+}
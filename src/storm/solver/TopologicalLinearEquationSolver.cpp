@@ -1,8 +1,11 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -76,8 +79,14 @@ namespace storm {
             
             // Handle the case where there is just one large SCC
             bool returnValue = true;
+            uint64_t numberOfSccThreads = getNumberOfSccThreads(env);
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            } else if (numberOfSccThreads > 1) {
+                if (!this->sccTaskScheduler) {
+                    this->sccTaskScheduler = std::make_unique<storm::solver::helper::SccTaskScheduler>(*this->A, *this->sortedSccDecomposition, env.solver().topological().getTrivialSccBatchSize());
+                }
+                returnValue = solveSccsParallel(sccSolverEnvironment, numberOfSccThreads, x, b);
             } else {
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
                 uint64_t sccIndex = 0;
@@ -89,7 +98,7 @@ namespace storm {
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
                     }
                     ++sccIndex;
                     if (storm::utility::resources::isTerminate()) {
@@ -109,10 +118,53 @@ namespace storm {
             return returnValue;
         }
         
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getNumberOfSccThreads(storm::Environment const& env) const {
+            // Exact numbers are not solved in parallel as they are not guaranteed to be thread-safe.
+            if (!env.solver().topological().isParallelSccSchedulingSet() || storm::NumberTraits<ValueType>::IsExact) {
+                return 1;
+            }
+            return env.solver().topological().getNumberOfThreads();
+        }
+        
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving " << this->sccTaskScheduler->getNumberOfTasks() << " SCC task(s) with " << numberOfThreads << " threads.");
+            
+            // Every thread has its own solver and its own representation of the current SCC.
+            std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> sccSolvers(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::atomic<bool> returnValue(true);
+            
+            bool finished = this->sccTaskScheduler->execute(numberOfThreads, [&] (uint64_t thread, uint64_t firstScc, uint64_t endScc) {
+                for (uint64_t sccIndex = firstScc; sccIndex < endScc; ++sccIndex) {
+                    auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                    bool sccReturnValue;
+                    if (scc.size() == 1) {
+                        sccReturnValue = solveTrivialScc(*scc.begin(), x, b);
+                    } else {
+                        storm::storage::BitVector& sccAsBitVector = sccsAsBitVectors[thread];
+                        sccAsBitVector.clear();
+                        for (auto const& state : scc) {
+                            sccAsBitVector.set(state, true);
+                        }
+                        sccReturnValue = solveScc(sccSolverEnvironment, sccSolvers[thread], sccAsBitVector, x, b);
+                    }
+                    if (!sccReturnValue) {
+                        returnValue = false;
+                    }
+                }
+                return !storm::utility::resources::isTerminate();
+            });
+            STORM_LOG_WARN_COND(finished, "Topological solver aborted before all SCCs were analyzed.");
+            return returnValue;
+        }
+        
         template<typename ValueType>
         void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
             // Obtain the scc decomposition
             this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sccTaskScheduler.reset();
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -163,23 +215,23 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
 //            std::cout << "Solving SCC " << scc << std::endl;
 //            std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -199,20 +251,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -233,6 +285,7 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            sccTaskScheduler.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -4,6 +4,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/helper/SccTaskScheduler.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -46,7 +47,13 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves all SCCs (in case there are multiple SCCs) such that independent SCCs are solved in parallel.
+            bool solveSccsParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            // Retrieves the number of threads to use for solving independent SCCs in parallel (or one if the SCCs are to be solved sequentially).
+            uint64_t getNumberOfSccThreads(storm::Environment const& env) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -60,6 +67,7 @@ namespace storm {
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<storm::solver::helper::SccTaskScheduler> sccTaskScheduler;
         };
         
         template<typename ValueType>
@@ -1,9 +1,12 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -76,28 +79,36 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                uint64_t sccIndex = 0;
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) {
-                            sccRowGroupsAsBitVector.set(group, true);
-                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                sccRowsAsBitVector.set(row, true);
+                uint64_t numberOfSccThreads = getNumberOfSccThreads(env);
+                if (numberOfSccThreads > 1) {
+                    if (!this->sccTaskScheduler) {
+                        this->sccTaskScheduler = std::make_unique<storm::solver::helper::SccTaskScheduler>(*this->A, *this->sortedSccDecomposition, env.solver().topological().getTrivialSccBatchSize());
+                    }
+                    returnValue = solveSccsParallel(sccSolverEnvironment, numberOfSccThreads, dir, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    uint64_t sccIndex = 0;
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            sccRowGroupsAsBitVector.clear();
+                            sccRowsAsBitVector.clear();
+                            for (auto const& group : scc) {
+                                sccRowGroupsAsBitVector.set(group, true);
+                                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                                    sccRowsAsBitVector.set(row, true);
+                                }
                             }
+                            returnValue = solveScc(sccSolverEnvironment, this->sccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        }
+                        ++sccIndex;
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
                 
@@ -118,10 +129,59 @@ namespace storm {
             return returnValue;
         }
         
+        template<typename ValueType>
+        uint64_t TopologicalMinMaxLinearEquationSolver<ValueType>::getNumberOfSccThreads(storm::Environment const& env) const {
+            // Exact numbers are not solved in parallel as they are not guaranteed to be thread-safe.
+            if (!env.solver().topological().isParallelSccSchedulingSet() || storm::NumberTraits<ValueType>::IsExact) {
+                return 1;
+            }
+            return env.solver().topological().getNumberOfThreads();
+        }
+        
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving " << this->sccTaskScheduler->getNumberOfTasks() << " SCC task(s) with " << numberOfThreads << " threads.");
+            
+            // Every thread has its own solver and its own representation of the current SCC.
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> sccSolvers(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::vector<storm::storage::BitVector> sccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+            std::atomic<bool> returnValue(true);
+            
+            bool finished = this->sccTaskScheduler->execute(numberOfThreads, [&] (uint64_t thread, uint64_t firstScc, uint64_t endScc) {
+                for (uint64_t sccIndex = firstScc; sccIndex < endScc; ++sccIndex) {
+                    auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                    bool sccReturnValue;
+                    if (scc.size() == 1) {
+                        sccReturnValue = solveTrivialScc(*scc.begin(), dir, x, b);
+                    } else {
+                        storm::storage::BitVector& sccRowGroupsAsBitVector = sccRowGroupsAsBitVectors[thread];
+                        storm::storage::BitVector& sccRowsAsBitVector = sccRowsAsBitVectors[thread];
+                        sccRowGroupsAsBitVector.clear();
+                        sccRowsAsBitVector.clear();
+                        for (auto const& group : scc) {
+                            sccRowGroupsAsBitVector.set(group, true);
+                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                                sccRowsAsBitVector.set(row, true);
+                            }
+                        }
+                        sccReturnValue = solveScc(sccSolverEnvironment, sccSolvers[thread], dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b);
+                    }
+                    if (!sccReturnValue) {
+                        returnValue = false;
+                    }
+                }
+                return !storm::utility::resources::isTerminate();
+            });
+            STORM_LOG_WARN_COND(finished, "Topological solver aborted before all SCCs were analyzed.");
+            return returnValue;
+        }
+        
         template<typename ValueType>
         void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
             // Obtain the scc decomposition
             this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sccTaskScheduler.reset();
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -220,21 +280,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -255,23 +315,23 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                sccSolver->setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -285,16 +345,16 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -314,6 +374,7 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            sccTaskScheduler.reset();
             auxiliaryRowGroupVector.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
@@ -3,6 +3,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SccTaskScheduler.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -41,12 +42,19 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+            // Solves all SCCs (in case there are multiple SCCs) such that independent SCCs are solved in parallel.
+            bool solveSccsParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            // Retrieves the number of threads to use for solving independent SCCs in parallel (or one if the SCCs are to be solved sequentially).
+            uint64_t getNumberOfSccThreads(storm::Environment const& env) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<storm::solver::helper::SccTaskScheduler> sccTaskScheduler;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
         };
     }
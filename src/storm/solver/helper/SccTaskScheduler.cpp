@@ -0,0 +1,153 @@
+#include "storm/solver/helper/SccTaskScheduler.h"
+
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+#include "storm/storage/Decomposition.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            SccTaskScheduler::SccTaskScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sortedSccs, uint64_t maximalBatchSize) {
+                // Combine consecutive trivial SCCs.
+                taskIndications.push_back(0);
+                bool lastTaskIsTrivial = false;
+                for (uint64_t sccIndex = 0; sccIndex < sortedSccs.size(); ++sccIndex) {
+                    bool isTrivial = sortedSccs[sccIndex].size() == 1;
+                    if (sccIndex > 0 && !(isTrivial && lastTaskIsTrivial && sccIndex - taskIndications.back() < maximalBatchSize)) {
+                        taskIndications.push_back(sccIndex);
+                    }
+                    lastTaskIsTrivial = isTrivial;
+                }
+                taskIndications.push_back(sortedSccs.size());
+                uint64_t numberOfTasks = taskIndications.size() - 1;
+
+                std::vector<uint64_t> stateToTask(matrix.getRowGroupCount());
+                for (uint64_t task = 0; task < numberOfTasks; ++task) {
+                    for (uint64_t sccIndex = taskIndications[task]; sccIndex < taskIndications[task + 1]; ++sccIndex) {
+                        for (auto const& state : sortedSccs[sccIndex]) {
+                            stateToTask[state] = task;
+                        }
+                    }
+                }
+
+                // Gather the dependencies between the tasks (without duplicates).
+                std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+                std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+                std::vector<uint64_t> lastDependentTask(numberOfTasks, std::numeric_limits<uint64_t>::max());
+                numberOfDependencies.resize(numberOfTasks, 0);
+                for (uint64_t task = 0; task < numberOfTasks; ++task) {
+                    for (uint64_t sccIndex = taskIndications[task]; sccIndex < taskIndications[task + 1]; ++sccIndex) {
+                        for (auto const& state : sortedSccs[sccIndex]) {
+                            for (auto const& entry : matrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                                uint64_t successorTask = stateToTask[entry.getColumn()];
+                                if (successorTask != task && lastDependentTask[successorTask] != task) {
+                                    STORM_LOG_ASSERT(successorTask < task, "The SCCs are not sorted topologically.");
+                                    lastDependentTask[successorTask] = task;
+                                    dependencies.emplace_back(successorTask, task);
+                                    ++numberOfDependencies[task];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                dependentTaskIndications.resize(numberOfTasks + 1, 0);
+                for (auto const& dependency : dependencies) {
+                    ++dependentTaskIndications[dependency.first + 1];
+                }
+                for (uint64_t task = 0; task < numberOfTasks; ++task) {
+                    dependentTaskIndications[task + 1] += dependentTaskIndications[task];
+                }
+                dependentTasks.resize(dependencies.size());
+                std::vector<uint64_t> insertPositions(dependentTaskIndications.begin(), dependentTaskIndications.end() - 1);
+                for (auto const& dependency : dependencies) {
+                    dependentTasks[insertPositions[dependency.first]++] = dependency.second;
+                }
+                STORM_LOG_TRACE("Created " << numberOfTasks << " tasks with " << dependencies.size() << " dependencies for " << sortedSccs.size() << " SCCs.");
+            }
+
+            uint64_t SccTaskScheduler::getNumberOfTasks() const {
+                return taskIndications.size() - 1;
+            }
+
+            bool SccTaskScheduler::execute(uint64_t numberOfThreads, std::function<bool(uint64_t thread, uint64_t firstScc, uint64_t endScc)> const& solveSccs) const {
+                uint64_t numberOfTasks = getNumberOfTasks();
+                std::vector<uint64_t> remainingDependencies = numberOfDependencies;
+
+                // Among the ready tasks, prefer the ones that come first in the topological order.
+                std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> readyTasks;
+                for (uint64_t task = 0; task < numberOfTasks; ++task) {
+                    if (remainingDependencies[task] == 0) {
+                        readyTasks.push(task);
+                    }
+                }
+                uint64_t unfinishedTasks = numberOfTasks;
+                bool aborted = false;
+                std::mutex mutex;
+                std::condition_variable stateChanged;
+
+                storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(numberOfThreads, [&] (uint64_t thread) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        stateChanged.wait(lock, [&] { return aborted || unfinishedTasks == 0 || !readyTasks.empty(); });
+                        if (aborted || unfinishedTasks == 0) {
+                            return;
+                        }
+                        uint64_t task = readyTasks.top();
+                        readyTasks.pop();
+                        lock.unlock();
+
+                        bool success = false;
+                        try {
+                            success = solveSccs(thread, taskIndications[task], taskIndications[task + 1]);
+                        } catch (...) {
+                            lock.lock();
+                            aborted = true;
+                            stateChanged.notify_all();
+                            throw;
+                        }
+
+                        lock.lock();
+                        if (!success) {
+                            aborted = true;
+                            stateChanged.notify_all();
+                            return;
+                        }
+                        --unfinishedTasks;
+                        bool notify = unfinishedTasks == 0;
+                        for (uint64_t index = dependentTaskIndications[task]; index < dependentTaskIndications[task + 1]; ++index) {
+                            uint64_t dependentTask = dependentTasks[index];
+                            if (--remainingDependencies[dependentTask] == 0) {
+                                readyTasks.push(dependentTask);
+                                notify = true;
+                            }
+                        }
+                        if (notify) {
+                            stateChanged.notify_all();
+                        }
+                    }
+                });
+                return !aborted;
+            }
+
+            template SccTaskScheduler::SccTaskScheduler(storm::storage::SparseMatrix<double> const& matrix, storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sortedSccs, uint64_t maximalBatchSize);
+#ifdef STORM_HAVE_CARL
+            template SccTaskScheduler::SccTaskScheduler(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix, storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sortedSccs, uint64_t maximalBatchSize);
+            template SccTaskScheduler::SccTaskScheduler(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix, storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sortedSccs, uint64_t maximalBatchSize);
+#endif
+        }
+    }
+}
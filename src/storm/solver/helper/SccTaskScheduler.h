@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        template<typename BlockType>
+        class Decomposition;
+
+        class StronglyConnectedComponent;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Schedules the SCCs of an equation system for solving them on multiple threads. An SCC is solved as soon
+             * as all SCCs it depends on are solved, so independent SCCs are solved concurrently. Consecutive trivial
+             * SCCs (with respect to the topological order) are combined into a single task to keep the scheduling
+             * overhead low.
+             */
+            class SccTaskScheduler {
+            public:
+                /*!
+                 * Creates the tasks and their dependencies.
+                 *
+                 * @param matrix The matrix of the equation system. Row group i contains the rows of state i.
+                 * @param sortedSccs The SCCs of the matrix, sorted such that an SCC only depends on SCCs with a smaller index.
+                 * @param maximalBatchSize The maximal number of trivial SCCs that are combined into one task.
+                 */
+                template<typename ValueType>
+                SccTaskScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sortedSccs, uint64_t maximalBatchSize);
+
+                /*!
+                 * Retrieves the number of tasks, i.e., the number of SCCs after combining consecutive trivial SCCs.
+                 */
+                uint64_t getNumberOfTasks() const;
+
+                /*!
+                 * Solves the SCCs using the built-in thread pool. A task is only started once all tasks it depends on
+                 * are finished.
+                 *
+                 * @param numberOfThreads The number of threads to use.
+                 * @param solveSccs A function that solves the SCCs with indices firstScc, ..., endScc - 1 (in this
+                 * order). It also gets the index of the calling thread (between 0 and numberOfThreads - 1), which can
+                 * be used to access thread-local data. Returning false prevents that further tasks are started.
+                 * @return True iff all tasks were executed.
+                 */
+                bool execute(uint64_t numberOfThreads, std::function<bool(uint64_t thread, uint64_t firstScc, uint64_t endScc)> const& solveSccs) const;
+
+            private:
+                // Task i consists of the SCCs taskIndications[i], ..., taskIndications[i + 1] - 1.
+                std::vector<uint64_t> taskIndications;
+
+                // The number of tasks that need to be finished before the task can be started.
+                std::vector<uint64_t> numberOfDependencies;
+
+                // The tasks depending on task i are dependentTasks[dependentTaskIndications[i]], ..., dependentTasks[dependentTaskIndications[i + 1] - 1].
+                std::vector<uint64_t> dependentTaskIndications;
+                std::vector<uint64_t> dependentTasks;
+            };
+
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <bitset>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 
 #include "storm/storage/BoostTypes.h"
 #include "storm/utility/OsDetection.h"
@@ -17,6 +18,52 @@
 namespace storm {
     namespace storage {
 
+        namespace {
+            // The number of buckets that are combined before checking the result in the bucket-wise predicates.
+            // Avoiding a branch per bucket lets the compiler vectorize the loops.
+            uint_fast64_t const BUCKET_BLOCK_SIZE = 8;
+
+            /*!
+             * Retrieves the number of leading zeros of the given (non-zero) bucket, i.e., the position of the first set
+             * bit within the bucket.
+             */
+            inline uint_fast8_t countLeadingZeros(uint64_t bucket) {
+#if (defined (__GNUG__) || defined(__clang__))
+                return __builtin_clzll(bucket);
+#else
+                uint_fast8_t result = 0;
+                while ((bucket & (1ull << 63)) == 0) {
+                    bucket <<= 1;
+                    ++result;
+                }
+                return result;
+#endif
+            }
+
+            /*!
+             * Checks whether the given operation yields zero for all pairs of corresponding buckets.
+             */
+            template<typename Operation>
+            bool isZeroForAllBuckets(uint64_t const* first1, uint64_t const* first2, uint_fast64_t numberOfBuckets, Operation const& operation) {
+                uint_fast64_t index = 0;
+                for (; index + BUCKET_BLOCK_SIZE <= numberOfBuckets; index += BUCKET_BLOCK_SIZE) {
+                    uint64_t combined = 0;
+                    for (uint_fast64_t offset = 0; offset < BUCKET_BLOCK_SIZE; ++offset) {
+                        combined |= operation(first1[index + offset], first2[index + offset]);
+                    }
+                    if (combined != 0) {
+                        return false;
+                    }
+                }
+                for (; index < numberOfBuckets; ++index) {
+                    if (operation(first1[index], first2[index]) != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
         BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit) : dataPtr(dataPtr), endIndex(endIndex) {
             if (setOnFirstBit) {
                 // Set the index of the first set bit in the vector.
@@ -191,6 +238,12 @@ namespace storm {
             }
         }
 
+        bool BitVector::setAtomically(uint_fast64_t index) {
+            STORM_LOG_ASSERT(index < bitCount, "Invalid call to BitVector::setAtomically: written index " << index << " out of bounds.");
+            uint64_t mask = 1ull << (63 - (index & mod64mask));
+            return (__atomic_fetch_or(buckets + (index >> 6), mask, __ATOMIC_RELAXED) & mask) == 0;
+        }
+
         template<typename InputIterator>
         void BitVector::set(InputIterator begin, InputIterator end, bool value) {
             for (InputIterator it = begin; it != end; ++it) {
@@ -341,11 +394,12 @@ namespace storm {
                     ++position;
                 }
             } else {
-                // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-                // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+                // If the given bit vector had much fewer elements, we iterate over its elements and determine the
+                // positions in the filter using a rank index.
+                BitVectorRankIndex filterRanks(filter);
                 for (auto bit : (*this)) {
                     if (filter[bit]) {
-                        result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                        result.set(filterRanks.getNumberOfSetBitsBeforeIndex(bit));
                     }
                 }
             }
@@ -401,34 +455,27 @@ namespace storm {
             return result;
         }
 
-        bool BitVector::isSubsetOf(BitVector const& other) const {
+        BitVector& BitVector::andNot(BitVector const& other) {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets, [] (uint64_t const& a, uint64_t const& b) { return a & ~b; });
+            return *this;
+        }
 
-            uint64_t const* it1 = buckets;
-            uint64_t const* ite1 = buckets + bucketCount();
-            uint64_t const* it2 = other.buckets;
-            
-            for (; it1 != ite1; ++it1, ++it2) {
-                if ((*it1 & *it2) != *it1) {
-                    return false;
-                }
-            }
-            return true;
+        BitVector& BitVector::orNot(BitVector const& other) {
+            STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets, [] (uint64_t const& a, uint64_t const& b) { return a | ~b; });
+            truncateLastBucket();
+            return *this;
         }
 
-        bool BitVector::isDisjointFrom(BitVector const& other) const {
+        bool BitVector::isSubsetOf(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            return isZeroForAllBuckets(buckets, other.buckets, bucketCount(), [] (uint64_t const& a, uint64_t const& b) { return a & ~b; });
+        }
 
-            uint64_t const* it1 = buckets;
-            uint64_t const* ite1 = buckets + bucketCount();
-            uint64_t const* it2 = other.buckets;
-            
-            for (; it1 != ite1; ++it1, ++it2) {
-                if ((*it1 & *it2) != 0) {
-                    return false;
-                }
-            }
-            return true;
+        bool BitVector::isDisjointFrom(BitVector const& other) const {
+            STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            return isZeroForAllBuckets(buckets, other.buckets, bucketCount(), [] (uint64_t const& a, uint64_t const& b) { return a & b; });
         }
 
         bool BitVector::matches(uint_fast64_t bitIndex, BitVector const& other) const {
@@ -588,9 +635,7 @@ namespace storm {
         }
 
         bool BitVector::empty() const {
-            uint64_t* last = buckets + bucketCount();
-            uint64_t* it = std::find_if(buckets, last, [] (uint64_t const& a) { return a != 0; });
-            return it == last;
+            return isZeroForAllBuckets(buckets, buckets, bucketCount(), [] (uint64_t const& a, uint64_t const&) { return a; });
         }
 
         bool BitVector::full() const {
@@ -599,14 +644,12 @@ namespace storm {
             }
             // Check that all buckets except the last one have all bits set.
             uint64_t* last = buckets + bucketCount() - 1;
-            for (uint64_t const* it = buckets; it < last; ++it) {
-                if (*it != -1ull) {
-                    return false;
-                }
+            if (!isZeroForAllBuckets(buckets, buckets, bucketCount() - 1, [] (uint64_t const& a, uint64_t const&) { return ~a; })) {
+                return false;
             }
             
             // Now check whether the relevant bits are set in the last bucket.
-            uint64_t mask = ~((1ull << (64 - (bitCount & mod64mask))) - 1ull);
+            uint64_t mask = (bitCount & mod64mask) == 0 ? -1ull : ~((1ull << (64 - (bitCount & mod64mask))) - 1ull);
             if ((*last & mask) != mask) {
                 return false;
             }
@@ -627,60 +670,48 @@ namespace storm {
         }
 
         uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
-            uint_fast64_t result = 0;
-
             // First, count all full buckets.
             uint_fast64_t bucket = index >> 6;
-            for (uint_fast64_t i = 0; i < bucket; ++i) {
-                // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined (__GNUG__) || defined(__clang__))
-                result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-                // If the target machine does not support SSE4, this will fail.
-                result += _mm_popcnt_u64(bucketVector[i]);
-#else
-                uint_fast32_t cnt;
-                uint_fast64_t bitset = buckets[i];
-                for (cnt = 0; bitset; cnt++) {
-                    bitset &= bitset - 1;
-                }
-                result += cnt;
-#endif
-            }
+            uint_fast64_t result = getNumberOfSetBitsInBuckets(buckets, buckets + bucket);
 
             // Now check if we have to count part of a bucket.
             uint64_t tmp = index & mod64mask;
             if (tmp != 0) {
                 tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
                 tmp &= buckets[bucket];
-                // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined (__GNUG__) || defined(__clang__))
-                result += __builtin_popcountll(tmp);
-#else
-                uint_fast32_t cnt;
-                uint64_t bitset = tmp;
-                for (cnt = 0; bitset; cnt++) {
-                    bitset &= bitset - 1;
-                }
-                result += cnt;
-#endif
+                result += getNumberOfSetBitsInBucket(tmp);
             }
 
             return result;
         }
+
+        uint_fast64_t BitVector::getNumberOfSetBitsInBuckets(uint64_t const* first, uint64_t const* last) {
+            // Use several independent counters such that consecutive population counts do not depend on each other.
+            uint_fast64_t result0 = 0, result1 = 0, result2 = 0, result3 = 0;
+            for (; first + 4 <= last; first += 4) {
+                result0 += getNumberOfSetBitsInBucket(first[0]);
+                result1 += getNumberOfSetBitsInBucket(first[1]);
+                result2 += getNumberOfSetBitsInBucket(first[2]);
+                result3 += getNumberOfSetBitsInBucket(first[3]);
+            }
+            for (; first != last; ++first) {
+                result0 += getNumberOfSetBitsInBucket(*first);
+            }
+            return result0 + result1 + result2 + result3;
+        }
         
         std::vector<uint_fast64_t> BitVector::getNumberOfSetBitsBeforeIndices() const {
-            std::vector<uint_fast64_t> bitsSetBeforeIndices;
-            bitsSetBeforeIndices.reserve(this->size());
-            uint_fast64_t lastIndex = 0;
+            std::vector<uint_fast64_t> bitsSetBeforeIndices(this->size());
             uint_fast64_t currentNumberOfSetBits = 0;
-            for (auto index : *this) {
-                while (lastIndex <= index) {
-                    bitsSetBeforeIndices.push_back(currentNumberOfSetBits);
-                    ++lastIndex;
+            uint_fast64_t index = 0;
+            for (uint64_t const* bucketIt = buckets, *bucketIte = buckets + bucketCount(); bucketIt != bucketIte; ++bucketIt) {
+                uint64_t bucket = *bucketIt;
+                uint_fast64_t endIndex = std::min(index + 64, bitCount);
+                // Proceed from the most significant bit, which corresponds to the smallest index.
+                for (; index < endIndex; ++index, bucket <<= 1) {
+                    bitsSetBeforeIndices[index] = currentNumberOfSetBits;
+                    currentNumberOfSetBits += bucket >> 63;
                 }
-                ++currentNumberOfSetBits;
             }
             return bitsSetBeforeIndices;
         }
@@ -732,10 +763,8 @@ namespace storm {
     
                     // Check if there is at least one bit in the remainder of the bucket that is set to true.
                     if (remainingInBucket != 0) {
-                        // As long as the current bit is not set, move the current bit.
-                        while ((remainingInBucket & (1ull << (63 - currentBitInByte))) == 0) {
-                            ++currentBitInByte;
-                        }
+                        // The first set bit is the most significant one.
+                        currentBitInByte = countLeadingZeros(remainingInBucket);
     
                         // Only return the index of the set bit if we are still in the valid range.
                         if (startingIndex + currentBitInByte < endIndex) {
@@ -758,10 +787,8 @@ namespace storm {
     
                     // Check if there is at least one bit in the remainder of the bucket that is set to false.
                     if (remainingInBucket != (-1ull & mask)) {
-                        // As long as the current bit is not false, move the current bit.
-                        while ((remainingInBucket & (1ull << (63 - currentBitInByte))) != 0) {
-                            ++currentBitInByte;
-                        }
+                        // The first unset bit is the most significant set bit of the complement.
+                        currentBitInByte = countLeadingZeros(~remainingInBucket & mask);
     
                         // Only return the index of the set bit if we are still in the valid range.
                         if (startingIndex + currentBitInByte < endIndex) {
@@ -198,6 +198,15 @@ namespace storm {
              */
             void set(uint_fast64_t index, bool value = true);
 
+            /*!
+             * Sets the bit at the given index to true. In contrast to set, this may be called concurrently by multiple
+             * threads for the same bit vector, as long as the bit vector is not modified otherwise in the meantime.
+             *
+             * @param index The index of the bit to set.
+             * @return True iff the bit was not set before.
+             */
+            bool setAtomically(uint_fast64_t index);
+
             /*!
              * Sets all bits in the given iterator range [first, last).
              *
@@ -348,6 +357,24 @@ namespace storm {
              */
             BitVector implies(BitVector const& other) const;
 
+            /*!
+             * Sets all bits to false that are set in the given bit vector, i.e., performs *this &= ~other without
+             * creating a temporary bit vector for the complement.
+             *
+             * @param other A reference to the bit vector whose set bits are to be removed from the current one.
+             * @return A reference to the current bit vector.
+             */
+            BitVector& andNot(BitVector const& other);
+
+            /*!
+             * Sets all bits to true that are not set in the given bit vector, i.e., performs *this |= ~other without
+             * creating a temporary bit vector for the complement.
+             *
+             * @param other A reference to the bit vector whose unset bits are to be added to the current one.
+             * @return A reference to the current bit vector.
+             */
+            BitVector& orNot(BitVector const& other);
+
             /*!
              * Checks whether all bits that are set in the current bit vector are also set in the given bit vector.
              *
@@ -469,6 +496,8 @@ namespace storm {
              *
              * @param index The index for which to retrieve the number of set bits with a smaller index.
              * @return The number of bits set in this bit vector with an index strictly smaller than the given one.
+             * @note This operation takes time linear in the given index. If it is performed for many indices, consider
+             * using a BitVectorRankIndex instead.
              */
             uint_fast64_t getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const;
 
@@ -543,6 +572,7 @@ namespace storm {
 
             friend struct std::hash<storm::storage::BitVector>;
             friend struct FNV1aBitVectorHash;
+            friend class BitVectorRankIndex;
 
             template<typename StateType>
             friend struct Murmur3BitVectorHash;
@@ -605,6 +635,16 @@ namespace storm {
              */
             size_t bucketCount() const;
 
+            /*!
+             * Retrieves the number of bits that are set in the given bucket.
+             */
+            static uint_fast64_t getNumberOfSetBitsInBucket(uint64_t bucket);
+
+            /*!
+             * Retrieves the number of bits that are set in the buckets in the range [first, last).
+             */
+            static uint_fast64_t getNumberOfSetBitsInBuckets(uint64_t const* first, uint64_t const* last);
+
             // The number of bits that this bit vector can hold.
             uint_fast64_t bitCount;
 
@@ -615,6 +655,18 @@ namespace storm {
             static const uint_fast64_t mod64mask = (1 << 6) - 1;
         };
 
+        inline uint_fast64_t BitVector::getNumberOfSetBitsInBucket(uint64_t bucket) {
+#if (defined (__GNUG__) || defined(__clang__))
+            return __builtin_popcountll(bucket);
+#else
+            uint_fast64_t result = 0;
+            for (; bucket; ++result) {
+                bucket &= bucket - 1;
+            }
+            return result;
+#endif
+        }
+
         struct FNV1aBitVectorHash {
             std::size_t operator()(storm::storage::BitVector const& bv) const;
         };
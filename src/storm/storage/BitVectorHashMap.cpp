@@ -142,6 +142,15 @@ namespace storm {
             return findBucket(key).first;
         }
 
+        template<class ValueType, class Hash>
+        std::pair<bool, ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+            if (flagBucketPair.first) {
+                return std::make_pair(true, values[flagBucketPair.second]);
+            }
+            return std::make_pair(false, ValueType());
+        }
+
         template<class ValueType, class Hash>
         typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::begin() const {
             return const_iterator(*this, occupied.begin());
@@ -117,6 +117,16 @@ namespace storm {
              */
             bool contains(storm::storage::BitVector const& key) const;
 
+            /*!
+             * Searches for the given key in the map without modifying the map. Hence, several threads may search
+             * concurrently as long as the map is not modified at the same time.
+             *
+             * @param key The key to search.
+             * @return A pair whose first component indicates whether the key was found and whose second component is
+             * the value associated with the key (if it was found).
+             */
+            std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
             /*!
              * Retrieves an iterator to the elements of the map.
              *
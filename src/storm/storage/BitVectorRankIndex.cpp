@@ -0,0 +1,70 @@
+#include "storm/storage/BitVectorRankIndex.h"
+
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        BitVectorRankIndex::BitVectorRankIndex(BitVector const& bitVector) : buckets(bitVector.buckets), bucketCount(bitVector.bucketCount()), bitCount(bitVector.size()) {
+            uint_fast64_t numberOfBlocks = (bucketCount + bucketsPerBlock - 1) / bucketsPerBlock;
+            setBitsBeforeBlock.reserve(numberOfBlocks + 1);
+            setBitsBeforeBlock.push_back(0);
+            for (uint_fast64_t block = 0; block < numberOfBlocks; ++block) {
+                uint64_t const* first = buckets + block * bucketsPerBlock;
+                uint64_t const* last = buckets + std::min(bucketCount, (block + 1) * bucketsPerBlock);
+                setBitsBeforeBlock.push_back(setBitsBeforeBlock.back() + BitVector::getNumberOfSetBitsInBuckets(first, last));
+            }
+        }
+
+        uint_fast64_t BitVectorRankIndex::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
+            STORM_LOG_ASSERT(index <= bitCount, "Invalid index " << index << " for bit vector of size " << bitCount << ".");
+            uint_fast64_t bucket = index >> 6;
+            uint_fast64_t block = bucket / bucketsPerBlock;
+            uint_fast64_t result = setBitsBeforeBlock[block];
+            for (uint_fast64_t currentBucket = block * bucketsPerBlock; currentBucket < bucket; ++currentBucket) {
+                result += BitVector::getNumberOfSetBitsInBucket(buckets[currentBucket]);
+            }
+
+            // Count the bits of the bucket that precede the index. Recall that the bit with the smallest index is
+            // the most significant one.
+            uint_fast64_t bitInBucket = index & 63;
+            if (bitInBucket != 0) {
+                result += BitVector::getNumberOfSetBitsInBucket(buckets[bucket] >> (64 - bitInBucket));
+            }
+            return result;
+        }
+
+        uint_fast64_t BitVectorRankIndex::getIndexOfSetBit(uint_fast64_t numberOfSetBitsBefore) const {
+            STORM_LOG_ASSERT(numberOfSetBitsBefore < getNumberOfSetBits(), "There are only " << getNumberOfSetBits() << " set bits.");
+
+            // Find the last block that is preceded by at most the given number of set bits.
+            uint_fast64_t block = std::upper_bound(setBitsBeforeBlock.begin(), setBitsBeforeBlock.end(), numberOfSetBitsBefore) - setBitsBeforeBlock.begin() - 1;
+            uint_fast64_t remaining = numberOfSetBitsBefore - setBitsBeforeBlock[block];
+
+            // Find the bucket within the block.
+            uint_fast64_t bucket = block * bucketsPerBlock;
+            uint_fast64_t setBitsInBucket = BitVector::getNumberOfSetBitsInBucket(buckets[bucket]);
+            while (remaining >= setBitsInBucket) {
+                remaining -= setBitsInBucket;
+                ++bucket;
+                setBitsInBucket = BitVector::getNumberOfSetBitsInBucket(buckets[bucket]);
+            }
+
+            // Find the bit within the bucket by iterating over its set bits.
+            uint64_t const* bucketPtr = buckets + bucket;
+            uint_fast64_t index = BitVector::getNextIndexWithValue(true, bucketPtr, 0, 64);
+            for (; remaining > 0; --remaining) {
+                index = BitVector::getNextIndexWithValue(true, bucketPtr, index + 1, 64);
+            }
+            return (bucket << 6) + index;
+        }
+
+        uint_fast64_t BitVectorRankIndex::getNumberOfSetBits() const {
+            return setBitsBeforeBlock.back();
+        }
+
+    }
+}
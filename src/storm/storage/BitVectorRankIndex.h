@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+
+        class BitVector;
+
+        /*!
+         * An index over a bit vector that answers rank queries (how many bits are set before a given index) in
+         * constant time and select queries (what is the index of the i-th set bit) in logarithmic time. For this, the
+         * number of set bits is stored for every block of 512 bits, which increases the memory consumption by one
+         * eighth of the size of the bit vector.
+         *
+         * The index refers to the storage of the bit vector, so the bit vector must neither be modified nor destroyed
+         * while the index is in use.
+         */
+        class BitVectorRankIndex {
+        public:
+            /*!
+             * Creates the index for the given bit vector.
+             *
+             * @param bitVector The bit vector to index.
+             */
+            explicit BitVectorRankIndex(BitVector const& bitVector);
+
+            /*!
+             * Retrieves the number of bits set in the bit vector with an index strictly smaller than the given one.
+             *
+             * @param index The index for which to retrieve the number of set bits with a smaller index. It may be at
+             * most the size of the bit vector.
+             * @return The number of bits set with an index strictly smaller than the given one.
+             */
+            uint_fast64_t getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const;
+
+            /*!
+             * Retrieves the index of the set bit that is preceded by exactly the given number of set bits.
+             *
+             * @param numberOfSetBitsBefore The number of set bits before the requested one. It must be smaller than
+             * the number of set bits.
+             * @return The index of the requested bit.
+             */
+            uint_fast64_t getIndexOfSetBit(uint_fast64_t numberOfSetBitsBefore) const;
+
+            /*!
+             * Retrieves the number of bits set in the bit vector.
+             */
+            uint_fast64_t getNumberOfSetBits() const;
+
+        private:
+            // The number of buckets whose set bits are accumulated in one entry of the index.
+            static const uint_fast64_t bucketsPerBlock = 8;
+
+            // The storage of the indexed bit vector.
+            uint64_t const* buckets;
+            uint_fast64_t bucketCount;
+            uint_fast64_t bitCount;
+
+            // The i-th entry holds the number of set bits in the blocks 0, ..., i - 1.
+            std::vector<uint_fast64_t> setBitsBeforeBlock;
+        };
+
+    }
+}
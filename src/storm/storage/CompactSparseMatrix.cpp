@@ -0,0 +1,420 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/storage/sparse/StateType.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix) : columnCount(matrix.getColumnCount()), rowIndications(matrix.rowIndications), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+            STORM_LOG_THROW(isRepresentable(matrix), storm::exceptions::InvalidArgumentException, "The matrix has too many columns to be stored with 32-bit column indices.");
+            columns.reserve(matrix.getEntryCount());
+            values.reserve(matrix.getEntryCount());
+            for (auto const& entry : matrix) {
+                columns.push_back(static_cast<column_type>(entry.getColumn()));
+                values.push_back(entry.getValue());
+            }
+            if (!trivialRowGrouping) {
+                rowGroupIndices = matrix.getRowGroupIndices();
+            }
+            if (rowIndications.empty()) {
+                // Matrices without rows do not carry the sentinel element.
+                rowIndications.push_back(0);
+            }
+        }
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType>&& matrix) : columnCount(matrix.getColumnCount()), rowIndications(std::move(matrix.rowIndications)), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+            STORM_LOG_THROW(isRepresentable(matrix), storm::exceptions::InvalidArgumentException, "The matrix has too many columns to be stored with 32-bit column indices.");
+            columns.reserve(matrix.columnsAndValues.size());
+            values.reserve(matrix.columnsAndValues.size());
+            for (auto const& entry : matrix.columnsAndValues) {
+                columns.push_back(static_cast<column_type>(entry.getColumn()));
+                values.push_back(entry.getValue());
+            }
+            if (!trivialRowGrouping) {
+                rowGroupIndices = std::move(matrix.rowGroupIndices);
+            }
+            if (rowIndications.empty()) {
+                // Matrices without rows do not carry the sentinel element.
+                rowIndications.push_back(0);
+            }
+
+            // Release the storage of the original matrix.
+            matrix = SparseMatrix<ValueType>();
+        }
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<column_type>&& columns, std::vector<value_type>&& values, boost::optional<std::vector<index_type>>&& rowGroupIndices) : columnCount(columnCount), columns(std::move(columns)), values(std::move(values)), rowIndications(std::move(rowIndications)), trivialRowGrouping(!rowGroupIndices), rowGroupIndices(std::move(rowGroupIndices)) {
+            if (this->rowIndications.empty()) {
+                // Matrices without rows do not carry the sentinel element.
+                this->rowIndications.push_back(0);
+            }
+        }
+        
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::isRepresentable(SparseMatrix<ValueType> const& matrix) {
+            return matrix.getColumnCount() <= static_cast<index_type>(std::numeric_limits<column_type>::max()) + 1;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> CompactSparseMatrix<ValueType>::toSparseMatrix() const {
+            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            columnsAndValues.reserve(values.size());
+            auto valueIt = values.begin();
+            for (auto const& column : columns) {
+                columnsAndValues.emplace_back(column, *valueIt);
+                ++valueIt;
+            }
+            boost::optional<std::vector<index_type>> groups;
+            if (!trivialRowGrouping) {
+                groups = rowGroupIndices.get();
+            }
+            return SparseMatrix<ValueType>(columnCount, std::vector<index_type>(rowIndications), std::move(columnsAndValues), std::move(groups));
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getRowGroupCount() const {
+            return getRowGroupIndices().size() - 1;
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowGroupIndices() const {
+            // If there is no current row grouping, we need to create it.
+            if (!rowGroupIndices) {
+                STORM_LOG_ASSERT(trivialRowGrouping, "Only trivial row-groupings can be constructed on-the-fly.");
+                rowGroupIndices = storm::utility::vector::buildVectorForRange(static_cast<index_type>(0), getRowCount() + 1);
+            }
+            return rowGroupIndices.get();
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::hasTrivialRowGrouping() const {
+            return trivialRowGrouping;
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::const_rows CompactSparseMatrix<ValueType>::getRow(index_type row) const {
+            return const_rows(this->begin(row), rowIndications[row + 1] - rowIndications[row]);
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::const_rows CompactSparseMatrix<ValueType>::getRowGroup(index_type rowGroup) const {
+            std::vector<index_type> const& groups = getRowGroupIndices();
+            index_type firstRow = groups[rowGroup];
+            return const_rows(this->begin(firstRow), rowIndications[groups[rowGroup + 1]] - rowIndications[firstRow]);
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::const_iterator CompactSparseMatrix<ValueType>::begin(index_type row) const {
+            return const_iterator(columns.data() + rowIndications[row], values.data() + rowIndications[row]);
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::const_iterator CompactSparseMatrix<ValueType>::end(index_type row) const {
+            return const_iterator(columns.data() + rowIndications[row + 1], values.data() + rowIndications[row + 1]);
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::const_iterator CompactSparseMatrix<ValueType>::end() const {
+            return const_iterator(columns.data() + columns.size(), values.data() + values.size());
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::column_type> const& CompactSparseMatrix<ValueType>::getColumns() const {
+            return columns;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> const& CompactSparseMatrix<ValueType>::getValues() const {
+            return values;
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            // If the vector and the result are aliases, we need and temporary vector.
+            std::vector<ValueType>* target;
+            std::vector<ValueType> temporary;
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased. Using temporary, which is potentially slow.");
+                temporary = std::vector<ValueType>(vector.size());
+                target = &temporary;
+            } else {
+                target = &result;
+            }
+
+            this->multiplyWithVectorForward(vector, *target, summand);
+
+            if (target == &temporary) {
+                std::swap(result, *target);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            multiplyWithVectorRange(0, this->getRowCount(), vector, result, summand);
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            column_type const* columnIt = columns.data();
+            value_type const* valueIt = values.data();
+            index_type const* rowIt = rowIndications.data();
+
+            for (index_type row = startRow; row < endRow; ++row) {
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIt[row], entryEnd = rowIt[row + 1]; entry < entryEnd; ++entry) {
+                    newValue += valueIt[entry] * vector[columnIt[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            column_type const* columnIt = columns.data();
+            value_type const* valueIt = values.data();
+            index_type const* rowIt = rowIndications.data();
+
+            for (index_type row = this->getRowCount(); row > 0;) {
+                --row;
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIt[row + 1], entryEnd = rowIt[row]; entry > entryEnd;) {
+                    --entry;
+                    newValue += valueIt[entry] * vector[columnIt[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType>
+        ValueType CompactSparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+            ValueType result = storm::utility::zero<ValueType>();
+            for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                result += values[entry] * vector[columns[entry]];
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            // If the vector and the result are aliases, we need and temporary vector.
+            std::vector<ValueType>* target;
+            std::vector<ValueType> temporary;
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+                temporary = std::vector<ValueType>(vector.size());
+                target = &temporary;
+            } else {
+                target = &result;
+            }
+
+            this->multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, *target, choices);
+
+            if (target == &temporary) {
+                std::swap(temporary, result);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRange(dir, rowGroupIndices, 0, result.size(), vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceRange<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceRange<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            column_type const* columnIt = columns.data();
+            value_type const* valueIt = values.data();
+            index_type const* rowIt = rowIndications.data();
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+
+            for (uint64_t group = startRowGroup; group < endRowGroup; ++group) {
+                uint64_t firstRow = rowGroupIndices[group];
+                uint64_t endRow = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (firstRow < endRow) {
+                    ValueType currentValue = summand ? (*summand)[firstRow] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIt[firstRow], entryEnd = rowIt[firstRow + 1]; entry < entryEnd; ++entry) {
+                        currentValue += valueIt[entry] * vector[columnIt[entry]];
+                    }
+
+                    if (choices) {
+                        selectedChoice = 0;
+                        if ((*choices)[group] == 0) {
+                            oldSelectedChoiceValue = currentValue;
+                        }
+                    }
+
+                    for (uint64_t row = firstRow + 1; row < endRow; ++row) {
+                        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                        for (index_type entry = rowIt[row], entryEnd = rowIt[row + 1]; entry < entryEnd; ++entry) {
+                            newValue += valueIt[entry] * vector[columnIt[entry]];
+                        }
+
+                        if (choices && row - firstRow == (*choices)[group]) {
+                            oldSelectedChoiceValue = newValue;
+                        }
+
+                        if (compare(newValue, currentValue)) {
+                            currentValue = newValue;
+                            if (choices) {
+                                selectedChoice = row - firstRow;
+                            }
+                        }
+                    }
+
+                    // Finally write value to target vector.
+                    result[group] = currentValue;
+                    if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                        (*choices)[group] = selectedChoice;
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            column_type const* columnIt = columns.data();
+            value_type const* valueIt = values.data();
+            index_type const* rowIt = rowIndications.data();
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+
+            for (uint64_t group = result.size(); group > 0;) {
+                --group;
+                uint64_t firstRow = rowGroupIndices[group];
+                uint64_t endRow = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (firstRow < endRow) {
+                    uint64_t row = endRow - 1;
+                    ValueType currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIt[row + 1], entryEnd = rowIt[row]; entry > entryEnd;) {
+                        --entry;
+                        currentValue += valueIt[entry] * vector[columnIt[entry]];
+                    }
+
+                    if (choices) {
+                        selectedChoice = row - firstRow;
+                        if ((*choices)[group] == selectedChoice) {
+                            oldSelectedChoiceValue = currentValue;
+                        }
+                    }
+
+                    while (row > firstRow) {
+                        --row;
+                        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                        for (index_type entry = rowIt[row + 1], entryEnd = rowIt[row]; entry > entryEnd;) {
+                            --entry;
+                            newValue += valueIt[entry] * vector[columnIt[entry]];
+                        }
+
+                        if (choices && row - firstRow == (*choices)[group]) {
+                            oldSelectedChoiceValue = newValue;
+                        }
+
+                        if (compare(newValue, currentValue)) {
+                            currentValue = newValue;
+                            if (choices) {
+                                selectedChoice = row - firstRow;
+                            }
+                        }
+                    }
+
+                    // Finally write value to target vector.
+                    result[group] = currentValue;
+                    if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                        (*choices)[group] = selectedChoice;
+                    }
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template class CompactSparseMatrix<double>;
+        template class CompactSparseMatrix<float>;
+        template class CompactSparseMatrix<int>;
+        template class CompactSparseMatrix<storm::storage::sparse::state_type>;
+
+#ifdef STORM_HAVE_CARL
+#if defined(STORM_HAVE_CLN)
+        template class CompactSparseMatrix<storm::ClnRationalNumber>;
+#endif
+
+#if defined(STORM_HAVE_GMP)
+        template class CompactSparseMatrix<storm::GmpRationalNumber>;
+#endif
+
+        template class CompactSparseMatrix<storm::RationalFunction>;
+        template class CompactSparseMatrix<storm::Interval>;
+#endif
+
+    } // namespace storage
+} // namespace storm
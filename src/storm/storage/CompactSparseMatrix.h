@@ -0,0 +1,392 @@
+#ifndef STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <vector>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only variant of the sparse matrix that stores the entries in a structure-of-arrays layout. Instead of
+         * storing (64-bit column, value) pairs, the columns are stored as 32-bit indices in an array that is separate
+         * from the values. For the matrix-vector multiplications that dominate the run time of the numerical methods,
+         * this roughly halves the memory traffic per entry (for double values) and lets the compiler vectorize the
+         * loops over the values.
+         *
+         * The matrix can only be created from an existing sparse matrix (or via SparseMatrixBuilder::buildCompact)
+         * and requires the number of columns to fit into 32 bits. The models and solvers keep their matrices in the
+         * standard format, so a compact matrix used by a multiplier is an additional copy that only saves bandwidth.
+         */
+        template<typename ValueType>
+        class CompactSparseMatrix {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef uint32_t column_type;
+            typedef ValueType value_type;
+
+            /*!
+             * A lightweight view on an entry of the matrix that offers the same accessors as a MatrixEntry.
+             */
+            class const_entry {
+            public:
+                const_entry(column_type column, value_type const& value) : column(column), value(value) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Retrieves the column of the entry.
+                 *
+                 * @return The column of the entry.
+                 */
+                column_type getColumn() const {
+                    return column;
+                }
+
+                /*!
+                 * Retrieves the value of the entry.
+                 *
+                 * @return The value of the entry.
+                 */
+                value_type const& getValue() const {
+                    return value;
+                }
+
+                // This makes it possible to use the arrow operator on the iterators below.
+                const_entry const* operator->() const {
+                    return this;
+                }
+
+            private:
+                column_type column;
+                value_type const& value;
+            };
+
+            /*!
+             * An iterator over the entries of the matrix that walks the column and the value array in lockstep.
+             */
+            class const_iterator {
+            public:
+                const_iterator(column_type const* columnIt, value_type const* valueIt) : columnIt(columnIt), valueIt(valueIt) {
+                    // Intentionally left empty.
+                }
+
+                const_entry operator*() const {
+                    return const_entry(*columnIt, *valueIt);
+                }
+
+                const_entry operator->() const {
+                    return const_entry(*columnIt, *valueIt);
+                }
+
+                const_iterator& operator++() {
+                    ++columnIt;
+                    ++valueIt;
+                    return *this;
+                }
+
+                const_iterator& operator--() {
+                    --columnIt;
+                    --valueIt;
+                    return *this;
+                }
+
+                const_iterator operator+(index_type offset) const {
+                    return const_iterator(columnIt + offset, valueIt + offset);
+                }
+
+                bool operator==(const_iterator const& other) const {
+                    return columnIt == other.columnIt;
+                }
+
+                bool operator!=(const_iterator const& other) const {
+                    return columnIt != other.columnIt;
+                }
+
+            private:
+                column_type const* columnIt;
+                value_type const* valueIt;
+            };
+
+            /*!
+             * This class represents a number of consecutive rows of the matrix.
+             */
+            class const_rows {
+            public:
+                const_rows(const_iterator begin, index_type entryCount) : beginIterator(begin), entryCount(entryCount) {
+                    // Intentionally left empty.
+                }
+
+                const_iterator begin() const {
+                    return beginIterator;
+                }
+
+                const_iterator end() const {
+                    return beginIterator + entryCount;
+                }
+
+                index_type getNumberOfEntries() const {
+                    return entryCount;
+                }
+
+            private:
+                const_iterator beginIterator;
+                index_type entryCount;
+            };
+
+            /*!
+             * Creates a compact copy of the given matrix.
+             *
+             * @param matrix The matrix to copy. Its column count must be representable by a 32-bit index.
+             */
+            explicit CompactSparseMatrix(SparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Creates a compact matrix from the given matrix. The storage of the given matrix is released after the
+             * conversion.
+             *
+             * @param matrix The matrix to convert. Its column count must be representable by a 32-bit index.
+             */
+            explicit CompactSparseMatrix(SparseMatrix<ValueType>&& matrix);
+
+            CompactSparseMatrix(CompactSparseMatrix const& other) = default;
+            CompactSparseMatrix& operator=(CompactSparseMatrix const& other) = default;
+            CompactSparseMatrix(CompactSparseMatrix&& other) = default;
+            CompactSparseMatrix& operator=(CompactSparseMatrix&& other) = default;
+
+            /*!
+             * Checks whether the given matrix can be stored in the compact format.
+             *
+             * @param matrix The matrix to check.
+             * @return True iff the number of columns of the matrix can be represented by a 32-bit index.
+             */
+            static bool isRepresentable(SparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Converts the matrix back to the standard sparse matrix format.
+             *
+             * @return A sparse matrix with the same entries and row grouping.
+             */
+            SparseMatrix<ValueType> toSparseMatrix() const;
+
+            /*!
+             * Returns the number of rows of the matrix.
+             *
+             * @return The number of rows of the matrix.
+             */
+            index_type getRowCount() const;
+
+            /*!
+             * Returns the number of columns of the matrix.
+             *
+             * @return The number of columns of the matrix.
+             */
+            index_type getColumnCount() const;
+
+            /*!
+             * Returns the number of entries in the matrix.
+             *
+             * @return The number of entries in the matrix.
+             */
+            index_type getEntryCount() const;
+
+            /*!
+             * Returns the number of row groups in the matrix.
+             *
+             * @return The number of row groups in the matrix.
+             */
+            index_type getRowGroupCount() const;
+
+            /*!
+             * Returns the grouping of rows of this matrix.
+             *
+             * @return The grouping of rows of this matrix.
+             */
+            std::vector<index_type> const& getRowGroupIndices() const;
+
+            /*!
+             * Retrieves whether the matrix has a trivial row grouping.
+             *
+             * @return True iff the matrix has a trivial row grouping.
+             */
+            bool hasTrivialRowGrouping() const;
+
+            /*!
+             * Returns an object representing the given row.
+             *
+             * @param row The row to get.
+             * @return An object representing the given row.
+             */
+            const_rows getRow(index_type row) const;
+
+            /*!
+             * Returns an object representing the given row group.
+             *
+             * @param rowGroup The row group to get.
+             * @return An object representing the given row group.
+             */
+            const_rows getRowGroup(index_type rowGroup) const;
+
+            /*!
+             * Retrieves an iterator that points to the beginning of the given row.
+             *
+             * @param row The row to the beginning of which the iterator has to point.
+             * @return An iterator that points to the beginning of the given row.
+             */
+            const_iterator begin(index_type row = 0) const;
+
+            /*!
+             * Retrieves an iterator that points past the end of the given row.
+             *
+             * @param row The row past the end of which the iterator has to point.
+             * @return An iterator that points past the end of the given row.
+             */
+            const_iterator end(index_type row) const;
+
+            /*!
+             * Retrieves an iterator that points past the end of the last row of the matrix.
+             *
+             * @return An iterator that points past the end of the last row of the matrix.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the column indices of all entries (ordered row by row).
+             *
+             * @return The column indices of all entries.
+             */
+            std::vector<column_type> const& getColumns() const;
+
+            /*!
+             * Retrieves the values of all entries (ordered row by row).
+             *
+             * @return The values of all entries.
+             */
+            std::vector<value_type> const& getValues() const;
+
+            /*!
+             * Retrieves the indices at which the rows start in the column and value arrays. The last element is the
+             * number of entries.
+             *
+             * @return The row indications.
+             */
+            std::vector<index_type> const& getRowIndications() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector processing the rows from first to last. If vector and
+             * result are the same, this performs a Gauss-Seidel style update.
+             */
+            void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the rows startRow, ..., endRow - 1 of the matrix with the given vector. As the rows only write
+             * to their own positions of the result, calls for disjoint ranges of rows can be made concurrently.
+             *
+             * @param startRow The first row to multiply.
+             * @param endRow The row after the last row to multiply.
+             * @param vector The vector with which to multiply the matrix. It must not be the same as the result vector.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector processing the rows from last to first. If vector and
+             * result are the same, this performs a Gauss-Seidel style update.
+             */
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
+             * the result to the given result vector.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector. Note
+             * that previous choices are only updated if the new value is strictly better.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Same as multiplyAndReduce, but processes the row groups from first to last. If vector and result are
+             * the same, this performs a Gauss-Seidel style update.
+             */
+            void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Same as multiplyAndReduce, but processes the row groups from last to first. If vector and result are
+             * the same, this performs a Gauss-Seidel style update.
+             */
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Same as multiplyAndReduce, but only considers the row groups startRowGroup, ..., endRowGroup - 1. The
+             * results are written to the corresponding positions of the result vector, so calls for disjoint ranges of
+             * row groups can be made concurrently.
+             */
+            void multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Multiplies a single row of the matrix with the given vector and returns the result.
+             *
+             * @param row The index of the row with which to multiply.
+             * @param vector The vector with which to multiply the row.
+             * @return The result of the multiplication.
+             */
+            value_type multiplyRowWithVector(index_type row, std::vector<value_type> const& vector) const;
+
+        private:
+            friend class SparseMatrixBuilder<ValueType>;
+            
+            /*!
+             * Creates a matrix from the given (finalized) arrays. This is used by the matrix builder.
+             */
+            CompactSparseMatrix(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<column_type>&& columns, std::vector<value_type>&& values, boost::optional<std::vector<index_type>>&& rowGroupIndices);
+            
+            template<typename Compare>
+            void multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename Compare>
+            void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // The column of each entry of the matrix.
+            std::vector<column_type> columns;
+
+            // The value of each entry of the matrix. The i-th value belongs to the i-th column index.
+            std::vector<value_type> values;
+
+            // A vector containing the indices at which each given row begins in the column and value vectors.
+            std::vector<index_type> rowIndications;
+
+            // A flag indicating whether the matrix has a trivial row grouping.
+            bool trivialRowGrouping;
+
+            // A vector indicating the row groups of the matrix. This needs to be mutable in case we create it on-the-fly.
+            mutable boost::optional<std::vector<index_type>> rowGroupIndices;
+        };
+
+    } // namespace storage
+} // namespace storm
+
+#endif // STORM_STORAGE_COMPACTSPARSEMATRIX_H_
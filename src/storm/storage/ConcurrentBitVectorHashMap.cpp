@@ -0,0 +1,306 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // The states of a bucket, which are stored in the lowest two bits of its control word. A bucket is
+            // reserved by a thread (busy) before its key and value are written and becomes ready afterwards. Buckets
+            // whose content was copied to the next table are moved.
+            uint64_t const stateMask = 3;
+            uint64_t const emptyState = 0;
+            uint64_t const busyState = 1;
+            uint64_t const readyState = 2;
+            uint64_t const movedState = 3;
+
+            // The control word of a bucket whose insertion failed. It has no fingerprint, so it never matches a key,
+            // but it keeps the probe sequences of other keys intact.
+            uint64_t const abandonedBucket = readyState;
+
+            // A bit that is set in all fingerprints, so that the control word of a non-empty bucket is never just
+            // its state.
+            uint64_t const fingerprintFlag = 4;
+
+            // The number of buckets that a thread migrates at once.
+            uint64_t const migrationChunkSize = 1024;
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t sizeExponent, uint64_t bucketSize) : sizeExponent(sizeExponent), control(new std::atomic<uint64_t>[1ull << sizeExponent]), keys(bucketSize * (1ull << sizeExponent)), values(1ull << sizeExponent), next(nullptr), nextChunk(0), migratedChunks(0) {
+            for (uint64_t bucket = 0; bucket < (1ull << sizeExponent); ++bucket) {
+                control[bucket].store(emptyState, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+            uint64_t sizeExponent = 1;
+            while (initialSize > 0) {
+                ++sizeExponent;
+                initialSize >>= 1;
+            }
+
+            currentTable.store(new Table(sizeExponent, bucketSize));
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            // The retired tables are freed with their owner. If a migration was interrupted, the current table still
+            // has a successor.
+            Table* table = currentTable.load();
+            delete table->next.load();
+            delete table;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::computeFingerprint(storm::storage::BitVector const& key) const {
+            return (hasher(key) & ~stateMask) | fingerprintFlag;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(Table const& table, uint64_t fingerprint) {
+            return fingerprint >> (64 - table.sizeExponent);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::SearchResult ConcurrentBitVectorHashMap<ValueType, Hash>::search(Table const& table, storm::storage::BitVector const& key, uint64_t fingerprint, uint64_t& bucket, ValueType& value) const {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t mask = (1ull << table.sizeExponent) - 1;
+            bucket = getInitialBucket(table, fingerprint);
+
+            for (uint64_t probes = 0; probes <= mask; ++probes, bucket = (bucket + 1) & mask) {
+                uint64_t word = table.control[bucket].load(std::memory_order_acquire);
+
+                // If another thread is currently inserting a key with the same fingerprint, we need to wait until
+                // we can compare the keys. Buckets with a different fingerprint can be skipped right away.
+                while ((word & stateMask) == busyState && (word & ~stateMask) == fingerprint) {
+                    std::this_thread::yield();
+                    word = table.control[bucket].load(std::memory_order_acquire);
+                }
+
+                if (word == emptyState) {
+                    return SearchResult::Empty;
+                } else if (word == movedState) {
+                    return SearchResult::Moved;
+                } else if ((word & ~stateMask) == fingerprint && (word & stateMask) != busyState && table.keys.matches(bucket * bucketSize, key)) {
+                    value = table.values[bucket];
+                    return SearchResult::Found;
+                }
+            }
+
+            // If we get here, there was not a single empty bucket.
+            return SearchResult::Moved;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrInsert(key, [&value] () { return value; }).first;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrGenerate(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator) {
+            return findOrInsert(key, valueGenerator);
+        }
+
+        template<class ValueType, class Hash>
+        template<typename ValueGenerator>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrInsert(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator) {
+            uint64_t fingerprint = computeFingerprint(key);
+
+            while (true) {
+                Table* table = currentTable.load(std::memory_order_acquire);
+                uint64_t bucket;
+                ValueType value;
+                SearchResult result = search(*table, key, fingerprint, bucket, value);
+                if (result == SearchResult::Found) {
+                    return std::make_pair(value, false);
+                }
+
+                if (result == SearchResult::Empty) {
+                    checkIncreaseSize(*table);
+                }
+
+                // New keys are only inserted into tables that are not being migrated.
+                if (table->next.load(std::memory_order_acquire) != nullptr) {
+                    helpMigrate(*table);
+                    continue;
+                } else if (result != SearchResult::Empty) {
+                    // The table is full, so we need to increase its size.
+                    Table* newTable = new Table(table->sizeExponent + 1, bucketSize);
+                    Table* expected = nullptr;
+                    if (!table->next.compare_exchange_strong(expected, newTable, std::memory_order_acq_rel)) {
+                        delete newTable;
+                    }
+                    continue;
+                }
+
+                // Try to reserve the empty bucket. If another thread was faster, we need to search again.
+                uint64_t expected = emptyState;
+                if (!table->control[bucket].compare_exchange_strong(expected, fingerprint | busyState, std::memory_order_acq_rel)) {
+                    continue;
+                }
+                table->keys.set(bucket * bucketSize, key);
+                try {
+                    value = valueGenerator();
+                } catch (...) {
+                    // Abandon the bucket, so that other threads do not wait for it forever.
+                    table->control[bucket].store(abandonedBucket, std::memory_order_release);
+                    throw;
+                }
+                table->values[bucket] = value;
+                table->control[bucket].store(fingerprint | readyState, std::memory_order_release);
+                numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                return std::make_pair(value, true);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            uint64_t fingerprint = computeFingerprint(key);
+            uint64_t bucket;
+            ValueType value;
+
+            // No key is inserted into an empty bucket after it was marked as moved. Hence, reaching such a bucket
+            // means that the key was not contained in the map when the bucket was migrated.
+            Table const* table = currentTable.load(std::memory_order_acquire);
+            if (search(*table, key, fingerprint, bucket, value) == SearchResult::Found) {
+                return std::make_pair(true, value);
+            }
+            return std::make_pair(false, ValueType());
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return find(key).first;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load();
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << currentTable.load()->sizeExponent;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const {
+            Table const& table = *currentTable.load();
+            for (uint64_t bucket = 0; bucket < (1ull << table.sizeExponent); ++bucket) {
+                uint64_t word = table.control[bucket].load();
+                if (word != emptyState && word != movedState && word != abandonedBucket) {
+                    function(table.keys.get(bucket * bucketSize, bucketSize), table.values[bucket]);
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::releaseRetiredTables() {
+            std::lock_guard<std::mutex> lock(retiredTablesMutex);
+            retiredTables.clear();
+            retiredTables.shrink_to_fit();
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getNumberOfRetiredTables() const {
+            std::lock_guard<std::mutex> lock(retiredTablesMutex);
+            return retiredTables.size();
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::checkIncreaseSize(Table& table) {
+            // If the load of the map is too high, we increase the size.
+            if (numberOfElements.load(std::memory_order_relaxed) >= loadFactor * (1ull << table.sizeExponent) && table.next.load(std::memory_order_acquire) == nullptr) {
+                STORM_LOG_TRACE("Increasing size of concurrent hash map from " << (1ull << table.sizeExponent) << " to " << (1ull << (table.sizeExponent + 1)) << ".");
+                Table* newTable = new Table(table.sizeExponent + 1, bucketSize);
+                Table* expected = nullptr;
+                if (!table.next.compare_exchange_strong(expected, newTable, std::memory_order_acq_rel)) {
+                    delete newTable;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::helpMigrate(Table& table) {
+            uint64_t numberOfBuckets = 1ull << table.sizeExponent;
+            uint64_t numberOfChunks = (numberOfBuckets + migrationChunkSize - 1) / migrationChunkSize;
+            for (uint64_t chunk = table.nextChunk.fetch_add(1); chunk < numberOfChunks; chunk = table.nextChunk.fetch_add(1)) {
+                uint64_t endBucket = std::min(numberOfBuckets, (chunk + 1) * migrationChunkSize);
+                for (uint64_t bucket = chunk * migrationChunkSize; bucket < endBucket; ++bucket) {
+                    migrateBucket(table, bucket);
+                }
+
+                // The thread that completes the last chunk makes the next table the current one and retires the old
+                // one. No other thread touches the retired table afterwards except for reading.
+                if (table.migratedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == numberOfChunks) {
+                    {
+                        std::lock_guard<std::mutex> lock(retiredTablesMutex);
+                        retiredTables.emplace_back(&table);
+                    }
+                    currentTable.store(table.next.load(std::memory_order_acquire), std::memory_order_release);
+                }
+            }
+
+            // Wait for the other threads to finish their chunks.
+            while (currentTable.load(std::memory_order_acquire) == &table) {
+                std::this_thread::yield();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::migrateBucket(Table& table, uint64_t bucket) {
+            Table& next = *table.next.load(std::memory_order_acquire);
+            while (true) {
+                uint64_t word = table.control[bucket].load(std::memory_order_acquire);
+                uint64_t state = word & stateMask;
+                if (state == busyState) {
+                    // Wait for the inserting thread.
+                    std::this_thread::yield();
+                    continue;
+                } else if (state == emptyState) {
+                    // Mark the empty bucket as moved, so that no key is inserted there anymore.
+                    if (table.control[bucket].compare_exchange_strong(word, movedState, std::memory_order_acq_rel)) {
+                        return;
+                    }
+                    continue;
+                } else if (state == movedState || word == abandonedBucket) {
+                    // Nothing needs to be copied.
+                    return;
+                }
+
+                // Copy the key to the next table. As the next table is only filled by the migration and every key
+                // occurs only once, the first empty bucket is the right one.
+                uint64_t fingerprint = word & ~stateMask;
+                uint64_t mask = (1ull << next.sizeExponent) - 1;
+                uint64_t target = getInitialBucket(next, fingerprint);
+                uint64_t expected = emptyState;
+                while (!next.control[target].compare_exchange_weak(expected, fingerprint | busyState, std::memory_order_acq_rel)) {
+                    if (expected != emptyState) {
+                        target = (target + 1) & mask;
+                    }
+                    expected = emptyState;
+                }
+                for (uint64_t offset = 0; offset < bucketSize; offset += 64) {
+                    next.keys.setFromInt(target * bucketSize + offset, 64, table.keys.getAsInt(bucket * bucketSize + offset, 64));
+                }
+                next.values[target] = table.values[bucket];
+                next.control[target].store(fingerprint | readyState, std::memory_order_release);
+
+                // The bucket keeps its key and value, so threads that still search the old table find it.
+                table.control[bucket].store(fingerprint | movedState, std::memory_order_release);
+                return;
+            }
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,222 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by several
+         * threads at the same time. Like the BitVectorHashMap, it only supports queries and insertions and the keys
+         * must be bit vectors with a length that is a multiple of 64.
+         *
+         * Every bucket has a control word that holds the state of the bucket and a fingerprint of the hash value of
+         * its key. Keys are inserted by reserving an empty bucket with a compare-and-swap on the control word, so no
+         * locks are needed. Comparing the fingerprint first avoids most of the comparisons of full keys and the wait
+         * for buckets that are currently being filled by another thread.
+         *
+         * When the load factor is exceeded, a table of twice the size is allocated and the buckets are migrated to it
+         * in chunks. Threads that only look up existing keys are not delayed by the migration, whereas threads that
+         * need to insert a key help migrating the remaining chunks before they insert into the new table. Previous
+         * tables may still be read by other threads, so they are only freed by releaseRetiredTables (which must be
+         * called while no other thread accesses the map) or when the map is destroyed.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of buckets that is initially available.
+             * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+             * increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value. This method may be called concurrently.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the value obtained from the given generator. The generator is called at most once
+             * and only if the key is inserted, so it may for example draw the next free index from an atomic counter.
+             * This method may be called concurrently.
+             *
+             * @param key The key to search or insert.
+             * @param valueGenerator A function that yields the value of a newly inserted key.
+             * @return A pair whose first component is the value associated with the key and whose second component
+             * indicates whether the key was inserted by this call.
+             */
+            std::pair<ValueType, bool> findOrGenerate(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+            /*!
+             * Searches for the given key in the map. This method may be called concurrently (also with insertions).
+             *
+             * @param key The key to search.
+             * @return A pair whose first component indicates whether the key was found and whose second component is
+             * the value associated with the key (if it was found).
+             */
+            std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Checks if the given key is already contained in the map. This method may be called concurrently.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the capacity of the current table.
+             *
+             * @return The capacity of the current table.
+             */
+            uint64_t capacity() const;
+
+            /*!
+             * Calls the given function for all key-value pairs of the map. This method must not be called while the
+             * map is modified.
+             *
+             * @param function The function to call.
+             */
+            void forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const;
+
+            /*!
+             * Frees the tables that were replaced by larger ones. This method must not be called while the map is
+             * accessed by other threads, e.g. it can be called after all threads that inserted keys were joined.
+             */
+            void releaseRetiredTables();
+
+            /*!
+             * Retrieves the number of tables that were replaced by larger ones, but were not yet freed.
+             *
+             * @return The number of retired tables.
+             */
+            uint64_t getNumberOfRetiredTables() const;
+
+        private:
+            /*!
+             * One table of the map. During a resize, the buckets of a table are migrated to its successor table.
+             */
+            struct Table {
+                Table(uint64_t sizeExponent, uint64_t bucketSize);
+
+                // The number of buckets is 2^sizeExponent.
+                uint64_t sizeExponent;
+
+                // The control words of the buckets. The lowest two bits hold the state of the bucket and the
+                // remaining bits the fingerprint of the key.
+                std::unique_ptr<std::atomic<uint64_t>[]> control;
+
+                // The keys of the buckets.
+                storm::storage::BitVector keys;
+
+                // The mapped-to values. The entry at position i is the "target" of the key in bucket i.
+                std::vector<ValueType> values;
+
+                // The table to which the buckets are migrated (if any).
+                std::atomic<Table*> next;
+
+                // The next chunk that is to be migrated and the number of chunks whose migration is complete.
+                std::atomic<uint64_t> nextChunk;
+                std::atomic<uint64_t> migratedChunks;
+            };
+
+            /*!
+             * The result of searching a key in a table.
+             */
+            enum class SearchResult { Found, Empty, Moved };
+
+            /*!
+             * Computes the fingerprint of the given key, i.e. its hash value with the lowest two bits cleared.
+             */
+            uint64_t computeFingerprint(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Determines the bucket at which the search for a key with the given fingerprint starts.
+             */
+            static uint64_t getInitialBucket(Table const& table, uint64_t fingerprint);
+
+            /*!
+             * Searches for the key in the given table. If the key is found or an empty bucket is reached, the bucket
+             * is written to the given reference. If the key was found, the value is written to the given reference.
+             * The search also ends (with result Moved) when an empty bucket that was already migrated to the next table
+             * is reached or when the table has no empty bucket at all.
+             */
+            SearchResult search(Table const& table, storm::storage::BitVector const& key, uint64_t fingerprint, uint64_t& bucket, ValueType& value) const;
+
+            /*!
+             * Implements findOrAdd and findOrGenerate for the given kind of value generator.
+             */
+            template<typename ValueGenerator>
+            std::pair<ValueType, bool> findOrInsert(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator);
+
+            /*!
+             * Checks whether the current table is too full and, if so, creates the next table (if none exists).
+             */
+            void checkIncreaseSize(Table& table);
+
+            /*!
+             * Helps migrating the given table to its next table and returns once the migration is complete.
+             */
+            void helpMigrate(Table& table);
+
+            /*!
+             * Migrates the bucket with the given index to the next table.
+             */
+            void migrateBucket(Table& table, uint64_t bucket);
+
+            // The load factor determining when the size of the map is increased.
+            double loadFactor;
+
+            // The size of one bucket.
+            uint64_t bucketSize;
+
+            // The table into which new keys are inserted. The map owns this table and its next table (if any).
+            std::atomic<Table*> currentTable;
+
+            // The tables that were replaced by larger ones, but might still be read by other threads.
+            std::vector<std::unique_ptr<Table>> retiredTables;
+
+            // A mutex guarding the retired tables.
+            mutable std::mutex retiredTablesMutex;
+
+            // The number of elements in this map.
+            std::atomic<uint64_t> numberOfElements;
+
+            // Functor object that are used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
@@ -1,7 +1,9 @@
 #include <boost/functional/hash.hpp>
+#include <boost/filesystem.hpp>
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
@@ -14,10 +16,12 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
+#include "storm/exceptions/FileIoException.h"
 
 #include "storm/utility/macros.h"
 
 #include <iterator>
+#include <fstream>
 
 namespace storm {
     namespace storage {
@@ -80,7 +84,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0), outOfCoreStorage(nullptr), maximalNumberOfBufferedEntries(0), numberOfEntriesStoredOutOfCore(0) {
             // Prepare the internal storage.
             if (initialRowCountSet) {
                 rowIndications.reserve(initialRowCount + 1);
@@ -98,7 +102,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount() {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount(), outOfCoreStorage(nullptr), maximalNumberOfBufferedEntries(0), numberOfEntriesStoredOutOfCore(0) {
             
             lastRow = matrix.rowCount == 0 ? 0 : matrix.rowCount - 1;
             lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
@@ -134,7 +138,13 @@ namespace storm {
             } else {
                 // If we switched to another row, we have to adjust the missing entries in the row indices vector.
                 if (row != lastRow) {
-                    // Otherwise, we need to push the correct values to the vectors, which might trigger reallocations.
+                    // As all entries held in memory belong to completed rows, this is the point to move them to the
+                    // temporary file (if necessary).
+                    if (outOfCoreStorage && columnsAndValues.size() >= maximalNumberOfBufferedEntries) {
+                        writeEntriesOutOfCore();
+                    }
+                    
+                    // Then, we need to push the correct values to the vectors, which might trigger reallocations.
                     for (index_type i = lastRow + 1; i <= row; ++i) {
                         rowIndications.push_back(currentEntryCount);
                     }
@@ -152,12 +162,13 @@ namespace storm {
                 // If we need to fix the row, do so now.
                 if (fixCurrentRow) {
                     // First, we sort according to columns.
-                    std::sort(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    auto rowStart = columnsAndValues.begin() + (rowIndications.back() - numberOfEntriesStoredOutOfCore);
+                    std::sort(rowStart, columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() < b.getColumn();
                     });
                     
                     // Then, we eliminate possible duplicate entries.
-                    auto it = std::unique(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    auto it = std::unique(rowStart, columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() == b.getColumn();
                     });
                     
@@ -199,7 +210,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+        typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueType>::finalizeDimensions(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
             
             bool hasEntries = currentEntryCount != 0;
             
@@ -257,9 +268,74 @@ namespace storm {
                 }
             }
             
+            return columnCount;
+        }
+        
+        template<typename ValueType>
+        SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+            index_type columnCount = finalizeDimensions(overriddenRowCount, overriddenColumnCount, overriddenRowGroupCount);
+            
+            if (outOfCoreStorage && numberOfEntriesStoredOutOfCore > 0) {
+                // Move the entries held in memory to the temporary file as well and release the buffer, such that the
+                // storage of the matrix is the only allocation that holds all entries.
+                releaseEntriesOutOfCore();
+                STORM_LOG_ASSERT(numberOfEntriesStoredOutOfCore == currentEntryCount, "Unexpected number of entries in the temporary file.");
+                
+                // Every run of the file consists of complete rows and the runs were written in the order of the rows,
+                // so the runs are streamed into the storage of the matrix one after the other.
+                columnsAndValues.resize(numberOfEntriesStoredOutOfCore);
+                index_type offset = 0;
+                for (auto const& runSize : outOfCoreStorage->getRunSizes()) {
+                    outOfCoreStorage->read(columnsAndValues.data() + offset, offset, runSize);
+                    offset += runSize;
+                }
+            }
+            outOfCoreStorage = nullptr;
+            numberOfEntriesStoredOutOfCore = 0;
+            
             return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
         }
         
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::buildCompact(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+            typedef typename CompactSparseMatrix<ValueType>::column_type column_type;
+            index_type columnCount = finalizeDimensions(overriddenRowCount, overriddenColumnCount, overriddenRowGroupCount);
+            STORM_LOG_THROW(columnCount <= static_cast<index_type>(std::numeric_limits<column_type>::max()) + 1, storm::exceptions::InvalidArgumentException, "The matrix has too many columns to be stored with 32-bit column indices.");
+            
+            // Split the entries directly into the separate column and value arrays, without creating a (full-sized)
+            // intermediate matrix.
+            std::vector<column_type> columns;
+            std::vector<value_type> values;
+            columns.reserve(currentEntryCount);
+            values.reserve(currentEntryCount);
+            auto splitEntries = [&columns, &values] (MatrixEntry<index_type, value_type> const* entry, MatrixEntry<index_type, value_type> const* end) {
+                for (; entry != end; ++entry) {
+                    columns.push_back(static_cast<column_type>(entry->getColumn()));
+                    values.push_back(entry->getValue());
+                }
+            };
+            
+            // The entries in the temporary file are read in chunks of the size of the in-memory buffer, which is
+            // released beforehand.
+            if (outOfCoreStorage && numberOfEntriesStoredOutOfCore > 0) {
+                releaseEntriesOutOfCore();
+                std::vector<MatrixEntry<index_type, value_type>> chunk(std::min(maximalNumberOfBufferedEntries, numberOfEntriesStoredOutOfCore));
+                for (index_type offset = 0; offset < numberOfEntriesStoredOutOfCore; offset += chunk.size()) {
+                    index_type chunkSize = std::min<index_type>(chunk.size(), numberOfEntriesStoredOutOfCore - offset);
+                    outOfCoreStorage->read(chunk.data(), offset, chunkSize);
+                    splitEntries(chunk.data(), chunk.data() + chunkSize);
+                }
+            }
+            outOfCoreStorage = nullptr;
+            numberOfEntriesStoredOutOfCore = 0;
+            splitEntries(columnsAndValues.data(), columnsAndValues.data() + columnsAndValues.size());
+            
+            // Release the entries of the builder.
+            std::vector<MatrixEntry<index_type, value_type>>().swap(columnsAndValues);
+            
+            return CompactSparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columns), std::move(values), std::move(rowGroupIndices));
+        }
+        
         template<typename ValueType>
         typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueType>::getLastRow() const {
             return lastRow;
@@ -279,6 +355,97 @@ namespace storm {
             return lastColumn;
         }
         
+        template<typename ValueType>
+        class SparseMatrixBuilder<ValueType>::OutOfCoreStorage {
+        public:
+            /*!
+             * Creates a new temporary file in the given directory (or the system's temporary directory if the
+             * directory is empty).
+             */
+            OutOfCoreStorage(std::string const& directory) {
+                boost::filesystem::path parentDirectory = directory.empty() ? boost::filesystem::temp_directory_path() : boost::filesystem::path(directory);
+                path = parentDirectory / boost::filesystem::unique_path("storm-matrix-%%%%-%%%%-%%%%-%%%%.tmp");
+                stream.open(path.string(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+                STORM_LOG_THROW(stream.is_open(), storm::exceptions::FileIoException, "Unable to create temporary file " << path << " for the matrix entries.");
+                STORM_LOG_DEBUG("Storing matrix entries in temporary file " << path << ".");
+            }
+            
+            /*!
+             * Closes and removes the temporary file.
+             */
+            ~OutOfCoreStorage() {
+                stream.close();
+                boost::system::error_code error;
+                boost::filesystem::remove(path, error);
+            }
+            
+            /*!
+             * Appends the given entries to the file as a new run.
+             */
+            void write(MatrixEntry<index_type, value_type> const* entries, uint64_t count) {
+                stream.write(reinterpret_cast<char const*>(entries), count * sizeof(MatrixEntry<index_type, value_type>));
+                STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to write matrix entries to temporary file " << path << ".");
+                runSizes.push_back(count);
+            }
+            
+            /*!
+             * Retrieves the number of entries of each run in the order in which the runs were written.
+             */
+            std::vector<uint64_t> const& getRunSizes() const {
+                return runSizes;
+            }
+            
+            /*!
+             * Reads the given number of entries starting at the entry with the given index.
+             */
+            void read(MatrixEntry<index_type, value_type>* entries, uint64_t offset, uint64_t count) {
+                stream.flush();
+                stream.seekg(offset * sizeof(MatrixEntry<index_type, value_type>));
+                stream.read(reinterpret_cast<char*>(entries), count * sizeof(MatrixEntry<index_type, value_type>));
+                STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to read matrix entries from temporary file " << path << ".");
+            }
+            
+        private:
+            boost::filesystem::path path;
+            std::fstream stream;
+            std::vector<uint64_t> runSizes;
+        };
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::enableOutOfCoreStorage(std::string const& directory, index_type maximalNumberOfBufferedEntries) {
+            STORM_LOG_THROW(std::is_trivially_copyable<value_type>::value, storm::exceptions::NotSupportedException, "Storing matrix entries out-of-core is not supported for this value type.");
+            STORM_LOG_THROW(!outOfCoreStorage, storm::exceptions::InvalidStateException, "The out-of-core storage was already enabled.");
+            outOfCoreStorage = std::make_shared<OutOfCoreStorage>(directory);
+            this->maximalNumberOfBufferedEntries = std::max<index_type>(1, maximalNumberOfBufferedEntries);
+            
+            // There is no need to reserve more memory than the number of entries that are held in memory at once.
+            if (initialEntryCountSet) {
+                columnsAndValues.reserve(std::min(initialEntryCount, this->maximalNumberOfBufferedEntries));
+            }
+        }
+        
+        template<typename ValueType>
+        typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueType>::getNumberOfEntriesStoredOutOfCore() const {
+            return numberOfEntriesStoredOutOfCore;
+        }
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::writeEntriesOutOfCore() {
+            outOfCoreStorage->write(columnsAndValues.data(), columnsAndValues.size());
+            numberOfEntriesStoredOutOfCore += columnsAndValues.size();
+            
+            // Clearing the vector keeps its capacity, so no reallocations are necessary for the next entries.
+            columnsAndValues.clear();
+        }
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::releaseEntriesOutOfCore() {
+            if (!columnsAndValues.empty()) {
+                writeEntriesOutOfCore();
+            }
+            std::vector<MatrixEntry<index_type, value_type>>().swap(columnsAndValues);
+        }
+        
         // Debug method for printing the current matrix
         template<typename ValueType>
         void print(std::vector<typename SparseMatrix<ValueType>::index_type> const& rowGroupIndices, std::vector<MatrixEntry<typename SparseMatrix<ValueType>::index_type, typename SparseMatrix<ValueType>::value_type>> const& columnsAndValues, std::vector<typename SparseMatrix<ValueType>::index_type> const& rowIndications) {
@@ -303,6 +470,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
+            STORM_LOG_THROW(numberOfEntriesStoredOutOfCore == 0, storm::exceptions::NotSupportedException, "Unable to replace columns of entries that were written to a temporary file.");
             index_type maxColumn = 0;
             
             for (index_type row = 0; row < rowIndications.size(); ++row) {
@@ -1480,14 +1648,19 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
-            const_iterator it = this->begin();
+            this->multiplyWithVectorRange(0, result.size(), vector, result, summand);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            const_iterator it = this->begin(startRow);
             const_iterator ite;
-            std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
-            typename std::vector<ValueType>::iterator resultIterator = result.begin();
-            typename std::vector<ValueType>::iterator resultIteratorEnd = result.end();
+            std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
+            typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
+            typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
             typename std::vector<ValueType>::const_iterator summandIterator;
             if (summand) {
-                summandIterator = summand->begin();
+                summandIterator = summand->begin() + startRow;
             }
             
             for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator, ++summandIterator) {
@@ -1681,25 +1854,40 @@ namespace storm {
         template<typename ValueType>
         template<typename Compare>
         void SparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRange<Compare>(rowGroupIndices, 0, result.size(), vector, summand, result, choices);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceRange<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceRange<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             Compare compare;
-            auto elementIt = this->begin();
-            auto rowGroupIt = rowGroupIndices.begin();
-            auto rowIt = rowIndications.begin();
+            auto rowGroupIt = rowGroupIndices.begin() + startRowGroup;
+            auto rowIt = rowIndications.begin() + *rowGroupIt;
+            auto elementIt = this->begin() + *rowIt;
             typename std::vector<ValueType>::const_iterator summandIt;
             if (summand) {
-                summandIt = summand->begin();
+                summandIt = summand->begin() + *rowGroupIt;
             }
             typename std::vector<uint_fast64_t>::iterator choiceIt;
             if (choices) {
-                choiceIt = choices->begin();
+                choiceIt = choices->begin() + startRowGroup;
             }
             
             // Variables for correctly tracking choices (only update if new choice is strictly better).
             ValueType oldSelectedChoiceValue;
             uint64_t selectedChoice;
             
-            uint64_t currentRow = 0;
-            for (auto resultIt = result.begin(), resultIte = result.end(); resultIt != resultIte; ++resultIt, ++choiceIt, ++rowGroupIt) {
+            uint64_t currentRow = *rowGroupIt;
+            for (auto resultIt = result.begin() + startRowGroup, resultIte = result.begin() + endRowGroup; resultIt != resultIte; ++resultIt, ++choiceIt, ++rowGroupIt) {
                 ValueType currentValue = storm::utility::zero<ValueType>();
                 
                 // Only multiply and reduce if there is at least one row in the group.
@@ -1758,6 +1946,11 @@ namespace storm {
         void SparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
         }
+        
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
 #endif
         
         template<typename ValueType>
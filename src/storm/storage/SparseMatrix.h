@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <vector>
 #include <iterator>
+#include <memory>
 
 #include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
@@ -37,10 +38,13 @@ namespace storm {
         
         class BitVector;
         
-        // Forward declare matrix class.
+        // Forward declare matrix classes.
         template<typename T>
         class SparseMatrix;
         
+        template<typename T>
+        class CompactSparseMatrix;
+        
         typedef uint_fast64_t SparseMatrixIndexType;
         
         template<typename IndexType, typename ValueType>
@@ -213,6 +217,15 @@ namespace storm {
              */
             SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
             
+            /*!
+             * Finalizes the matrix like build() does, but returns it in the compact format that stores the columns
+             * as 32-bit indices separately from the values. The entries are split into the compact arrays directly
+             * (reading entries stored out-of-core in chunks), so no matrix in the standard format is created. Using
+             * the resulting matrix requires including CompactSparseMatrix.h. The arguments are the same as the ones
+             * of build().
+             */
+            CompactSparseMatrix<value_type> buildCompact(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+            
             /*!
              * Retrieves the most recently used row.
              * 
@@ -243,8 +256,53 @@ namespace storm {
              * @param offset Offset to add to each id in vector index.
              */
             void replaceColumns(std::vector<index_type> const& replacements, index_type offset);
+            
+            /*!
+             * Lets the builder store the entries of completed rows in a temporary file instead of keeping them in
+             * memory. Whenever the number of entries held in memory reaches the given number at the start of a new
+             * row, they are appended to the file as a new run. When the matrix is built, the remaining entries are
+             * appended as well and the runs are streamed into the storage of the matrix. As the built matrix is held
+             * in memory, this only lowers the peak memory consumption while the matrix is constructed (e.g. while the
+             * states of a model are explored).
+             *
+             * This is only possible if the entries can be copied bytewise (e.g. for double values). Once entries were
+             * written to the file, columns can no longer be replaced.
+             *
+             * @param directory The directory in which to create the temporary file. If empty, the system's temporary
+             * directory is used.
+             * @param maximalNumberOfBufferedEntries The number of entries that are held in memory before they are
+             * written to the file.
+             */
+            void enableOutOfCoreStorage(std::string const& directory = "", index_type maximalNumberOfBufferedEntries = 1ull << 22);
+            
+            /*!
+             * Retrieves the number of entries that are currently stored in the temporary file (see
+             * enableOutOfCoreStorage).
+             */
+            index_type getNumberOfEntriesStoredOutOfCore() const;
                         
         private:
+            /*!
+             * Completes the row indications and the row grouping as described for build() and checks the dimensions
+             * of the matrix.
+             *
+             * @return The number of columns of the matrix.
+             */
+            index_type finalizeDimensions(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount);
+            
+            /*!
+             * Writes all entries that are held in memory to the temporary file.
+             */
+            void writeEntriesOutOfCore();
+            
+            /*!
+             * Writes all entries that are held in memory to the temporary file and releases the memory they occupied.
+             */
+            void releaseEntriesOutOfCore();
+            
+            class OutOfCoreStorage;
+            
+
             // A flag indicating whether a row count was set upon construction.
             bool initialRowCountSet;
             
@@ -305,6 +363,16 @@ namespace storm {
             // Stores the currently active row group. This is used for correctly constructing the row grouping of the
             // matrix.
             index_type currentRowGroupCount;
+            
+            // The temporary file that stores the entries of completed rows if the out-of-core storage is enabled.
+            std::shared_ptr<OutOfCoreStorage> outOfCoreStorage;
+            
+            // The number of entries that is held in memory before the entries are written to the temporary file.
+            index_type maximalNumberOfBufferedEntries;
+            
+            // The number of entries that were written to the temporary file. The entries in columnsAndValues are the
+            // ones that follow these entries.
+            index_type numberOfEntriesStoredOutOfCore;
         };
         
         /*!
@@ -330,6 +398,7 @@ namespace storm {
             friend class storm::adapters::StormAdapter;
 			friend class storm::solver::TopologicalCudaValueIterationMinMaxLinearEquationSolver<ValueType>;
             friend class SparseMatrixBuilder<ValueType>;
+            friend class CompactSparseMatrix<ValueType>;
             
             typedef SparseMatrixIndexType index_type;
             typedef ValueType value_type;
@@ -870,6 +939,19 @@ namespace storm {
             
             void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
             void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Multiplies the rows startRow, ..., endRow - 1 of the matrix with the given vector and writes the results
+             * to the corresponding positions of the result vector. As calls for disjoint row ranges write to disjoint
+             * parts of the result, they can be made concurrently.
+             *
+             * @param startRow The first row to multiply.
+             * @param endRow The row after the last row to multiply.
+             * @param vector The vector with which to multiply the matrix. It must not be the same as the result vector.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 #ifdef STORM_HAVE_INTELTBB
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 #endif
@@ -897,6 +979,15 @@ namespace storm {
             void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
             template<typename Compare>
             void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            
+            /*!
+             * Same as multiplyAndReduce, but only considers the row groups startRowGroup, ..., endRowGroup - 1. The
+             * results are written to the corresponding positions of the result vector, so calls for disjoint ranges of
+             * row groups can be made concurrently.
+             */
+            void multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare>
+            void multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
 #ifdef STORM_HAVE_INTELTBB
             void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
             template<typename Compare>
@@ -0,0 +1,291 @@
+#include "storm/storage/SparseSubmatrixView.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        SparseSubmatrixView<ValueType>::SparseSubmatrixView(SparseMatrix<ValueType> const& matrix, bool useGroups, storm::storage::BitVector const& rowConstraint, storm::storage::BitVector const& columnConstraint) : matrix(matrix), useGroups(useGroups), rowConstraint(rowConstraint), columnConstraint(columnConstraint), columnCount(columnConstraint.getNumberOfSetBits()) {
+            STORM_LOG_THROW(columnConstraint.size() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException, "The column constraint has size " << columnConstraint.size() << " but the matrix has " << matrix.getColumnCount() << " columns.");
+
+            // Determine the selected rows and the row grouping of the submatrix.
+            rowGroupIndices.push_back(0);
+            if (useGroups) {
+                STORM_LOG_THROW(rowConstraint.size() == matrix.getRowGroupCount(), storm::exceptions::InvalidArgumentException, "The row group constraint has size " << rowConstraint.size() << " but the matrix has " << matrix.getRowGroupCount() << " row groups.");
+                std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+                for (auto const& rowGroup : rowConstraint) {
+                    for (index_type row = originalRowGroupIndices[rowGroup]; row < originalRowGroupIndices[rowGroup + 1]; ++row) {
+                        originalRows.push_back(row);
+                    }
+                    rowGroupIndices.push_back(originalRows.size());
+                }
+            } else {
+                STORM_LOG_THROW(rowConstraint.size() == matrix.getRowCount(), storm::exceptions::InvalidArgumentException, "The row constraint has size " << rowConstraint.size() << " but the matrix has " << matrix.getRowCount() << " rows.");
+                originalRows.assign(rowConstraint.begin(), rowConstraint.end());
+                if (matrix.hasTrivialRowGrouping()) {
+                    for (index_type row = 1; row <= originalRows.size(); ++row) {
+                        rowGroupIndices.push_back(row);
+                    }
+                } else {
+                    // Keep the row groups that contain at least one of the selected rows.
+                    std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+                    index_type rowGroup = 0;
+                    for (index_type row = 0; row < originalRows.size(); ++row) {
+                        index_type previousRowGroup = rowGroup;
+                        while (originalRowGroupIndices[rowGroup + 1] <= originalRows[row]) {
+                            ++rowGroup;
+                        }
+                        if (row > 0 && rowGroup != previousRowGroup) {
+                            rowGroupIndices.push_back(row);
+                        }
+                    }
+                    if (!originalRows.empty()) {
+                        rowGroupIndices.push_back(originalRows.size());
+                    }
+                }
+            }
+
+            // Count the selected columns before each block of 64 columns. Together with the column constraint, this
+            // determines the renumbering of the selected columns.
+            index_type numberOfBlocks = (columnConstraint.size() + 63) >> 6;
+            columnRanks.reserve(numberOfBlocks);
+            index_type selectedColumns = 0;
+            for (index_type block = 0; block < numberOfBlocks; ++block) {
+                columnRanks.push_back(selectedColumns);
+                index_type blockSize = std::min<index_type>(64, columnConstraint.size() - (block << 6));
+                selectedColumns += __builtin_popcountll(columnConstraint.getAsInt(block << 6, blockSize));
+            }
+        }
+
+        template<typename ValueType>
+        typename SparseSubmatrixView<ValueType>::index_type SparseSubmatrixView<ValueType>::getSubmatrixColumn(index_type column) const {
+            if (!columnConstraint.get(column)) {
+                return std::numeric_limits<index_type>::max();
+            }
+            index_type result = columnRanks[column >> 6];
+            index_type bitsBeforeColumn = column & 63;
+            if (bitsBeforeColumn > 0) {
+                result += __builtin_popcountll(columnConstraint.getAsInt(column - bitsBeforeColumn, bitsBeforeColumn));
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        typename SparseSubmatrixView<ValueType>::index_type SparseSubmatrixView<ValueType>::getRowCount() const {
+            return originalRows.size();
+        }
+
+        template<typename ValueType>
+        typename SparseSubmatrixView<ValueType>::index_type SparseSubmatrixView<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename SparseSubmatrixView<ValueType>::index_type SparseSubmatrixView<ValueType>::getRowGroupCount() const {
+            return rowGroupIndices.size() - 1;
+        }
+
+        template<typename ValueType>
+        std::vector<typename SparseSubmatrixView<ValueType>::index_type> const& SparseSubmatrixView<ValueType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> const& SparseSubmatrixView<ValueType>::getOriginalMatrix() const {
+            return matrix;
+        }
+
+        template<typename ValueType>
+        typename SparseSubmatrixView<ValueType>::index_type SparseSubmatrixView<ValueType>::getOriginalRow(index_type row) const {
+            return originalRows[row];
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> SparseSubmatrixView<ValueType>::toSparseMatrix(bool insertDiagonalEntries) const {
+            return matrix.getSubmatrix(useGroups, rowConstraint, columnConstraint, insertDiagonalEntries);
+        }
+
+        template<typename ValueType>
+        ValueType SparseSubmatrixView<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+            ValueType result = storm::utility::zero<ValueType>();
+            for (auto const& entry : matrix.getRow(originalRows[row])) {
+                index_type column = getSubmatrixColumn(entry.getColumn());
+                if (column != std::numeric_limits<index_type>::max()) {
+                    result += entry.getValue() * vector[column];
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            if (&vector == &result) {
+                std::vector<ValueType> temporary(result.size());
+                multiplyWithVectorRange(0, getRowCount(), vector, temporary, summand);
+                std::swap(result, temporary);
+            } else {
+                multiplyWithVectorRange(0, getRowCount(), vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "The input and the result vector must be different.");
+            for (index_type row = startRow; row < endRow; ++row) {
+                ValueType value = multiplyRowWithVector(row, vector);
+                if (summand) {
+                    value += (*summand)[row];
+                }
+                result[row] = std::move(value);
+            }
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            for (index_type row = 0; row < getRowCount(); ++row) {
+                ValueType value = multiplyRowWithVector(row, vector);
+                if (summand) {
+                    value += (*summand)[row];
+                }
+                result[row] = std::move(value);
+            }
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            for (index_type row = getRowCount(); row > 0; --row) {
+                ValueType value = multiplyRowWithVector(row - 1, vector);
+                if (summand) {
+                    value += (*summand)[row - 1];
+                }
+                result[row - 1] = std::move(value);
+            }
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (&vector == &result) {
+                std::vector<ValueType> temporary(result.size());
+                multiplyAndReduceRowGroups(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, false, vector, summand, temporary, choices);
+                std::swap(result, temporary);
+            } else {
+                multiplyAndReduceRowGroups(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, false, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(&vector != &result, "The input and the result vector must be different.");
+            multiplyAndReduceRowGroups(dir, rowGroupIndices, startRowGroup, endRowGroup, false, vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRowGroups(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, false, vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRowGroups(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, true, vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceRowGroups(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, bool backwards, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                multiplyAndReduceRowGroups<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, backwards, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceRowGroups<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, backwards, vector, summand, result, choices);
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseSubmatrixView<storm::RationalFunction>::multiplyAndReduceRowGroups(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, bool backwards, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* summand, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceRowGroups(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, bool backwards, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (backwards) {
+                for (index_type rowGroup = endRowGroup; rowGroup > startRowGroup; --rowGroup) {
+                    multiplyAndReduceRowGroup<Compare>(rowGroupIndices, rowGroup - 1, vector, summand, result, choices);
+                }
+            } else {
+                for (index_type rowGroup = startRowGroup; rowGroup < endRowGroup; ++rowGroup) {
+                    multiplyAndReduceRowGroup<Compare>(rowGroupIndices, rowGroup, vector, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseSubmatrixView<ValueType>::multiplyAndReduceRowGroup(std::vector<uint64_t> const& rowGroupIndices, index_type rowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            index_type firstRow = rowGroupIndices[rowGroup];
+            index_type endRow = rowGroupIndices[rowGroup + 1];
+
+            // Only multiply and reduce if there is at least one row in the group.
+            if (firstRow == endRow) {
+                return;
+            }
+
+            Compare compare;
+            ValueType currentValue = multiplyRowWithVector(firstRow, vector);
+            if (summand) {
+                currentValue += (*summand)[firstRow];
+            }
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice = 0;
+            if (choices && (*choices)[rowGroup] == 0) {
+                oldSelectedChoiceValue = currentValue;
+            }
+
+            for (index_type row = firstRow + 1; row < endRow; ++row) {
+                ValueType newValue = multiplyRowWithVector(row, vector);
+                if (summand) {
+                    newValue += (*summand)[row];
+                }
+                if (choices && row - firstRow == (*choices)[rowGroup]) {
+                    oldSelectedChoiceValue = newValue;
+                }
+                if (compare(newValue, currentValue)) {
+                    currentValue = std::move(newValue);
+                    selectedChoice = row - firstRow;
+                }
+            }
+
+            if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                (*choices)[rowGroup] = selectedChoice;
+            }
+            result[rowGroup] = std::move(currentValue);
+        }
+
+        template<typename ValueType>
+        std::size_t SparseSubmatrixView<ValueType>::getSizeInBytes() const {
+            return sizeof(*this) + (originalRows.size() + rowGroupIndices.size() + columnRanks.size()) * sizeof(index_type) + rowConstraint.getSizeInBytes() + columnConstraint.getSizeInBytes();
+        }
+
+        template class SparseSubmatrixView<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class SparseSubmatrixView<storm::RationalNumber>;
+        template class SparseSubmatrixView<storm::RationalFunction>;
+#endif
+
+    } // namespace storage
+} // namespace storm
@@ -0,0 +1,188 @@
+#ifndef STORM_STORAGE_SPARSESUBMATRIXVIEW_H_
+#define STORM_STORAGE_SPARSESUBMATRIXVIEW_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only view on the submatrix of a sparse matrix that is given by a row and a column constraint, i.e.,
+         * the matrix that SparseMatrix::getSubmatrix would return (without inserted diagonal entries). Instead of
+         * copying the selected entries, the view only stores which rows of the original matrix it consists of and a
+         * small directory that renumbers the selected columns. The multiplications iterate over the rows of the
+         * original matrix and skip the entries in columns that are not selected.
+         *
+         * The view refers to the original matrix, which must therefore neither be modified nor destroyed while the
+         * view is in use. Operations that need an actual matrix (e.g. direct solvers) can obtain one via
+         * toSparseMatrix.
+         */
+        template<typename ValueType>
+        class SparseSubmatrixView {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates a view on the submatrix of the given matrix.
+             *
+             * @param matrix The original matrix.
+             * @param useGroups If set, the row constraint refers to the row groups (rather than the rows) of the
+             * matrix.
+             * @param rowConstraint The rows (or row groups) to select.
+             * @param columnConstraint The columns to select.
+             */
+            SparseSubmatrixView(SparseMatrix<ValueType> const& matrix, bool useGroups, storm::storage::BitVector const& rowConstraint, storm::storage::BitVector const& columnConstraint);
+
+            /*!
+             * Retrieves the number of rows of the submatrix.
+             */
+            index_type getRowCount() const;
+
+            /*!
+             * Retrieves the number of columns of the submatrix.
+             */
+            index_type getColumnCount() const;
+
+            /*!
+             * Retrieves the number of row groups of the submatrix.
+             */
+            index_type getRowGroupCount() const;
+
+            /*!
+             * Retrieves the row group indices of the submatrix. They are determined as in SparseMatrix::getSubmatrix,
+             * that is, row groups without a selected row are dropped.
+             */
+            std::vector<index_type> const& getRowGroupIndices() const;
+
+            /*!
+             * Retrieves the matrix this view refers to.
+             */
+            SparseMatrix<ValueType> const& getOriginalMatrix() const;
+
+            /*!
+             * Retrieves the row of the original matrix that corresponds to the given row of the submatrix.
+             */
+            index_type getOriginalRow(index_type row) const;
+
+            /*!
+             * Copies the submatrix into a sparse matrix.
+             *
+             * @param insertDiagonalEntries If set, zero entries are inserted on the diagonal where the submatrix has no
+             * entry (see SparseMatrix::getSubmatrix).
+             * @return The submatrix.
+             */
+            SparseMatrix<ValueType> toSparseMatrix(bool insertDiagonalEntries = false) const;
+
+            /*!
+             * Multiplies the given row of the submatrix with the given vector.
+             *
+             * @param row The row of the submatrix.
+             * @param vector The vector with which to multiply. Its size must be the number of columns of the submatrix.
+             * @return The resulting value.
+             */
+            value_type multiplyRowWithVector(index_type row, std::vector<value_type> const& vector) const;
+
+            /*!
+             * Multiplies the submatrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the submatrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * It may be the same as the input vector.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the rows startRow, ..., endRow - 1 of the submatrix with the given vector. The result for row
+             * i is written to position i of the result vector. The result vector must not be the input vector.
+             */
+            void multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the submatrix with the given vector row by row, where the result of a row is written before
+             * the next row is processed (from the first to the last or from the last to the first row). If the result
+             * vector is the input vector, this yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the submatrix with the given vector, reduces the results of each row group to the minimum or
+             * maximum and writes it to the result vector (see SparseMatrix::multiplyAndReduce).
+             *
+             * @param dir The direction of the reduction.
+             * @param rowGroupIndices The row grouping to use.
+             * @param vector The vector with which to multiply the submatrix.
+             * @param summand If given, this summand (indexed by rows) will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result. It may be the same as the input vector.
+             * @param choices If given, the choices made in the reduction process are written to this vector. A choice
+             * is only changed if the new choice is strictly better than the previous one.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Performs multiplyAndReduce for the row groups startRowGroup, ..., endRowGroup - 1. The result vector must
+             * not be the input vector.
+             */
+            void multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Performs multiplyAndReduce group by group, where the result of a group is written before the next group
+             * is processed. If the result vector is the input vector, this yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Returns (an approximation of) the memory used by the view (excluding the original matrix) in bytes.
+             */
+            std::size_t getSizeInBytes() const;
+
+        private:
+            template<typename Compare>
+            void multiplyAndReduceRowGroup(std::vector<uint64_t> const& rowGroupIndices, index_type rowGroup, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename Compare>
+            void multiplyAndReduceRowGroups(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, bool backwards, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            void multiplyAndReduceRowGroups(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, bool backwards, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Retrieves the column of the submatrix that corresponds to the given column of the original matrix or the
+             * maximal index if the column is not selected.
+             */
+            index_type getSubmatrixColumn(index_type column) const;
+
+            // The original matrix.
+            SparseMatrix<ValueType> const& matrix;
+
+            // The constraints that define the submatrix.
+            bool useGroups;
+            storm::storage::BitVector rowConstraint;
+            storm::storage::BitVector columnConstraint;
+
+            // The i-th row of the submatrix is the row originalRows[i] of the original matrix.
+            std::vector<index_type> originalRows;
+
+            // The row groups of the submatrix.
+            std::vector<index_type> rowGroupIndices;
+
+            // The number of selected columns before the i-th block of 64 columns of the original matrix. The column of
+            // a selected entry in the submatrix is obtained from this and the selected columns within its block, so the
+            // renumbering does not need one index per column of the original matrix.
+            std::vector<index_type> columnRanks;
+
+            // The number of columns of the submatrix.
+            index_type columnCount;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_SPARSESUBMATRIXVIEW_H_ */
@@ -1,10 +1,18 @@
 #include <storm/utility/vector.h>
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -152,6 +160,417 @@ namespace storm {
             }
         }
 
+        namespace {
+            // Marks states that are not (yet) assigned to an SCC.
+            uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+            
+            // The maximal number of rounds of the color propagation before the remaining states are decomposed sequentially.
+            uint64_t const maximalNumberOfColoringRounds = 256;
+            
+            /*!
+             * The transitions of the considered subsystem in both directions, omitting selfloops.
+             */
+            struct SccGraph {
+                std::vector<uint64_t> successorIndications;
+                std::vector<uint64_t> successors;
+                std::vector<uint64_t> predecessorIndications;
+                std::vector<uint64_t> predecessors;
+                std::vector<uint8_t> hasSelfloop;
+            };
+            
+            template <typename ValueType>
+            SccGraph createSccGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices, storm::utility::ThreadPool& pool) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                SccGraph graph;
+                graph.hasSelfloop.resize(numberOfStates, 0);
+                graph.successorIndications.resize(numberOfStates + 1, 0);
+                
+                auto forEachSuccessor = [&] (uint64_t state, auto const& function) {
+                    if (subsystem && !subsystem->get(state)) {
+                        return;
+                    }
+                    for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+                        if (choices && !choices->get(row)) {
+                            continue;
+                        }
+                        for (auto const& successor : transitionMatrix.getRow(row)) {
+                            if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                                function(successor.getColumn());
+                            }
+                        }
+                    }
+                };
+                
+                // Count the successors, then fill them in.
+                storm::utility::executeInBlocks(pool, numberOfStates, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t state = first; state < end; ++state) {
+                        uint64_t count = 0;
+                        forEachSuccessor(state, [&] (uint64_t successor) {
+                            if (successor == state) {
+                                graph.hasSelfloop[state] = 1;
+                            } else {
+                                ++count;
+                            }
+                        });
+                        graph.successorIndications[state + 1] = count;
+                    }
+                });
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    graph.successorIndications[state + 1] += graph.successorIndications[state];
+                }
+                graph.successors.resize(graph.successorIndications.back());
+                std::vector<std::atomic<uint64_t>> predecessorCounts(numberOfStates + 1);
+                storm::utility::executeInBlocks(pool, numberOfStates + 1, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t state = first; state < end; ++state) {
+                        predecessorCounts[state].store(0, std::memory_order_relaxed);
+                    }
+                });
+                storm::utility::executeInBlocks(pool, numberOfStates, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t state = first; state < end; ++state) {
+                        uint64_t position = graph.successorIndications[state];
+                        forEachSuccessor(state, [&] (uint64_t successor) {
+                            if (successor != state) {
+                                graph.successors[position++] = successor;
+                                predecessorCounts[successor + 1].fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+                    }
+                });
+                
+                // Transpose the successor relation.
+                graph.predecessorIndications.resize(numberOfStates + 1, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    graph.predecessorIndications[state + 1] = graph.predecessorIndications[state] + predecessorCounts[state + 1].load(std::memory_order_relaxed);
+                    predecessorCounts[state].store(graph.predecessorIndications[state], std::memory_order_relaxed);
+                }
+                graph.predecessors.resize(graph.predecessorIndications.back());
+                storm::utility::executeInBlocks(pool, numberOfStates, [&] (uint64_t first, uint64_t end) {
+                    for (uint64_t state = first; state < end; ++state) {
+                        for (uint64_t index = graph.successorIndications[state]; index < graph.successorIndications[state + 1]; ++index) {
+                            graph.predecessors[predecessorCounts[graph.successors[index]].fetch_add(1, std::memory_order_relaxed)] = state;
+                        }
+                    }
+                });
+                return graph;
+            }
+        }
+        
+        template <typename ValueType>
+        uint_fast64_t StronglyConnectedComponentDecomposition<ValueType>::performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options, uint64_t numberOfThreads, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping) {
+            // We compute the SCCs similar to the Multistep algorithm (Slota et al., 2014): States without (remaining)
+            // predecessors or successors are trimmed, the SCC of a state with high degree is found with a forward and
+            // a backward search and the remaining SCCs are found by propagating colors. If the remaining part of the
+            // system is small or the parallel steps make little progress, it is decomposed sequentially.
+            // Each SCC is identified by one of its states until the SCCs are numbered at the very end.
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalInstance(numberOfThreads);
+            uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            storm::storage::BitVector const* subsystem = options.subsystemPtr;
+            SccGraph graph = createSccGraph(transitionMatrix, subsystem, options.choicesPtr, pool);
+            
+            std::vector<std::atomic<uint64_t>> sccRepresentative(numberOfStates);
+            std::vector<std::atomic<uint64_t>> inDegree(numberOfStates);
+            std::vector<std::atomic<uint64_t>> outDegree(numberOfStates);
+            std::vector<std::atomic<uint64_t>> color(numberOfStates);
+            std::vector<std::atomic<uint64_t>> lastQueuedRound(numberOfStates);
+            
+            // The states that are not yet assigned to an SCC.
+            std::vector<uint64_t> remainingStates;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                sccRepresentative[state].store(noScc, std::memory_order_relaxed);
+                inDegree[state].store(0, std::memory_order_relaxed);
+                outDegree[state].store(0, std::memory_order_relaxed);
+                color[state].store(noScc, std::memory_order_relaxed);
+                lastQueuedRound[state].store(0, std::memory_order_relaxed);
+                if (!subsystem || subsystem->get(state)) {
+                    remainingStates.push_back(state);
+                }
+            }
+            auto isRemaining = [&] (uint64_t state) {
+                return sccRepresentative[state].load(std::memory_order_relaxed) == noScc;
+            };
+            auto assign = [&] (uint64_t state, uint64_t representative) {
+                uint64_t expected = noScc;
+                return sccRepresentative[state].compare_exchange_strong(expected, representative, std::memory_order_relaxed);
+            };
+            auto removeAssignedStates = [&] () {
+                remainingStates.erase(std::remove_if(remainingStates.begin(), remainingStates.end(), [&] (uint64_t state) { return !isRemaining(state); }), remainingStates.end());
+            };
+            
+            bool firstIteration = true;
+            while (remainingStates.size() >= options.minimalNumberOfStatesForParallelism) {
+                uint64_t numberOfRemainingStatesBefore = remainingStates.size();
+                
+                // Trim states without remaining predecessors or successors.
+                std::vector<uint64_t> trimmedStates = storm::utility::expandFrontier(pool, remainingStates, [&] (uint64_t state, std::vector<uint64_t>& trimmed) {
+                    uint64_t in = 0;
+                    for (uint64_t index = graph.predecessorIndications[state]; index < graph.predecessorIndications[state + 1]; ++index) {
+                        in += isRemaining(graph.predecessors[index]) ? 1 : 0;
+                    }
+                    uint64_t out = 0;
+                    for (uint64_t index = graph.successorIndications[state]; index < graph.successorIndications[state + 1]; ++index) {
+                        out += isRemaining(graph.successors[index]) ? 1 : 0;
+                    }
+                    inDegree[state].store(in, std::memory_order_relaxed);
+                    outDegree[state].store(out, std::memory_order_relaxed);
+                    if (in == 0 || out == 0) {
+                        trimmed.push_back(state);
+                    }
+                });
+                for (auto state : trimmedStates) {
+                    sccRepresentative[state].store(state, std::memory_order_relaxed);
+                }
+                while (!trimmedStates.empty()) {
+                    trimmedStates = storm::utility::expandFrontier(pool, trimmedStates, [&] (uint64_t state, std::vector<uint64_t>& trimmed) {
+                        for (uint64_t index = graph.successorIndications[state]; index < graph.successorIndications[state + 1]; ++index) {
+                            uint64_t successor = graph.successors[index];
+                            if (inDegree[successor].fetch_sub(1, std::memory_order_relaxed) == 1 && assign(successor, successor)) {
+                                trimmed.push_back(successor);
+                            }
+                        }
+                        for (uint64_t index = graph.predecessorIndications[state]; index < graph.predecessorIndications[state + 1]; ++index) {
+                            uint64_t predecessor = graph.predecessors[index];
+                            if (outDegree[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 && assign(predecessor, predecessor)) {
+                                trimmed.push_back(predecessor);
+                            }
+                        }
+                    });
+                }
+                removeAssignedStates();
+                if (remainingStates.empty()) {
+                    break;
+                }
+                
+                // In the first iteration, we search the SCC of the state with the largest degree, which is likely to be large.
+                if (firstIteration) {
+                    firstIteration = false;
+                    uint64_t pivot = remainingStates.front();
+                    uint64_t pivotDegree = 0;
+                    for (auto state : remainingStates) {
+                        uint64_t degree = inDegree[state].load(std::memory_order_relaxed) * outDegree[state].load(std::memory_order_relaxed);
+                        if (degree > pivotDegree) {
+                            pivot = state;
+                            pivotDegree = degree;
+                        }
+                    }
+                    
+                    // Mark the states reachable from the pivot with its color, then collect those that can reach the pivot.
+                    for (auto state : remainingStates) {
+                        color[state].store(noScc, std::memory_order_relaxed);
+                    }
+                    color[pivot].store(pivot, std::memory_order_relaxed);
+                    std::vector<uint64_t> frontier = {pivot};
+                    while (!frontier.empty()) {
+                        frontier = storm::utility::expandFrontier(pool, frontier, [&] (uint64_t state, std::vector<uint64_t>& reached) {
+                            for (uint64_t index = graph.successorIndications[state]; index < graph.successorIndications[state + 1]; ++index) {
+                                uint64_t successor = graph.successors[index];
+                                if (isRemaining(successor) && color[successor].exchange(pivot, std::memory_order_relaxed) != pivot) {
+                                    reached.push_back(successor);
+                                }
+                            }
+                        });
+                    }
+                    assign(pivot, pivot);
+                    frontier = {pivot};
+                    while (!frontier.empty()) {
+                        frontier = storm::utility::expandFrontier(pool, frontier, [&] (uint64_t state, std::vector<uint64_t>& reached) {
+                            for (uint64_t index = graph.predecessorIndications[state]; index < graph.predecessorIndications[state + 1]; ++index) {
+                                uint64_t predecessor = graph.predecessors[index];
+                                if (color[predecessor].load(std::memory_order_relaxed) == pivot && assign(predecessor, pivot)) {
+                                    reached.push_back(predecessor);
+                                }
+                            }
+                        });
+                    }
+                    removeAssignedStates();
+                    continue;
+                }
+                
+                // Propagate the largest state index along the transitions. Afterwards, each state whose color is its
+                // own index is the representative of the SCC that consists of all states of that color that can reach it.
+                for (auto state : remainingStates) {
+                    color[state].store(state, std::memory_order_relaxed);
+                    lastQueuedRound[state].store(0, std::memory_order_relaxed);
+                }
+                std::vector<uint64_t> frontier = remainingStates;
+                uint64_t round = 0;
+                while (!frontier.empty() && round < maximalNumberOfColoringRounds) {
+                    ++round;
+                    frontier = storm::utility::expandFrontier(pool, frontier, [&] (uint64_t state, std::vector<uint64_t>& changed) {
+                        uint64_t stateColor = color[state].load(std::memory_order_relaxed);
+                        for (uint64_t index = graph.successorIndications[state]; index < graph.successorIndications[state + 1]; ++index) {
+                            uint64_t successor = graph.successors[index];
+                            if (!isRemaining(successor)) {
+                                continue;
+                            }
+                            uint64_t successorColor = color[successor].load(std::memory_order_relaxed);
+                            while (successorColor < stateColor && !color[successor].compare_exchange_weak(successorColor, stateColor, std::memory_order_relaxed)) {
+                                // Retry with the updated color.
+                            }
+                            if (successorColor < stateColor && lastQueuedRound[successor].exchange(round, std::memory_order_relaxed) != round) {
+                                changed.push_back(successor);
+                            }
+                        }
+                    });
+                }
+                if (!frontier.empty()) {
+                    // The colors did not stabilize quickly enough.
+                    break;
+                }
+                std::vector<uint64_t> representatives;
+                for (auto state : remainingStates) {
+                    if (color[state].load(std::memory_order_relaxed) == state) {
+                        representatives.push_back(state);
+                    }
+                }
+                pool.execute(representatives.size(), [&] (uint64_t index) {
+                    uint64_t representative = representatives[index];
+                    assign(representative, representative);
+                    std::vector<uint64_t> stack = {representative};
+                    while (!stack.empty()) {
+                        uint64_t state = stack.back();
+                        stack.pop_back();
+                        for (uint64_t index = graph.predecessorIndications[state]; index < graph.predecessorIndications[state + 1]; ++index) {
+                            uint64_t predecessor = graph.predecessors[index];
+                            if (color[predecessor].load(std::memory_order_relaxed) == representative && assign(predecessor, representative)) {
+                                stack.push_back(predecessor);
+                            }
+                        }
+                    }
+                });
+                removeAssignedStates();
+                
+                if (remainingStates.size() > numberOfRemainingStatesBefore - numberOfRemainingStatesBefore / 16) {
+                    // Too little progress.
+                    break;
+                }
+            }
+            
+            // Decompose the remaining states sequentially.
+            if (!remainingStates.empty()) {
+                STORM_LOG_TRACE("Decomposing " << remainingStates.size() << " remaining states sequentially.");
+                storm::storage::BitVector remainingSubsystem(numberOfStates);
+                for (auto state : remainingStates) {
+                    remainingSubsystem.set(state, true);
+                }
+                storm::storage::BitVector unusedNonTrivialStates(numberOfStates);
+                std::vector<uint_fast64_t> s, p, recursionStateStack, preorderNumbers(numberOfStates);
+                storm::storage::BitVector hasPreorderNumber(numberOfStates);
+                storm::storage::BitVector stateHasScc(numberOfStates);
+                std::vector<uint_fast64_t> remainingStateToSccMapping(numberOfStates);
+                uint_fast64_t currentIndex = 0;
+                uint_fast64_t sccCount = 0;
+                for (auto state : remainingStates) {
+                    if (!hasPreorderNumber.get(state)) {
+                        performSccDecompositionGCM(transitionMatrix, state, unusedNonTrivialStates, &remainingSubsystem, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, recursionStateStack, s, p, stateHasScc, remainingStateToSccMapping, sccCount, false, nullptr);
+                    }
+                }
+                std::vector<uint64_t> sccToRepresentative(sccCount, noScc);
+                for (auto state : remainingStates) {
+                    uint64_t& representative = sccToRepresentative[remainingStateToSccMapping[state]];
+                    if (representative == noScc) {
+                        representative = state;
+                    }
+                    sccRepresentative[state].store(representative, std::memory_order_relaxed);
+                }
+            }
+            
+            // Collect the states of each SCC.
+            std::vector<uint64_t> sccStateIndications(numberOfStates + 1, 0);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (!subsystem || subsystem->get(state)) {
+                    ++sccStateIndications[sccRepresentative[state].load(std::memory_order_relaxed) + 1];
+                }
+            }
+            std::vector<uint64_t> representatives;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (sccStateIndications[state + 1] > 0) {
+                    representatives.push_back(state);
+                }
+                sccStateIndications[state + 1] += sccStateIndications[state];
+            }
+            std::vector<uint64_t> sccStates(sccStateIndications.back());
+            {
+                std::vector<uint64_t> insertPositions(sccStateIndications.begin(), sccStateIndications.end() - 1);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (!subsystem || subsystem->get(state)) {
+                        sccStates[insertPositions[sccRepresentative[state].load(std::memory_order_relaxed)]++] = state;
+                    }
+                }
+            }
+            
+            // Compute the SCC depths by going backwards from the bottom SCCs. An SCC is reached once all transitions
+            // leaving it have been traversed backwards. We use the degree vectors to count the remaining transitions.
+            std::vector<uint64_t> depths(numberOfStates, 0);
+            storm::utility::executeInBlocks(pool, representatives.size(), [&] (uint64_t first, uint64_t end) {
+                for (uint64_t index = first; index < end; ++index) {
+                    uint64_t representative = representatives[index];
+                    uint64_t leavingTransitions = 0;
+                    for (uint64_t stateIndex = sccStateIndications[representative]; stateIndex < sccStateIndications[representative + 1]; ++stateIndex) {
+                        uint64_t state = sccStates[stateIndex];
+                        for (uint64_t successorIndex = graph.successorIndications[state]; successorIndex < graph.successorIndications[state + 1]; ++successorIndex) {
+                            if (sccRepresentative[graph.successors[successorIndex]].load(std::memory_order_relaxed) != representative) {
+                                ++leavingTransitions;
+                            }
+                        }
+                    }
+                    outDegree[representative].store(leavingTransitions, std::memory_order_relaxed);
+                }
+            });
+            std::vector<uint64_t> frontier;
+            for (auto representative : representatives) {
+                if (outDegree[representative].load(std::memory_order_relaxed) == 0) {
+                    frontier.push_back(representative);
+                }
+            }
+            uint64_t depth = 0;
+            uint64_t numberOfFinishedSccs = 0;
+            while (!frontier.empty()) {
+                ++depth;
+                numberOfFinishedSccs += frontier.size();
+                frontier = storm::utility::expandFrontier(pool, frontier, [&] (uint64_t representative, std::vector<uint64_t>& finished) {
+                    for (uint64_t stateIndex = sccStateIndications[representative]; stateIndex < sccStateIndications[representative + 1]; ++stateIndex) {
+                        uint64_t state = sccStates[stateIndex];
+                        for (uint64_t index = graph.predecessorIndications[state]; index < graph.predecessorIndications[state + 1]; ++index) {
+                            uint64_t predecessorRepresentative = sccRepresentative[graph.predecessors[index]].load(std::memory_order_relaxed);
+                            if (predecessorRepresentative != representative && outDegree[predecessorRepresentative].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                depths[predecessorRepresentative] = depth;
+                                finished.push_back(predecessorRepresentative);
+                            }
+                        }
+                    }
+                });
+            }
+            STORM_LOG_ASSERT(numberOfFinishedSccs == representatives.size(), "Unexpected number of SCCs.");
+            
+            // Number the SCCs by their depth and (for SCCs with the same depth) by their smallest state, which yields
+            // a topological sort that does not depend on the number of threads.
+            std::vector<uint64_t> sccsWithDepthIndications(depth + 1, 0);
+            for (auto representative : representatives) {
+                ++sccsWithDepthIndications[depths[representative] + 1];
+            }
+            for (uint64_t index = 1; index < sccsWithDepthIndications.size(); ++index) {
+                sccsWithDepthIndications[index] += sccsWithDepthIndications[index - 1];
+            }
+            sccDepths = std::vector<uint_fast64_t>(representatives.size());
+            std::vector<uint64_t> sccIndices(numberOfStates, noScc);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (subsystem && !subsystem->get(state)) {
+                    continue;
+                }
+                uint64_t representative = sccRepresentative[state].load(std::memory_order_relaxed);
+                if (sccIndices[representative] == noScc) {
+                    sccIndices[representative] = sccsWithDepthIndications[depths[representative]]++;
+                    sccDepths.get()[sccIndices[representative]] = depths[representative];
+                }
+                stateToSccMapping[state] = sccIndices[representative];
+                if (graph.hasSelfloop[state] || sccStateIndications[representative + 1] - sccStateIndications[representative] > 1) {
+                    nonTrivialStates.set(state, true);
+                }
+            }
+            return representatives.size();
+        }
+
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
             
@@ -165,7 +584,17 @@ namespace storm {
             
             // Obtain a mapping from states to the SCC it belongs to
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-            {
+            uint64_t numberOfThreads = options.threads;
+            if (numberOfThreads == 0) {
+                numberOfThreads = storm::settings::hasModule<storm::settings::modules::CoreSettings>() ? storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads() : 1;
+            }
+            uint64_t numberOfConsideredStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
+            if (numberOfThreads > 1 && numberOfConsideredStates >= options.minimalNumberOfStatesForParallelism) {
+                sccCount = performParallelSccDecomposition(transitionMatrix, options, numberOfThreads, nonTrivialStates, stateToSccMapping);
+                if (!options.isComputeSccDepthsSet && !options.areOnlyBottomSccsConsidered) {
+                    sccDepths = boost::none;
+                }
+            } else {
             
                 // Set up the environment of the algorithm.
                 // Start with the two stacks it maintains.
@@ -31,6 +31,10 @@ namespace storm {
             StronglyConnectedComponentDecompositionOptions& forceTopologicalSort(bool value = true) { isTopologicalSortForced = value; return *this; }
             /// Sets if scc depths can be retrieved.
             StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true) { isComputeSccDepthsSet = value; return *this; }
+            /// Sets the number of threads used for the decomposition. Zero (the default) means that the number of threads given by the core settings is used.
+            StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value) { threads = value; return *this; }
+            /// Sets the minimal number of states for which the decomposition is done in parallel. Smaller systems are always decomposed sequentially.
+            StronglyConnectedComponentDecompositionOptions& parallelThreshold(uint64_t value) { minimalNumberOfStatesForParallelism = value; return *this; }
             
             storm::storage::BitVector const* subsystemPtr = nullptr;
             storm::storage::BitVector const* choicesPtr = nullptr;
@@ -38,6 +42,8 @@ namespace storm {
             bool areOnlyBottomSccsConsidered = false;
             bool isTopologicalSortForced = false;
             bool isComputeSccDepthsSet = false;
+            uint64_t threads = 0;
+            uint64_t minimalNumberOfStatesForParallelism = 100000;
             
         };
         
@@ -113,6 +119,21 @@ namespace storm {
              */
             void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options);
             
+            /*
+             * Computes the mapping of states to SCCs using multiple threads. The SCCs are numbered such that an SCC
+             * can only reach SCCs with a smaller index, so the result is always sorted topologically. As a side-effect,
+             * this fills the SCC depths.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param options options for the decomposition
+             * @param numberOfThreads The number of threads to use.
+             * @param nonTrivialStates A bit vector in which the states that either have a selfloop or whose SCC is not
+             * a singleton are set.
+             * @param stateToSccMapping A mapping from states to the SCC indices they belong to.
+             * @return The number of SCCs.
+             */
+            uint_fast64_t performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options, uint64_t numberOfThreads, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping);
+            
             
             boost::optional<std::vector<uint_fast64_t>> sccDepths;
         };
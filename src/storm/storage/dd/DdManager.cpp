@@ -432,6 +432,16 @@ namespace storm {
             internalDdManager.triggerReordering();
         }
         
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+            internalDdManager.execute(numberOfTasks, task);
+        }
+        
+        template<DdType LibraryType>
+        uint64_t DdManager<LibraryType>::getNumberOfThreads() const {
+            return internalDdManager.getNumberOfThreads();
+        }
+        
         template<DdType LibraryType>
         std::set<storm::expressions::Variable> DdManager<LibraryType>::getAllMetaVariables() const {
             std::set<storm::expressions::Variable> result;
@@ -1,6 +1,7 @@
 #ifndef STORM_STORAGE_DD_DDMANAGER_H_
 #define STORM_STORAGE_DD_DDMANAGER_H_
 
+#include <functional>
 #include <set>
 #include <unordered_map>
 #include <boost/optional.hpp>
@@ -270,6 +271,23 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Executes task(i) for all i in 0, ..., numberOfTasks - 1 and returns when all tasks are finished. If the
+             * library supports it, the tasks are executed in parallel. Tasks may only read the meta variables of this
+             * manager, but they may freely create and combine DDs.
+             *
+             * @param numberOfTasks The number of tasks.
+             * @param task The function that executes a single task.
+             */
+            void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const;
+            
+            /*!
+             * Retrieves the number of threads that execute the tasks passed to execute.
+             *
+             * @return The number of threads.
+             */
+            uint64_t getNumberOfThreads() const;
+            
             /*!
              * Retrieves the meta variable with the given name if it exists.
              *
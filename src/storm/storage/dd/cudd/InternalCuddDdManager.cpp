@@ -152,6 +152,16 @@ namespace storm {
             this->getCuddManager().ReduceHeap(this->reorderingTechnique, 0);
         }
         
+        void InternalDdManager<DdType::CUDD>::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+            for (uint64_t index = 0; index < numberOfTasks; ++index) {
+                task(index);
+            }
+        }
+        
+        uint64_t InternalDdManager<DdType::CUDD>::getNumberOfThreads() const {
+            return 1;
+        }
+        
         void InternalDdManager<DdType::CUDD>::debugCheck() const {
             this->getCuddManager().CheckKeys();
             this->getCuddManager().DebugCheck();
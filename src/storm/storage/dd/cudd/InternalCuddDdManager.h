@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_DD_INTERNALCUDDDDMANAGER_H_
 #define STORM_STORAGE_DD_INTERNALCUDDDDMANAGER_H_
 
+#include <functional>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -126,6 +128,20 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Executes task(i) for all i in 0, ..., numberOfTasks - 1. As CUDD is not thread-safe, the tasks are
+             * executed sequentially.
+             *
+             * @param numberOfTasks The number of tasks.
+             * @param task The function that executes a single task.
+             */
+            void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const;
+            
+            /*!
+             * Retrieves the number of threads that execute the tasks passed to execute, which is always one.
+             */
+            uint64_t getNumberOfThreads() const;
+            
             /*!
              * Performs a debug check if available.
              */
@@ -1,7 +1,9 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
 #include <cmath>
+#include <exception>
 #include <iostream>
+#include <mutex>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
@@ -37,6 +39,50 @@ namespace storm {
 #pragma clang diagnostic pop
 #endif
         
+#endif
+        
+        namespace {
+            // The state shared by the Lace tasks of one call to execute.
+            struct ParallelExecution {
+                ParallelExecution(std::function<void(uint64_t)> const& task) : task(task) {
+                    // Intentionally left empty.
+                }
+                
+                std::function<void(uint64_t)> const& task;
+                std::mutex mutex;
+                std::exception_ptr exception;
+            };
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+        
+        // Executes the tasks in [begin, end) by splitting the range in halves, one of which may be stolen by another worker.
+        VOID_TASK_3(execute_task_range, void*, executionPointer, uint64_t, begin, uint64_t, end) {
+            if (end - begin > 1) {
+                uint64_t middle = begin + (end - begin) / 2;
+                SPAWN(execute_task_range, executionPointer, middle, end);
+                CALL(execute_task_range, executionPointer, begin, middle);
+                SYNC(execute_task_range);
+            } else {
+                ParallelExecution& execution = *static_cast<ParallelExecution*>(executionPointer);
+                // Exceptions must not propagate through the (C) code of Lace.
+                try {
+                    execution.task(begin);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(execution.mutex);
+                    if (!execution.exception) {
+                        execution.exception = std::current_exception();
+                    }
+                }
+            }
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -255,6 +301,22 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
         
+        void InternalDdManager<DdType::Sylvan>::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+            if (numberOfTasks == 0) {
+                return;
+            }
+            ParallelExecution execution(task);
+            LACE_ME;
+            CALL(execute_task_range, &execution, 0, numberOfTasks);
+            if (execution.exception) {
+                std::rethrow_exception(execution.exception);
+            }
+        }
+        
+        uint64_t InternalDdManager<DdType::Sylvan>::getNumberOfThreads() const {
+            return lace_workers();
+        }
+        
         void InternalDdManager<DdType::Sylvan>::debugCheck() const {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
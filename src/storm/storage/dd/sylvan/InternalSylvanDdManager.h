@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <functional>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -127,6 +129,21 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Executes task(i) for all i in 0, ..., numberOfTasks - 1 and returns when all tasks are finished. The tasks
+             * are spawned as Lace tasks, so they are executed in parallel by the workers of sylvan (and may themselves
+             * call execute). If one of the tasks throws, the (first) exception is rethrown after all tasks were processed.
+             *
+             * @param numberOfTasks The number of tasks.
+             * @param task The function that executes a single task.
+             */
+            void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const;
+            
+            /*!
+             * Retrieves the number of Lace workers that execute the tasks passed to execute.
+             */
+            uint64_t getNumberOfThreads() const;
+            
             /*!
              * Performs a debug check if available.
              */
@@ -1,5 +1,7 @@
 #include "storm/storage/sparse/StateStorage.h"
 
+#include <algorithm>
+
 namespace storm {
     namespace storage {
         namespace sparse {
@@ -11,7 +13,31 @@ namespace storm {
 
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
-                return stateToId.size();
+                return concurrentStateToId ? concurrentStateToId->size() : stateToId.size();
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::enableConcurrentInsertion() {
+                if (concurrentStateToId) {
+                    return;
+                }
+                concurrentStateToId = std::make_unique<storm::storage::ConcurrentBitVectorHashMap<StateType>>(bitsPerState, std::max<uint64_t>(100000, 2 * stateToId.size()));
+                for (auto const& stateIndexPair : stateToId) {
+                    concurrentStateToId->findOrAdd(stateIndexPair.first, stateIndexPair.second);
+                }
+                stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, 100000);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::disableConcurrentInsertion(std::function<StateType (StateType const&)> const& remapping) {
+                if (!concurrentStateToId) {
+                    return;
+                }
+                stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, std::max<uint64_t>(100000, concurrentStateToId->size() + concurrentStateToId->size() / 2));
+                concurrentStateToId->forEach([this, &remapping] (storm::storage::BitVector const& state, StateType const& index) {
+                    stateToId.findOrAdd(state, remapping(index));
+                });
+                concurrentStateToId.reset();
             }
             
             template struct StateStorage<uint32_t>;
@@ -2,8 +2,11 @@
 #define STORM_STORAGE_SPARSE_STATESTORAGE_H_
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 
 namespace storm {
     namespace storage {
@@ -18,6 +21,10 @@ namespace storm {
                 // This member stores all the states and maps them to their unique indices.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
+                // If set, this member stores the states instead of stateToId, so several threads can add states at the
+                // same time (see enableConcurrentInsertion).
+                std::unique_ptr<storm::storage::ConcurrentBitVectorHashMap<StateType>> concurrentStateToId;
+                
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
                 
@@ -29,6 +36,13 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint_fast64_t getNumberOfStates() const;
+                
+                // Moves the states from stateToId to concurrentStateToId.
+                void enableConcurrentInsertion();
+                
+                // Moves the states from concurrentStateToId back to stateToId, where the index of every state is
+                // replaced according to the given mapping.
+                void disableConcurrentInsertion(std::function<StateType (StateType const&)> const& remapping);
             };
             
         }
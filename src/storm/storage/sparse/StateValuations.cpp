@@ -10,41 +10,141 @@ namespace storm {
     namespace storage {
         namespace sparse {
             
-            StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues) : booleanValues(std::move(booleanValues)), integerValues(std::move(integerValues)), rationalValues(std::move(rationalValues)) {
-                // Intentionally left empty
+            namespace {
+                /*!
+                 * Retrieves the number of bits that are required to store the given value in two's complement.
+                 */
+                uint64_t getRequiredBitWidth(int64_t value) {
+                    uint64_t magnitude = value < 0 ? ~static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+                    uint64_t result = 1;
+                    while (magnitude != 0) {
+                        magnitude >>= 1;
+                        ++result;
+                    }
+                    return std::min<uint64_t>(result, 64);
+                }
+            }
+            
+            StateValuations::IntegerColumn::IntegerColumn(int64_t lowerBound, int64_t upperBound) : baseValue(lowerBound), bitWidth(0) {
+                STORM_LOG_ASSERT(lowerBound <= upperBound, "Invalid range of integer values.");
+                // Choose the number of bits such that the range fits and put the base value in the middle of the range.
+                uint64_t rangeSize = static_cast<uint64_t>(upperBound) - static_cast<uint64_t>(lowerBound);
+                while (bitWidth < 64 && (rangeSize >> bitWidth) != 0) {
+                    ++bitWidth;
+                }
+                if (bitWidth > 0) {
+                    baseValue = static_cast<int64_t>(static_cast<uint64_t>(lowerBound) + (1ull << (bitWidth - 1)));
+                }
+            }
+            
+            uint64_t StateValuations::IntegerColumn::getCode(uint64_t stateIndex) const {
+                if (bitWidth == 0) {
+                    return 0;
+                }
+                uint64_t code = codes.getAsInt(stateIndex * bitWidth, bitWidth);
+                // Extend the sign of the code.
+                if (bitWidth < 64 && (code >> (bitWidth - 1)) != 0) {
+                    code |= ~((1ull << bitWidth) - 1);
+                }
+                return code;
+            }
+            
+            int64_t StateValuations::IntegerColumn::get(uint64_t stateIndex) const {
+                // As we compute modulo 2^64, this also works if the difference to the base value overflows.
+                return static_cast<int64_t>(static_cast<uint64_t>(baseValue) + getCode(stateIndex));
+            }
+            
+            void StateValuations::IntegerColumn::set(uint64_t stateIndex, int64_t value, uint64_t numberOfStates) {
+                int64_t difference = static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(baseValue));
+                uint64_t requiredBitWidth = difference == 0 ? 0 : getRequiredBitWidth(difference);
+                if (requiredBitWidth > bitWidth) {
+                    // Re-encode all values with the larger number of bits.
+                    uint64_t numberOfStoredStates = std::max(numberOfStates, stateIndex + 1);
+                    storm::storage::BitVector newCodes(numberOfStoredStates * requiredBitWidth);
+                    uint64_t mask = requiredBitWidth == 64 ? -1ull : (1ull << requiredBitWidth) - 1;
+                    // Only the states whose codes are actually stored need to be copied, the codes of all other states
+                    // are zero (i.e. their value is the base value), which is also the initial code in the new vector.
+                    uint64_t numberOfEncodedStates = bitWidth == 0 ? 0 : std::min(numberOfStates, codes.size() / bitWidth);
+                    for (uint64_t state = 0; state < numberOfEncodedStates; ++state) {
+                        newCodes.setFromInt(state * requiredBitWidth, requiredBitWidth, getCode(state) & mask);
+                    }
+                    codes = std::move(newCodes);
+                    bitWidth = requiredBitWidth;
+                }
+                if (bitWidth > 0) {
+                    codes.grow((stateIndex + 1) * bitWidth);
+                    uint64_t mask = bitWidth == 64 ? -1ull : (1ull << bitWidth) - 1;
+                    codes.setFromInt(stateIndex * bitWidth, bitWidth, static_cast<uint64_t>(difference) & mask);
+                }
+            }
+            
+            void StateValuations::IntegerColumn::shrink(uint64_t numberOfStates) {
+                codes.resize(numberOfStates * bitWidth);
             }
             
-            typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-                STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-                STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-                return valuations[stateIndex];
+            uint64_t StateValuations::IntegerColumn::getSizeInBytes() const {
+                return sizeof(IntegerColumn) + codes.getSizeInBytes();
+            }
+            
+            StateValuations::IntegerColumn StateValuations::IntegerColumn::createEmptyCopy(uint64_t numberOfStates) const {
+                IntegerColumn result;
+                result.baseValue = baseValue;
+                result.bitWidth = bitWidth;
+                result.codes = storm::storage::BitVector(numberOfStates * bitWidth);
+                return result;
+            }
+            
+            StateValuations::StateValuations(StateValuations const& variablesSource, uint64_t numberOfStates) : variableToIndexMap(variablesSource.variableToIndexMap), numberOfStates(numberOfStates), nonEmptyStates(numberOfStates) {
+                booleanColumns.resize(variablesSource.booleanColumns.size(), storm::storage::BitVector(numberOfStates));
+                for (auto const& column : variablesSource.integerColumns) {
+                    integerColumns.push_back(column.createEmptyCopy(numberOfStates));
+                }
+                rationalColumns.resize(variablesSource.rationalColumns.size(), std::vector<storm::RationalNumber>(numberOfStates));
+            }
+            
+            void StateValuations::copyState(StateValuations const& source, uint64_t sourceStateIndex, uint64_t targetStateIndex) {
+                if (source.isEmpty(sourceStateIndex)) {
+                    return;
+                }
+                nonEmptyStates.set(targetStateIndex);
+                for (uint64_t index = 0; index < booleanColumns.size(); ++index) {
+                    booleanColumns[index].set(targetStateIndex, source.booleanColumns[index].get(sourceStateIndex));
+                }
+                for (uint64_t index = 0; index < integerColumns.size(); ++index) {
+                    integerColumns[index].set(targetStateIndex, source.integerColumns[index].get(sourceStateIndex), numberOfStates);
+                }
+                for (uint64_t index = 0; index < rationalColumns.size(); ++index) {
+                    rationalColumns[index][targetStateIndex] = source.rationalColumns[index][sourceStateIndex];
+                }
             }
             
             bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index or empty valuation.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-                return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+                return booleanColumns[variableToIndexMap.at(booleanVariable)].get(stateIndex);
             }
             
-            int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+            int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+                STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index or empty valuation.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-                return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+                return integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
             }
             
             storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index or empty valuation.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-                return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+                return rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
             }
             
             bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-                auto const& valuation = getValuation(stateIndex);
-                return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty();
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
+                return !nonEmptyStates.get(stateIndex);
             }
             
             std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
-                auto const& valuation = getValuation(stateIndex);
+                if (isEmpty(stateIndex)) {
+                    return "[]";
+                }
                 typename std::map<storm::expressions::Variable, uint64_t>::const_iterator mapIt = variableToIndexMap.begin();
                 typename std::set<storm::expressions::Variable>::const_iterator setIt;
                 if (selectedVariables) {
@@ -64,24 +164,24 @@ namespace storm {
                     auto const& variable = mapIt->first;
                     std::stringstream stream;
                     if (pretty) {
-                        if (variable.hasBooleanType() && !valuation.booleanValues[mapIt->second]) {
+                        if (variable.hasBooleanType() && !booleanColumns[mapIt->second].get(stateIndex)) {
                             stream << "!";
                         }
                         stream << variable.getName();
                         if (variable.hasIntegerType()) {
-                            stream << "=" << valuation.integerValues[mapIt->second];
+                            stream << "=" << integerColumns[mapIt->second].get(stateIndex);
                         } else if (variable.hasRationalType()) {
-                            stream << "=" << valuation.rationalValues[mapIt->second];
+                            stream << "=" << rationalColumns[mapIt->second][stateIndex];
                         } else {
                             STORM_LOG_THROW(variable.hasBooleanType(), storm::exceptions::InvalidTypeException, "Unexpected variable type.");
                         }
                     } else {
                         if (variable.hasBooleanType()) {
-                            stream << std::boolalpha << valuation.booleanValues[mapIt->second] << std::noboolalpha;
+                            stream << std::boolalpha << booleanColumns[mapIt->second].get(stateIndex) << std::noboolalpha;
                         } else if (variable.hasIntegerType()) {
-                            stream << valuation.integerValues[mapIt->second];
+                            stream << integerColumns[mapIt->second].get(stateIndex);
                         } else if (variable.hasRationalType()) {
-                            stream << valuation.rationalValues[mapIt->second];
+                            stream << rationalColumns[mapIt->second][stateIndex];
                         }
                     }
                     assignments.push_back(stream.str());
@@ -101,13 +201,15 @@ namespace storm {
             }
             
             typename StateValuations::Json StateValuations::toJson(storm::storage::sparse::state_type const& stateIndex, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
-                auto const& valuation = getValuation(stateIndex);
+                Json result;
+                if (isEmpty(stateIndex)) {
+                    return result;
+                }
                 typename std::map<storm::expressions::Variable, uint64_t>::const_iterator mapIt = variableToIndexMap.begin();
                 typename std::set<storm::expressions::Variable>::const_iterator setIt;
                 if (selectedVariables) {
                     setIt = selectedVariables->begin();
                 }
-                Json result;
                 while (mapIt != variableToIndexMap.end() && (!selectedVariables || setIt != selectedVariables->end())) {
                     // Move Map iterator to next relevant position
                     if (selectedVariables) {
@@ -119,11 +221,11 @@ namespace storm {
                     
                     auto const& variable = mapIt->first;
                     if (variable.hasBooleanType()) {
-                        result[variable.getName()] = bool(valuation.booleanValues[mapIt->second]);
+                        result[variable.getName()] = booleanColumns[mapIt->second].get(stateIndex);
                     } else if (variable.hasIntegerType()) {
-                        result[variable.getName()] = valuation.integerValues[mapIt->second];
+                        result[variable.getName()] = integerColumns[mapIt->second].get(stateIndex);
                     } else if (variable.hasRationalType()) {
-                        result[variable.getName()] = valuation.rationalValues[mapIt->second];
+                        result[variable.getName()] = rationalColumns[mapIt->second][stateIndex];
                     } else {
                         STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
                     }
@@ -138,49 +240,46 @@ namespace storm {
                 return result;
             }
             
-            bool StateValuations::assertValuation(StateValuation const& valuation) const {
-                storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-                storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-                storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-                for (auto const& varIndex : variableToIndexMap) {
-                    storm::storage::BitVector* bv;
-                    if (varIndex.first.hasBooleanType()) {
-                        bv = &foundBooleanValues;
-                    } else if (varIndex.first.hasIntegerType()) {
-                        bv = &foundIntegerValues;
-                    } else if (varIndex.first.hasRationalType()) {
-                        bv = &foundRationalValues;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-                    }
-                    if (varIndex.second < bv->size()) {
-                        if (bv->get(varIndex.second)) {
-                            STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                            return false;
-                        }
-                        bv->set(varIndex.second, true);
-                    } else {
-                        STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-                        return false;
-                    }
-                }
-                if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-                    STORM_LOG_ERROR("Valuation has too many entries.");
-                }
-                return true;
-            }
-            
-            StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations) : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-                // Intentionally left empty
-            }
-            
             std::string StateValuations::getStateInfo(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
                 return this->toString(state);
             }
             
             uint_fast64_t StateValuations::getNumberOfStates() const {
-                return valuations.size();
+                return numberOfStates;
+            }
+            
+            std::vector<storm::expressions::Variable> StateValuations::getVariables() const {
+                std::vector<storm::expressions::Variable> booleanVariables(booleanColumns.size());
+                std::vector<storm::expressions::Variable> integerVariables(integerColumns.size());
+                std::vector<storm::expressions::Variable> rationalVariables(rationalColumns.size());
+                for (auto const& variableIndexPair : variableToIndexMap) {
+                    if (variableIndexPair.first.hasBooleanType()) {
+                        booleanVariables[variableIndexPair.second] = variableIndexPair.first;
+                    } else if (variableIndexPair.first.hasIntegerType()) {
+                        integerVariables[variableIndexPair.second] = variableIndexPair.first;
+                    } else {
+                        rationalVariables[variableIndexPair.second] = variableIndexPair.first;
+                    }
+                }
+                std::vector<storm::expressions::Variable> result = std::move(booleanVariables);
+                result.insert(result.end(), integerVariables.begin(), integerVariables.end());
+                result.insert(result.end(), rationalVariables.begin(), rationalVariables.end());
+                return result;
+            }
+            
+            uint64_t StateValuations::getSizeInBytes() const {
+                uint64_t result = sizeof(StateValuations) + nonEmptyStates.getSizeInBytes();
+                for (auto const& column : booleanColumns) {
+                    result += column.getSizeInBytes();
+                }
+                for (auto const& column : integerColumns) {
+                    result += column.getSizeInBytes();
+                }
+                for (auto const& column : rationalColumns) {
+                    result += column.size() * sizeof(storm::RationalNumber);
+                }
+                return result;
             }
 
             std::size_t StateValuations::hash() const {
@@ -188,20 +287,23 @@ namespace storm {
             }
             
             StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-                return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+                StateValuations result(*this, selectedStates.getNumberOfSetBits());
+                uint64_t targetStateIndex = 0;
+                for (auto const& selectedState : selectedStates) {
+                    result.copyState(*this, selectedState, targetStateIndex);
+                    ++targetStateIndex;
+                }
+                return result;
             }
 
             StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-                std::vector<StateValuation> selectedValuations;
-                selectedValuations.reserve(selectedStates.size());
-                for (auto const& selectedState : selectedStates){
-                    if (selectedState < valuations.size()) {
-                        selectedValuations.push_back(valuations[selectedState]);
-                    } else {
-                        selectedValuations.emplace_back();
+                StateValuations result(*this, selectedStates.size());
+                for (uint64_t targetStateIndex = 0; targetStateIndex < selectedStates.size(); ++targetStateIndex) {
+                    if (selectedStates[targetStateIndex] < numberOfStates) {
+                        result.copyState(*this, selectedStates[targetStateIndex], targetStateIndex);
                     }
                 }
-                return StateValuations(variableToIndexMap, std::move(selectedValuations));
+                return result;
             }
             
             StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0) {
@@ -209,36 +311,71 @@ namespace storm {
             }
             
             void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-                STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
                 STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
                 if (variable.hasBooleanType()) {
                     currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+                    currentStateValuations.booleanColumns.emplace_back();
                 }
                 if (variable.hasIntegerType()) {
                     currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                    currentStateValuations.integerColumns.emplace_back();
                 }
                 if (variable.hasRationalType()) {
                     currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+                    currentStateValuations.rationalColumns.emplace_back();
                 }
             }
             
+            void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+                STORM_LOG_ASSERT(variable.hasIntegerType(), "Expected an integer variable.");
+                addVariable(variable);
+                currentStateValuations.integerColumns.back() = StateValuations::IntegerColumn(lowerBound, upperBound);
+            }
+            
             void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues) {
-                if (state > currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.resize(state);
+                StateValuations& valuations = currentStateValuations;
+                STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount, "Valuation does not provide a value for all variables.");
+                STORM_LOG_ASSERT(state >= valuations.numberOfStates || valuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
+                valuations.numberOfStates = std::max<uint64_t>(valuations.numberOfStates, state + 1);
+                
+                if (!booleanValues.empty() || !integerValues.empty() || !rationalValues.empty()) {
+                    valuations.nonEmptyStates.grow(state + 1);
+                    valuations.nonEmptyStates.set(state);
                 }
-                if (state == currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
-                } else {
-                    STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-                    currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
+                for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+                    valuations.booleanColumns[index].grow(state + 1);
+                    valuations.booleanColumns[index].set(state, booleanValues[index]);
+                }
+                for (uint64_t index = 0; index < integerValues.size(); ++index) {
+                    valuations.integerColumns[index].set(state, integerValues[index], valuations.numberOfStates);
+                }
+                for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+                    if (valuations.rationalColumns[index].size() <= state) {
+                        valuations.rationalColumns[index].resize(state + 1);
+                    }
+                    valuations.rationalColumns[index][state] = std::move(rationalValues[index]);
                 }
             }
             
             StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-                return std::move(currentStateValuations);
+                // Remove the storage that was reserved for further states and add the missing (empty) states.
+                StateValuations& valuations = currentStateValuations;
+                valuations.numberOfStates = std::max<uint64_t>(valuations.numberOfStates, totalStateCount);
+                valuations.nonEmptyStates.resize(valuations.numberOfStates);
+                for (auto& column : valuations.booleanColumns) {
+                    column.resize(valuations.numberOfStates);
+                }
+                for (auto& column : valuations.integerColumns) {
+                    column.shrink(valuations.numberOfStates);
+                }
+                for (auto& column : valuations.rationalColumns) {
+                    column.resize(valuations.numberOfStates);
+                }
                 booleanVarCount = 0;
                 integerVarCount = 0;
                 rationalVarCount = 0;
+                return std::move(currentStateValuations);
             }
         }
     }
@@ -12,40 +12,29 @@
 namespace storm {
     namespace storage {
         namespace sparse {
-            
+
             class StateValuationsBuilder;
-            
+
             // A structure holding information about the reachable state space that can be retrieved from the outside.
+            // The values are stored column-wise, i.e. for every variable, the values of all states are stored
+            // consecutively. Boolean values occupy one bit and integer values the number of bits that is required to
+            // store the range of the values. Rational values are stored explicitly.
             class StateValuations : public storm::models::sparse::StateAnnotation {
             public:
                 friend class StateValuationsBuilder;
                 typedef storm::json<storm::RationalNumber> Json;
 
-                class StateValuation {
-                public:
-                    friend class StateValuations;
-                    StateValuation() = default;
-                    StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues);
-    
-                private:
-                    
-                    std::vector<bool> booleanValues;
-                    std::vector<int64_t> integerValues;
-                    std::vector<storm::RationalNumber> rationalValues;
-                };
-                
-
                 StateValuations() = default;
-                
+
                 virtual ~StateValuations() = default;
                 virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
-                
+
                 bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-                int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+                int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
                 storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const;
                 /// Returns true, if this valuation does not contain any value.
                 bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
-                
+
                 /*!
                  * Returns a string representation of the valuation.
                  *
@@ -53,7 +42,7 @@ namespace storm {
                  * @return The string representation.
                  */
                 std::string toString(storm::storage::sparse::state_type const& stateIndex, bool pretty = true, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
-                
+
                 /*!
                  * Returns a JSON representation of this valuation
                  * @param selectedVariables If given, only the informations for the variables in this set are processed.
@@ -61,15 +50,27 @@ namespace storm {
                  */
                 Json toJson(storm::storage::sparse::state_type const& stateIndex, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
 
-                
+
                 // Returns the (current) number of states that this object describes.
                 uint_fast64_t getNumberOfStates() const;
-                
+
+                /*!
+                 * Retrieves the variables whose values are stored. The boolean variables precede the integer variables,
+                 * which precede the rational variables. Within each type, the variables are in the order in which they
+                 * were added.
+                 */
+                std::vector<storm::expressions::Variable> getVariables() const;
+
+                /*!
+                 * Retrieves the number of bytes that are (approximately) used to store the valuations.
+                 */
+                uint64_t getSizeInBytes() const;
+
                 /*
                  * Derive new state valuations from this by selecting the given states.
                  */
                 StateValuations selectStates(storm::storage::BitVector const& selectedStates) const;
-                
+
                 /*
                  * Derive new state valuations from this by selecting the given states.
                  * If an invalid state index is selected, the corresponding valuation will be empty.
@@ -77,27 +78,90 @@ namespace storm {
                 StateValuations selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const;
 
                 virtual std::size_t hash() const;
-                
+
             private:
-                StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-                bool assertValuation(StateValuation const& valuation) const;
-                StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
-                
+                /*!
+                 * The values of an integer variable for all states. Every value is stored as its difference to a base
+                 * value in two's complement using the given number of bits. If a value is added that can not be
+                 * represented with this number of bits, the values are re-encoded with more bits.
+                 */
+                class IntegerColumn {
+                public:
+                    /*!
+                     * Creates a column that can represent the values in the given range without re-encoding.
+                     */
+                    IntegerColumn(int64_t lowerBound = 0, int64_t upperBound = 0);
+
+                    int64_t get(uint64_t stateIndex) const;
+
+                    /*!
+                     * Sets the value of the given state.
+                     *
+                     * @param numberOfStates The number of states whose values have to be kept if the column is re-encoded.
+                     */
+                    void set(uint64_t stateIndex, int64_t value, uint64_t numberOfStates);
+
+                    /*!
+                     * Removes the storage that is not needed for the given number of states.
+                     */
+                    void shrink(uint64_t numberOfStates);
+
+                    uint64_t getSizeInBytes() const;
+
+                    /*!
+                     * Creates a column with the same encoding as this one for the given number of states, whose values
+                     * are all set to the base value.
+                     */
+                    IntegerColumn createEmptyCopy(uint64_t numberOfStates) const;
+
+                private:
+                    uint64_t getCode(uint64_t stateIndex) const;
+
+                    int64_t baseValue;
+                    uint64_t bitWidth;
+                    storm::storage::BitVector codes;
+                };
+
+                /*!
+                 * Creates valuations for the same variables as the given valuations with the given number of states,
+                 * whose valuations are all empty.
+                 */
+                StateValuations(StateValuations const& variablesSource, uint64_t numberOfStates);
+
+                /*!
+                 * Copies the values of the given state of the given valuations to the given state of these valuations.
+                 */
+                void copyState(StateValuations const& source, uint64_t sourceStateIndex, uint64_t targetStateIndex);
+
                 std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
-                // A mapping from state indices to their variable valuations.
-                std::vector<StateValuation> valuations;
-                
+
+                // The number of states that this object describes.
+                uint64_t numberOfStates = 0;
+
+                // The states for which values were given. All other states have an empty valuation.
+                storm::storage::BitVector nonEmptyStates;
+
+                // For every variable (of the respective type) the values of all states.
+                std::vector<storm::storage::BitVector> booleanColumns;
+                std::vector<IntegerColumn> integerColumns;
+                std::vector<std::vector<storm::RationalNumber>> rationalColumns;
             };
-            
+
             class StateValuationsBuilder {
             public:
                 StateValuationsBuilder();
-                
+
                 /*! Adds a new variable to keep track of for the state valuations.
                  *! All variables need to be added before adding new states.
                  */
                 void addVariable(storm::expressions::Variable const& variable);
-                
+
+                /*!
+                 * Adds a new integer variable whose values are expected to lie in the given range. Values outside the
+                 * range are still admitted, but storing them is more expensive.
+                 */
+                void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+
                 /*!
                  * Adds a new state.
                  * The variable values have to be given in the same order as the variables have been added.
@@ -105,7 +169,7 @@ namespace storm {
                  * After calling this method, no more variables should be added.
                  */
                  void addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues = {}, std::vector<int64_t>&& integerValues = {}, std::vector<storm::RationalNumber>&& rationalValues = {});
-                 
+
                  /*!
                   * Creates the finalized state valuations object.
                   */
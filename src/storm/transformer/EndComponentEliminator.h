@@ -145,7 +145,7 @@ namespace storm {
                 storm::storage::BitVector auxSubsystemStates = subsystemStates;
                 auxSubsystemStates.resize(subsystemStates.size() + 1, true);
                 // The states for which sinkState is reachable under every scheduler can not be part of an EC
-                auxSubsystemStates &= ~(storm::utility::graph::performProbGreater0A(auxiliaryMatrix, auxiliaryMatrix.getRowGroupIndices(), backwardsTransitions, auxSubsystemStates, sinkStateAsBitVector));
+                auxSubsystemStates.andNot(storm::utility::graph::performProbGreater0A(auxiliaryMatrix, auxiliaryMatrix.getRowGroupIndices(), backwardsTransitions, auxSubsystemStates, sinkStateAsBitVector));
                 return storm::storage::MaximalEndComponentDecomposition<ValueType>(auxiliaryMatrix, backwardsTransitions, auxSubsystemStates);
             }
             
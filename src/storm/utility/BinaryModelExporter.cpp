@@ -0,0 +1,242 @@
+#include "storm/utility/BinaryModelExporter.h"
+
+#include <fstream>
+
+#include "storm/utility/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace exporter {
+
+        namespace {
+            using storm::utility::binaryformat::SectionKind;
+
+            uint64_t getPaddedSize(uint64_t size) {
+                return (size + 7) / 8 * 8;
+            }
+
+            uint64_t getStringSize(std::string const& string) {
+                return 8 + getPaddedSize(string.size());
+            }
+
+            uint64_t getBitVectorSize(storm::storage::BitVector const& bitVector) {
+                return (bitVector.size() + 63) / 64 * 8;
+            }
+
+            /*!
+             * Writes the components of the binary format to a stream.
+             */
+            class BinaryWriter {
+            public:
+                BinaryWriter(std::ostream& stream) : stream(stream) {
+                    // Intentionally left empty.
+                }
+
+                void writeNumber(uint64_t value) {
+                    stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+                }
+
+                void writeSectionHeader(SectionKind kind, uint64_t payloadSize) {
+                    writeNumber(static_cast<uint64_t>(kind));
+                    writeNumber(payloadSize);
+                }
+
+                template<typename T>
+                void writeArray(T const* data, uint64_t count) {
+                    stream.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+                    writePadding(count * sizeof(T));
+                }
+
+                void writeString(std::string const& string) {
+                    writeNumber(string.size());
+                    stream.write(string.data(), string.size());
+                    writePadding(string.size());
+                }
+
+                void writeBitVector(storm::storage::BitVector const& bitVector) {
+                    for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+                        writeNumber(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex)));
+                    }
+                }
+
+                /*!
+                 * Writes the given number of values that are provided by the given function in chunks, such that the
+                 * values never have to be held in memory at once.
+                 */
+                template<typename T, typename Generator>
+                void writeGenerated(uint64_t count, Generator const& generator) {
+                    std::vector<T> chunk;
+                    chunk.reserve(std::min<uint64_t>(count, chunkSize));
+                    for (uint64_t index = 0; index < count; ++index) {
+                        chunk.push_back(generator(index));
+                        if (chunk.size() == chunkSize) {
+                            stream.write(reinterpret_cast<char const*>(chunk.data()), chunk.size() * sizeof(T));
+                            chunk.clear();
+                        }
+                    }
+                    stream.write(reinterpret_cast<char const*>(chunk.data()), chunk.size() * sizeof(T));
+                    writePadding(count * sizeof(T));
+                }
+
+            private:
+                void writePadding(uint64_t size) {
+                    static char const zeros[8] = {};
+                    stream.write(zeros, getPaddedSize(size) - size);
+                }
+
+                static const uint64_t chunkSize = 1ull << 16;
+
+                std::ostream& stream;
+            };
+
+            void writeMatrix(BinaryWriter& writer, storm::storage::SparseMatrix<double> const& matrix, bool nondeterministic) {
+                typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double> EntryType;
+                static_assert(sizeof(storm::storage::SparseMatrixIndexType) == 8 && sizeof(EntryType) == 16, "The binary format requires 64-bit indices and entries of 16 bytes.");
+
+                // Deterministic models never carry row group indices, even if their matrix has a (trivial) row grouping.
+                if (nondeterministic) {
+                    std::vector<storm::storage::SparseMatrixIndexType> const& rowGroupIndices = matrix.getRowGroupIndices();
+                    writer.writeSectionHeader(SectionKind::RowGroupIndices, rowGroupIndices.size() * 8);
+                    writer.writeArray(rowGroupIndices.data(), rowGroupIndices.size());
+                }
+
+                writer.writeSectionHeader(SectionKind::RowIndications, (matrix.getRowCount() + 1) * 8);
+                writer.writeGenerated<storm::storage::SparseMatrixIndexType>(matrix.getRowCount() + 1, [&] (uint64_t row) -> storm::storage::SparseMatrixIndexType {
+                    return row < matrix.getRowCount() ? matrix.begin(row) - matrix.begin() : matrix.end() - matrix.begin();
+                });
+
+                // The entries are contiguous in memory, so they are written in one go.
+                uint64_t numberOfEntries = matrix.end() - matrix.begin();
+                writer.writeSectionHeader(SectionKind::Entries, numberOfEntries * sizeof(EntryType));
+                if (numberOfEntries > 0) {
+                    writer.writeArray(&*matrix.begin(), numberOfEntries);
+                }
+            }
+
+            void writeStateValuations(BinaryWriter& writer, storm::storage::sparse::StateValuations const& valuations) {
+                std::vector<storm::expressions::Variable> variables = valuations.getVariables();
+                for (auto const& variable : variables) {
+                    if (!variable.hasBooleanType() && !variable.hasIntegerType()) {
+                        STORM_LOG_WARN("Not exporting the state valuations, because variable '" << variable.getName() << "' is neither boolean nor integer.");
+                        return;
+                    }
+                }
+
+                uint64_t numberOfStates = valuations.getNumberOfStates();
+                storm::storage::BitVector nonEmptyStates(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    nonEmptyStates.set(state, !valuations.isEmpty(state));
+                }
+
+                uint64_t payloadSize = 8 + getBitVectorSize(nonEmptyStates);
+                for (auto const& variable : variables) {
+                    payloadSize += getStringSize(variable.getName()) + 8 + numberOfStates * 8;
+                }
+                writer.writeSectionHeader(SectionKind::StateValuations, payloadSize);
+                writer.writeNumber(variables.size());
+                for (auto const& variable : variables) {
+                    writer.writeString(variable.getName());
+                    writer.writeNumber(variable.hasBooleanType() ? 0 : 1);
+                }
+                writer.writeBitVector(nonEmptyStates);
+                for (auto const& variable : variables) {
+                    writer.writeGenerated<int64_t>(numberOfStates, [&] (uint64_t state) -> int64_t {
+                        if (!nonEmptyStates.get(state)) {
+                            return 0;
+                        }
+                        return variable.hasBooleanType() ? static_cast<int64_t>(valuations.getBooleanValue(state, variable)) : valuations.getIntegerValue(state, variable);
+                    });
+                }
+            }
+        }
+
+        void exportSparseModelAsBinary(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+            STORM_LOG_THROW(sparseModel->getType() != storm::models::ModelType::S2pg, storm::exceptions::NotSupportedException, "Stochastic two player games can not be exported in the binary format.");
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Reward model '" << rewardModel.first << "' has transition rewards, which can not be exported in the binary format.");
+            }
+
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+            BinaryWriter writer(stream);
+
+            // Write the header.
+            stream.write(storm::utility::binaryformat::magic, sizeof(storm::utility::binaryformat::magic));
+            writer.writeNumber(storm::utility::binaryformat::version);
+            writer.writeNumber(storm::utility::binaryformat::byteOrderMark);
+            writer.writeNumber(static_cast<uint64_t>(sparseModel->getType()));
+            writer.writeNumber(sparseModel->getNumberOfStates());
+            writer.writeNumber(sparseModel->getNumberOfChoices());
+            writer.writeNumber(sparseModel->getNumberOfTransitions());
+
+            writeMatrix(writer, sparseModel->getTransitionMatrix(), sparseModel->isNondeterministicModel());
+
+            for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+                storm::storage::BitVector const& states = sparseModel->getStateLabeling().getStates(label);
+                writer.writeSectionHeader(SectionKind::StateLabel, getStringSize(label) + getBitVectorSize(states));
+                writer.writeString(label);
+                writer.writeBitVector(states);
+            }
+
+            if (sparseModel->hasChoiceLabeling()) {
+                for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+                    storm::storage::BitVector const& choices = sparseModel->getChoiceLabeling().getChoices(label);
+                    writer.writeSectionHeader(SectionKind::ChoiceLabel, getStringSize(label) + getBitVectorSize(choices));
+                    writer.writeString(label);
+                    writer.writeBitVector(choices);
+                }
+            }
+
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    std::vector<double> const& rewards = rewardModel.second.getStateRewardVector();
+                    writer.writeSectionHeader(SectionKind::StateRewards, getStringSize(rewardModel.first) + rewards.size() * 8);
+                    writer.writeString(rewardModel.first);
+                    writer.writeArray(rewards.data(), rewards.size());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    std::vector<double> const& rewards = rewardModel.second.getStateActionRewardVector();
+                    writer.writeSectionHeader(SectionKind::StateActionRewards, getStringSize(rewardModel.first) + rewards.size() * 8);
+                    writer.writeString(rewardModel.first);
+                    writer.writeArray(rewards.data(), rewards.size());
+                }
+            }
+
+            if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+                std::vector<double> const& exitRates = sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+                writer.writeSectionHeader(SectionKind::ExitRates, exitRates.size() * 8);
+                writer.writeArray(exitRates.data(), exitRates.size());
+            } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+                auto markovAutomaton = sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>();
+                writer.writeSectionHeader(SectionKind::ExitRates, markovAutomaton->getExitRates().size() * 8);
+                writer.writeArray(markovAutomaton->getExitRates().data(), markovAutomaton->getExitRates().size());
+                writer.writeSectionHeader(SectionKind::MarkovianStates, getBitVectorSize(markovAutomaton->getMarkovianStates()));
+                writer.writeBitVector(markovAutomaton->getMarkovianStates());
+            } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+                std::vector<uint32_t> const& observations = sparseModel->template as<storm::models::sparse::Pomdp<double>>()->getObservations();
+                writer.writeSectionHeader(SectionKind::Observations, observations.size() * 8);
+                writer.writeGenerated<uint64_t>(observations.size(), [&] (uint64_t state) {
+                    return static_cast<uint64_t>(observations[state]);
+                });
+            }
+
+            if (sparseModel->hasStateValuations()) {
+                writeStateValuations(writer, sparseModel->getStateValuations());
+            }
+
+            writer.writeSectionHeader(SectionKind::End, 0);
+            stream.close();
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write the model to file " << filename << ".");
+        }
+
+    }
+}
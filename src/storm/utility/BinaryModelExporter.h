@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * Exports a sparse model into the binary format (see storm/utility/BinaryModelFormat.h), which can be loaded
+         * without parsing. Besides the transition matrix, the state labeling, the reward models, the choice labeling
+         * and the state valuations (if present) are exported.
+         *
+         * @param filename The file to export to.
+         * @param sparseModel The model to export.
+         */
+        void exportSparseModelAsBinary(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+    }
+}
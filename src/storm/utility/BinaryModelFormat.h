@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+    namespace utility {
+        namespace binaryformat {
+
+            /*
+             * A binary model file stores the data of a sparse model as it is held in memory, so it can be loaded by
+             * mapping the file into memory and copying every array once into its final place. In particular, the
+             * entries of the transition matrix are stored as the column-value pairs of the matrix and the row
+             * indications and row group indices as the index vectors of the matrix. All numbers are stored in the byte
+             * order of the machine that wrote the file, which is recorded in the header.
+             *
+             * The file starts with the header, i.e. the magic bytes, the format version, the byte order mark, the model
+             * type, the number of states, the number of choices and the number of transitions (each as a 64-bit
+             * number). The header is followed by a sequence of sections that is terminated by a section of kind End.
+             * Every section consists of its kind, the size of its payload in bytes and the payload, which is padded
+             * with zeros to a multiple of eight bytes. Strings are stored as their length followed by their characters
+             * (padded to a multiple of eight bytes) and bit vectors as a sequence of 64-bit words. The payload size of
+             * every known section has to match its contents exactly.
+             */
+
+            // The first bytes of every binary model file.
+            char const magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+
+            // The version of the format, which is to be increased whenever the layout changes.
+            uint64_t const version = 2;
+
+            // A number whose representation reveals the byte order of the file.
+            uint64_t const byteOrderMark = 0x0102030405060708ull;
+
+            enum class SectionKind : uint64_t {
+                // The indices of the first rows of all row groups and the number of rows (only for nondeterministic models).
+                RowGroupIndices = 1,
+                // The indices of the first entries of all rows and the number of entries.
+                RowIndications = 2,
+                // The entries of all rows as pairs of a 64-bit column and a double value. The kind 4 is no longer used,
+                // because version 1 stored the columns and the values in separate sections.
+                Entries = 3,
+                // The name of a state label followed by the bit vector of its states.
+                StateLabel = 5,
+                // The name of a choice label followed by the bit vector of its choices.
+                ChoiceLabel = 6,
+                // The name of a reward model followed by the reward of every state.
+                StateRewards = 7,
+                // The name of a reward model followed by the reward of every choice.
+                StateActionRewards = 8,
+                // The exit rate of every state (only for CTMCs and Markov automata).
+                ExitRates = 9,
+                // The bit vector of Markovian states (only for Markov automata).
+                MarkovianStates = 10,
+                // The observation of every state as a 64-bit number (only for POMDPs).
+                Observations = 11,
+                // The number of variables, the name and type (0 for boolean, 1 for integer) of each variable, the bit
+                // vector of states with a valuation and the value of every variable in every state as a 64-bit number.
+                StateValuations = 12,
+                // Marks the end of the file.
+                End = 13
+            };
+
+        }
+    }
+}
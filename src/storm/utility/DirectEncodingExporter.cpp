@@ -1,9 +1,14 @@
 #include <storm/exceptions/NotSupportedException.h>
 #include "DirectEncodingExporter.h"
 
+#include <cstdio>
+#include <limits>
+#include <sstream>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -17,6 +22,187 @@
 namespace storm {
     namespace exporter {
 
+        namespace {
+            // The number of states that are formatted into one buffer before it is written to the stream.
+            uint64_t const statesPerBlock = 4096;
+
+            void appendIndex(std::string& buffer, uint64_t value) {
+                char digits[20];
+                char* position = digits + sizeof(digits);
+                do {
+                    *--position = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                } while (value != 0);
+                buffer.append(position, digits + sizeof(digits) - position);
+            }
+
+            /*!
+             * Formats the states of a model (with their choices and transitions) in the DRN format. The output is the
+             * same as when writing all tokens to the given stream, but different blocks of states can be formatted
+             * independently of each other.
+             */
+            template<typename ValueType>
+            class DrnStateWriter {
+            public:
+                DrnStateWriter(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<ValueType> const& exitRates, std::unordered_map<ValueType, std::string> const& placeholders, std::ostream const& os) : model(*model), matrix(model->getTransitionMatrix()), exitRates(exitRates), placeholders(placeholders), flags(os.flags()), precision(os.precision()), locale(os.getloc()) {
+                    if (model->getType() == storm::models::ModelType::Pomdp) {
+                        pomdp = model->template as<storm::models::sparse::Pomdp<ValueType>>();
+                    }
+                    for (auto const& rewardModelEntry : model->getRewardModels()) {
+                        rewardModels.push_back(&rewardModelEntry.second);
+                    }
+                    // Doubles are formatted with printf unless the stream uses flags that printf("%g") does not reflect.
+                    fastDoubleFormatting = (flags & (std::ios_base::floatfield | std::ios_base::showpoint | std::ios_base::showpos | std::ios_base::uppercase)) == 0;
+                }
+
+                /*!
+                 * Appends the states firstState, ..., lastState - 1 to the given buffer.
+                 */
+                void writeStates(uint64_t firstState, uint64_t lastState, std::string& buffer) const {
+                    std::ostringstream formatter;
+                    formatter.flags(flags);
+                    formatter.precision(precision);
+                    formatter.imbue(locale);
+
+                    for (uint64_t state = firstState; state < lastState; ++state) {
+                        buffer += "state ";
+                        appendIndex(buffer, state);
+
+                        // Write exit rates for CTMCs and MAs
+                        if (!exitRates.empty()) {
+                            buffer += " !";
+                            appendValue(buffer, exitRates[state], formatter);
+                        }
+
+                        if (pomdp) {
+                            buffer += " {";
+                            appendIndex(buffer, pomdp->getObservation(state));
+                            buffer += "}";
+                        }
+
+                        // Write state rewards
+                        bool first = true;
+                        for (auto const& rewardModel : rewardModels) {
+                            buffer += first ? " [" : ", ";
+                            first = false;
+                            if (rewardModel->hasStateRewards()) {
+                                appendValue(buffer, rewardModel->getStateRewardVector()[state], formatter);
+                            } else {
+                                buffer += "0";
+                            }
+                        }
+                        if (!first) {
+                            buffer += "]";
+                        }
+
+                        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+                        for (auto const& label : model.getStateLabeling().getLabelsOfState(state)) {
+                            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                                buffer += " \"";
+                                buffer += label;
+                                buffer += "\"";
+                            } else {
+                                buffer += " ";
+                                buffer += label;
+                            }
+                        }
+                        buffer += "\n";
+                        // Write state valuations as comments
+                        if (model.hasStateValuations()) {
+                            buffer += "//";
+                            buffer += model.getStateValuations().getStateInfo(state);
+                            buffer += "\n";
+                        }
+
+                        // Write probabilities
+                        uint64_t start = matrix.hasTrivialRowGrouping() ? state : matrix.getRowGroupIndices()[state];
+                        uint64_t end = matrix.hasTrivialRowGrouping() ? state + 1 : matrix.getRowGroupIndices()[state + 1];
+
+                        // Iterate over all actions
+                        for (uint64_t row = start; row < end; ++row) {
+                            // Write choice
+                            buffer += "\taction ";
+                            if (model.hasChoiceLabeling()) {
+                                auto const& labels = model.getChoiceLabeling().getLabelsOfChoice(row);
+                                if (labels.empty()) {
+                                    buffer += "__NOLABEL__";
+                                }
+                                // The labels are concatenated without a separator.
+                                for (auto const& label : labels) {
+                                    buffer += label;
+                                }
+                            } else {
+                                appendIndex(buffer, row - start);
+                            }
+
+                            // Write action rewards
+                            first = true;
+                            for (auto const& rewardModel : rewardModels) {
+                                buffer += first ? " [" : ", ";
+                                first = false;
+                                if (rewardModel->hasStateActionRewards()) {
+                                    appendValue(buffer, rewardModel->getStateActionRewardVector()[row], formatter);
+                                } else {
+                                    buffer += "0";
+                                }
+                            }
+                            if (!first) {
+                                buffer += "]";
+                            }
+                            buffer += "\n";
+
+                            // Write transitions
+                            for (auto const& entry : matrix.getRow(row)) {
+                                buffer += "\t\t";
+                                appendIndex(buffer, entry.getColumn());
+                                buffer += " : ";
+                                appendValue(buffer, entry.getValue(), formatter);
+                                buffer += "\n";
+                            }
+                        }
+                    }
+                }
+
+            private:
+                void appendValue(std::string& buffer, ValueType const& value, std::ostringstream& formatter) const {
+                    formatter.str(std::string());
+                    writeValue(formatter, value, placeholders);
+                    buffer += formatter.str();
+                }
+
+                storm::models::sparse::Model<ValueType> const& model;
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::vector<ValueType> const& exitRates;
+                std::unordered_map<ValueType, std::string> const& placeholders;
+                std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> pomdp;
+                std::vector<typename storm::models::sparse::Model<ValueType>::RewardModelType const*> rewardModels;
+
+                // The format of the stream to which the states are written.
+                std::ios_base::fmtflags flags;
+                std::streamsize precision;
+                std::locale locale;
+                bool fastDoubleFormatting;
+            };
+
+            template<>
+            void DrnStateWriter<double>::appendValue(std::string& buffer, double const& value, std::ostringstream& formatter) const {
+                if (fastDoubleFormatting) {
+                    char digits[64];
+                    int length = std::snprintf(digits, sizeof(digits), "%.*g", static_cast<int>(precision), value);
+                    if (length > 0 && static_cast<uint64_t>(length) < sizeof(digits)) {
+                        buffer.append(digits, length);
+                        return;
+                    }
+                }
+                formatter.str(std::string());
+                formatter << value;
+                buffer += formatter.str();
+            }
+        }
+
         template<typename ValueType>
         void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
 
@@ -69,118 +255,36 @@ namespace storm {
             os << "@nr_choices" << std::endl << sparseModel->getNumberOfChoices() << std::endl;
             os << "@model" << std::endl;
 
-            storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-
             // Iterate over states and export state information and outgoing transitions
-            for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-                os << "state " << group;
-
-                // Write exit rates for CTMCs and MAs
-                if (!exitRates.empty()) {
-                    os << " !";
-                    writeValue(os, exitRates.at(group), placeholders);
-                }
-
-
-                if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-                    os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+            // The states are formatted in blocks, which avoids the overhead of writing every single token to the stream.
+            DrnStateWriter<ValueType> writer(sparseModel, exitRates, placeholders, os);
+            uint64_t numberOfStates = sparseModel->getNumberOfStates();
+            // Only doubles are formatted concurrently, as we do not rely on the output of the other types being thread-safe.
+            uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? std::max<uint64_t>(options.numberOfThreads, 1) : 1;
+            if (numberOfThreads == 1) {
+                std::string buffer;
+                for (uint64_t firstState = 0; firstState < numberOfStates; firstState += statesPerBlock) {
+                    buffer.clear();
+                    writer.writeStates(firstState, std::min(firstState + statesPerBlock, numberOfStates), buffer);
+                    os.write(buffer.data(), buffer.size());
                 }
-
-                // Write state rewards
-                bool first = true;
-                for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                    if (first) {
-                        os << " [";
-                        first = false;
-                    } else {
-                        os << ", ";
-                    }
-
-                    if (rewardModelEntry.second.hasStateRewards()) {
-                        writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-                    } else {
-                        os << "0";
-                    }
-                }
-
-                if (!first) {
-                    os << "]";
-                }
-
-                // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-                for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-                    STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                                    "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-                    // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-                    if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                        os << " \"" << label << "\"";
-                    } else {
-                        os << " " << label;
-                    }
-                }
-                os << std::endl;
-                // Write state valuations as comments
-                if(sparseModel->hasStateValuations()) {
-                    os << "//" << sparseModel->getStateValuations().getStateInfo(group) << std::endl;
-                }
-
-                // Write probabilities
-                typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-                typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-                // Iterate over all actions
-                for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-                    // Write choice
-                    if (sparseModel->hasChoiceLabeling()) {
-                        os << "\taction ";
-                        bool lfirst = true;
-                        if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                            os << "__NOLABEL__";
-                        }
-                        for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                            if (!lfirst) {
-                                os << "_";
-                                lfirst = false;
-                            }
-                            os << label;
-                        }
-                    } else {
-                        os << "\taction " << row - start;
-                    }
-
-                    // Write action rewards
-                    bool first = true;
-                    for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                        if (first) {
-                            os << " [";
-                            first = false;
-                        } else {
-                            os << ", ";
-                        }
-
-                        if (rewardModelEntry.second.hasStateActionRewards()) {
-                            writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                        } else {
-                            os << "0";
-                        }
-
-                    }
-                    if (!first) {
-                        os << "]";
-                    }
-                    os << std::endl;
-
-                    // Write transitions
-                    for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                        ValueType prob = it->getValue();
-                        os << "\t\t" << it->getColumn() << " : ";
-                        writeValue(os, prob, placeholders);
-                        os << std::endl;
+            } else {
+                // Format a bounded number of blocks concurrently and write them in their original order.
+                std::vector<std::string> buffers(numberOfThreads * 4);
+                uint64_t statesPerRound = statesPerBlock * buffers.size();
+                for (uint64_t firstState = 0; firstState < numberOfStates; firstState += statesPerRound) {
+                    uint64_t numberOfBlocks = (std::min(statesPerRound, numberOfStates - firstState) + statesPerBlock - 1) / statesPerBlock;
+                    storm::utility::ThreadPool::getGlobalInstance(numberOfThreads).execute(numberOfBlocks, [&] (uint64_t block) {
+                        uint64_t blockStart = firstState + block * statesPerBlock;
+                        buffers[block].clear();
+                        writer.writeStates(blockStart, std::min(blockStart + statesPerBlock, numberOfStates), buffers[block]);
+                    });
+                    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+                        os.write(buffers[block].data(), buffers[block].size());
                     }
-
                 }
-            } // end state iteration
-
+            }
+            os.flush();
         }
 
         template<typename ValueType>
@@ -207,20 +311,70 @@ namespace storm {
             return {};
         }
 
+        namespace {
+            /*!
+             * A count-min sketch that estimates how often values were seen so far. The estimate never underestimates the
+             * true count, but may overestimate it due to hash collisions. The counters saturate instead of overflowing.
+             */
+            class CountMinSketch {
+            public:
+                /*!
+                 * Creates a sketch whose width is suitable for the given number of values.
+                 */
+                explicit CountMinSketch(uint64_t numberOfValues) {
+                    width = 1ull << 10;
+                    while (width < numberOfValues && width < (1ull << 24)) {
+                        width <<= 1;
+                    }
+                    counters.resize(width * depth, 0);
+                }
+
+                /*!
+                 * Increments the count of the value with the given hash and returns the estimated count before the increment.
+                 */
+                uint8_t increment(uint64_t hash) {
+                    uint8_t estimate = std::numeric_limits<uint8_t>::max();
+                    for (uint64_t row = 0; row < depth; ++row) {
+                        uint8_t& counter = counters[row * width + (mix(hash + row * 0x9e3779b97f4a7c15ull) & (width - 1))];
+                        estimate = std::min(estimate, counter);
+                        if (counter < std::numeric_limits<uint8_t>::max()) {
+                            ++counter;
+                        }
+                    }
+                    return estimate;
+                }
+
+            private:
+                // Scrambles the bits of the hash (the finalizer of splitmix64), such that each row uses an independent index.
+                static uint64_t mix(uint64_t value) {
+                    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+                    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+                    return value ^ (value >> 31);
+                }
+
+                static const uint64_t depth = 4;
+                uint64_t width;
+                std::vector<uint8_t> counters;
+            };
+        }
+
         /*!
          * Helper function to create a possible placeholder.
-         * A new placeholder is inserted if the rational function is not constant and the function does not exist yet.
+         * A new placeholder is inserted if the rational function is not constant, it was (presumably) seen before and
+         * the function does not have a placeholder yet.
          * @param placeholders Existing placeholders.
+         * @param sketch Sketch of the functions seen so far.
          * @param value Value.
          * @param i Counter to enumerate placeholders.
          */
-
-        void createPlaceholder(std::unordered_map<storm::RationalFunction, std::string>& placeholders, storm::RationalFunction const& value, size_t& i) {
+        void createPlaceholder(std::unordered_map<storm::RationalFunction, std::string>& placeholders, CountMinSketch& sketch, storm::RationalFunction const& value, size_t& i) {
             if (!storm::utility::isConstant(value)) {
-                auto ret = placeholders.insert(std::make_pair(value, std::to_string(i)));
-                if (ret.second) {
-                    // New element was inserted
-                    ++i;
+                if (sketch.increment(std::hash<storm::RationalFunction>()(value)) > 0) {
+                    auto ret = placeholders.insert(std::make_pair(value, std::to_string(i)));
+                    if (ret.second) {
+                        // New element was inserted
+                        ++i;
+                    }
                 }
             }
         }
@@ -229,30 +383,31 @@ namespace storm {
         std::unordered_map<storm::RationalFunction, std::string>
         generatePlaceholders(std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<storm::RationalFunction> exitRates) {
             std::unordered_map<storm::RationalFunction, std::string> placeholders;
+            CountMinSketch sketch(sparseModel->getTransitionMatrix().getEntryCount() + exitRates.size());
             size_t i = 0;
 
             // Exit rates
             for (auto const& exitRate : exitRates) {
-                createPlaceholder(placeholders, exitRate, i);
+                createPlaceholder(placeholders, sketch, exitRate, i);
             }
 
             // Rewards
             for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
                 if (rewardModelEntry.second.hasStateRewards()) {
                     for (auto const& reward : rewardModelEntry.second.getStateRewardVector()) {
-                        createPlaceholder(placeholders, reward, i);
+                        createPlaceholder(placeholders, sketch, reward, i);
                     }
                 }
                 if (rewardModelEntry.second.hasStateActionRewards()) {
                     for (auto const& reward : rewardModelEntry.second.getStateActionRewardVector()) {
-                        createPlaceholder(placeholders, reward, i);
+                        createPlaceholder(placeholders, sketch, reward, i);
                     }
                 }
             }
 
             // Transition probabilities
             for (auto const& entry : sparseModel->getTransitionMatrix()) {
-                createPlaceholder(placeholders, entry.getValue(), i);
+                createPlaceholder(placeholders, sketch, entry.getValue(), i);
             }
 
             return placeholders;
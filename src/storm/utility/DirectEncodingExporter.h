@@ -10,13 +10,18 @@ namespace storm {
 
         struct DirectEncodingOptions {
             bool allowPlaceholders = true;
+            // The number of threads that format the states (only supported for double).
+            uint64_t numberOfThreads = 1;
         };
         /*!
          * Exports a sparse model into the explicit DRN format.
+         * The states are formatted in blocks that are written to the stream at once. If multiple threads are requested,
+         * several blocks are formatted concurrently.
          *
          * @param os           Stream to export to
          * @param sparseModel  Model to export
          * @param parameters   List of parameters
+         * @param options      Options for the export
          */
         template<typename ValueType>
         void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options=DirectEncodingOptions());
@@ -33,6 +38,8 @@ namespace storm {
 
         /*!
          * Generate placeholders for rational functions in the model.
+         * Only functions that (presumably) occur more than once get a placeholder. Repetitions are detected in a single
+         * pass with a count-min sketch, so a function that occurs only once may get a placeholder in rare cases.
          *
          * @param sparseModel Model.
          * @param exitRates Exit rates.
@@ -0,0 +1,87 @@
+#include "storm/utility/GzipInputStreamBuffer.h"
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace utility {
+
+#ifdef STORM_HAVE_ZLIB
+        struct GzipInputStreamBuffer::DecompressorState {
+            z_stream stream;
+        };
+
+        GzipInputStreamBuffer::GzipInputStreamBuffer(std::istream& source) : source(source), inputBuffer(1 << 18), outputBuffer(1 << 18), decompressorState(std::make_unique<DecompressorState>()), finished(false) {
+            z_stream& stream = decompressorState->stream;
+            stream.zalloc = Z_NULL;
+            stream.zfree = Z_NULL;
+            stream.opaque = Z_NULL;
+            stream.next_in = Z_NULL;
+            stream.avail_in = 0;
+            // Adding 16 to the window bits makes zlib expect a gzip header and trailer.
+            int result = inflateInit2(&stream, 15 + 16);
+            STORM_LOG_THROW(result == Z_OK, storm::exceptions::FileIoException, "Could not initialize the gzip decompression.");
+            setg(outputBuffer.data(), outputBuffer.data(), outputBuffer.data());
+        }
+
+        GzipInputStreamBuffer::~GzipInputStreamBuffer() {
+            inflateEnd(&decompressorState->stream);
+        }
+
+        bool GzipInputStreamBuffer::isSupported() {
+            return true;
+        }
+
+        GzipInputStreamBuffer::int_type GzipInputStreamBuffer::underflow() {
+            if (gptr() < egptr()) {
+                return traits_type::to_int_type(*gptr());
+            }
+            z_stream& stream = decompressorState->stream;
+            while (!finished) {
+                if (stream.avail_in == 0) {
+                    source.read(inputBuffer.data(), inputBuffer.size());
+                    stream.next_in = reinterpret_cast<Bytef*>(inputBuffer.data());
+                    stream.avail_in = static_cast<uInt>(source.gcount());
+                    STORM_LOG_THROW(stream.avail_in > 0, storm::exceptions::FileIoException, "Unexpected end of the gzip compressed data.");
+                }
+                stream.next_out = reinterpret_cast<Bytef*>(outputBuffer.data());
+                stream.avail_out = static_cast<uInt>(outputBuffer.size());
+                int result = inflate(&stream, Z_NO_FLUSH);
+                STORM_LOG_THROW(result == Z_OK || result == Z_STREAM_END, storm::exceptions::FileIoException, "Error during gzip decompression.");
+                finished = result == Z_STREAM_END;
+                uint64_t decompressedSize = outputBuffer.size() - stream.avail_out;
+                if (decompressedSize > 0) {
+                    setg(outputBuffer.data(), outputBuffer.data(), outputBuffer.data() + decompressedSize);
+                    return traits_type::to_int_type(*gptr());
+                }
+            }
+            return traits_type::eof();
+        }
+#else
+        struct GzipInputStreamBuffer::DecompressorState {
+        };
+
+        GzipInputStreamBuffer::GzipInputStreamBuffer(std::istream& source) : source(source), finished(true) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Gzip decompression requires that storm is built with zlib.");
+        }
+
+        GzipInputStreamBuffer::~GzipInputStreamBuffer() = default;
+
+        bool GzipInputStreamBuffer::isSupported() {
+            return false;
+        }
+
+        GzipInputStreamBuffer::int_type GzipInputStreamBuffer::underflow() {
+            return traits_type::eof();
+        }
+#endif
+
+    }
+}
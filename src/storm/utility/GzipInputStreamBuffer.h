@@ -0,0 +1,46 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A stream buffer that reads gzip compressed data from another stream and provides the decompressed data.
+         * Requires that storm was built with zlib.
+         */
+        class GzipInputStreamBuffer : public std::streambuf {
+        public:
+            /*!
+             * Creates a buffer that reads the compressed data from the given stream.
+             *
+             * @param source The stream to read from. It must outlive the buffer.
+             */
+            explicit GzipInputStreamBuffer(std::istream& source);
+
+            ~GzipInputStreamBuffer();
+
+            /*!
+             * Retrieves whether storm was built with support for gzip compression.
+             */
+            static bool isSupported();
+
+        protected:
+            virtual int_type underflow() override;
+
+        private:
+            std::istream& source;
+            std::vector<char> inputBuffer;
+            std::vector<char> outputBuffer;
+
+            // The state of the decompressor (hidden to avoid exposing the zlib header).
+            struct DecompressorState;
+            std::unique_ptr<DecompressorState> decompressorState;
+            bool finished;
+        };
+
+    }
+}
@@ -0,0 +1,119 @@
+#include "storm/utility/GzipOutputStreamBuffer.h"
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace utility {
+
+#ifdef STORM_HAVE_ZLIB
+        struct GzipOutputStreamBuffer::CompressorState {
+            z_stream stream;
+        };
+
+        GzipOutputStreamBuffer::GzipOutputStreamBuffer(std::ostream& target) : target(target), inputBuffer(1 << 18), outputBuffer(1 << 18), compressorState(std::make_unique<CompressorState>()), finished(false) {
+            compressorState->stream.zalloc = Z_NULL;
+            compressorState->stream.zfree = Z_NULL;
+            compressorState->stream.opaque = Z_NULL;
+            // Adding 16 to the window bits makes zlib write a gzip header and trailer.
+            int result = deflateInit2(&compressorState->stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+            STORM_LOG_THROW(result == Z_OK, storm::exceptions::FileIoException, "Could not initialize the gzip compression.");
+            setp(inputBuffer.data(), inputBuffer.data() + inputBuffer.size());
+        }
+
+        GzipOutputStreamBuffer::~GzipOutputStreamBuffer() {
+            if (!finished) {
+                try {
+                    finish();
+                } catch (...) {
+                    STORM_LOG_ERROR("Could not finish the gzip compressed stream.");
+                }
+            }
+            deflateEnd(&compressorState->stream);
+        }
+
+        void GzipOutputStreamBuffer::finish() {
+            STORM_LOG_ASSERT(!finished, "The compressed stream was already finished.");
+            compress(true);
+            finished = true;
+            target.flush();
+        }
+
+        bool GzipOutputStreamBuffer::isSupported() {
+            return true;
+        }
+
+        GzipOutputStreamBuffer::int_type GzipOutputStreamBuffer::overflow(int_type character) {
+            if (finished) {
+                return traits_type::eof();
+            }
+            compress(false);
+            if (!traits_type::eq_int_type(character, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(character);
+                pbump(1);
+            }
+            return traits_type::not_eof(character);
+        }
+
+        int GzipOutputStreamBuffer::sync() {
+            if (!finished) {
+                compress(false);
+            }
+            return target ? 0 : -1;
+        }
+
+        void GzipOutputStreamBuffer::compress(bool finish) {
+            z_stream& stream = compressorState->stream;
+            stream.next_in = reinterpret_cast<Bytef*>(pbase());
+            stream.avail_in = static_cast<uInt>(pptr() - pbase());
+            int result;
+            do {
+                stream.next_out = reinterpret_cast<Bytef*>(outputBuffer.data());
+                stream.avail_out = static_cast<uInt>(outputBuffer.size());
+                result = deflate(&stream, finish ? Z_FINISH : Z_NO_FLUSH);
+                STORM_LOG_THROW(result != Z_STREAM_ERROR, storm::exceptions::FileIoException, "Error during gzip compression.");
+                target.write(outputBuffer.data(), outputBuffer.size() - stream.avail_out);
+            } while (stream.avail_out == 0 || (finish && result != Z_STREAM_END));
+            STORM_LOG_THROW(target, storm::exceptions::FileIoException, "Could not write the compressed data.");
+            setp(inputBuffer.data(), inputBuffer.data() + inputBuffer.size());
+        }
+#else
+        struct GzipOutputStreamBuffer::CompressorState {
+        };
+
+        GzipOutputStreamBuffer::GzipOutputStreamBuffer(std::ostream& target) : target(target), finished(true) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Gzip compression requires that storm is built with zlib.");
+        }
+
+        GzipOutputStreamBuffer::~GzipOutputStreamBuffer() = default;
+
+        void GzipOutputStreamBuffer::finish() {
+            // Intentionally left empty.
+        }
+
+        bool GzipOutputStreamBuffer::isSupported() {
+            return false;
+        }
+
+        GzipOutputStreamBuffer::int_type GzipOutputStreamBuffer::overflow(int_type) {
+            return traits_type::eof();
+        }
+
+        int GzipOutputStreamBuffer::sync() {
+            return -1;
+        }
+
+        void GzipOutputStreamBuffer::compress(bool) {
+            // Intentionally left empty.
+        }
+#endif
+
+    }
+}
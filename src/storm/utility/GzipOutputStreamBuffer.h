@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A stream buffer that compresses all data written to it in the gzip format and writes the compressed data to
+         * another stream. Requires that storm was built with zlib.
+         */
+        class GzipOutputStreamBuffer : public std::streambuf {
+        public:
+            /*!
+             * Creates a buffer that writes the compressed data to the given stream.
+             *
+             * @param target The stream to write to. It must outlive the buffer.
+             */
+            explicit GzipOutputStreamBuffer(std::ostream& target);
+
+            /*!
+             * Finishes the compressed stream (if this was not yet done).
+             */
+            ~GzipOutputStreamBuffer();
+
+            /*!
+             * Compresses the remaining data and writes the end of the compressed stream. Afterwards, no more data may
+             * be written.
+             */
+            void finish();
+
+            /*!
+             * Retrieves whether storm was built with support for gzip compression.
+             */
+            static bool isSupported();
+
+        protected:
+            virtual int_type overflow(int_type character) override;
+            virtual int sync() override;
+
+        private:
+            void compress(bool finish);
+
+            std::ostream& target;
+            std::vector<char> inputBuffer;
+            std::vector<char> outputBuffer;
+
+            // The state of the compressor (hidden to avoid exposing the zlib header).
+            struct CompressorState;
+            std::unique_ptr<CompressorState> compressorState;
+            bool finished;
+        };
+
+    }
+}
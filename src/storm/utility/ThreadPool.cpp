@@ -0,0 +1,185 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <map>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        namespace {
+            // Set for threads that currently execute tasks of a pool to detect nested calls.
+            thread_local bool isExecutingTasks = false;
+        }
+
+        ThreadPool::ThreadPool(uint64_t numberOfThreads) : currentTask(nullptr), round(0), busyWorkers(0), stop(false) {
+            STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "A thread pool needs at least one thread.");
+            for (uint64_t index = 0; index < numberOfThreads; ++index) {
+                taskRanges.push_back(std::make_unique<TaskRange>());
+            }
+            for (uint64_t index = 1; index < numberOfThreads; ++index) {
+                workers.emplace_back(&ThreadPool::workerLoop, this, index);
+            }
+        }
+
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            roundStarted.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        uint64_t ThreadPool::getNumberOfThreads() const {
+            return taskRanges.size();
+        }
+
+        void ThreadPool::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+            if (workers.empty() || numberOfTasks <= 1 || isExecutingTasks) {
+                for (uint64_t index = 0; index < numberOfTasks; ++index) {
+                    task(index);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> executeLock(executeMutex);
+
+            // Distribute the tasks evenly among the threads.
+            uint64_t numberOfThreads = getNumberOfThreads();
+            uint64_t tasksPerThread = numberOfTasks / numberOfThreads;
+            uint64_t remainder = numberOfTasks % numberOfThreads;
+            uint64_t begin = 0;
+            for (uint64_t index = 0; index < numberOfThreads; ++index) {
+                TaskRange& range = *taskRanges[index];
+                std::lock_guard<std::mutex> lock(range.mutex);
+                range.begin = begin;
+                begin += tasksPerThread + (index < remainder ? 1 : 0);
+                range.end = begin;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                currentTask = &task;
+                exception = nullptr;
+                busyWorkers = workers.size();
+                ++round;
+            }
+            roundStarted.notify_all();
+
+            isExecutingTasks = true;
+            work(0);
+            isExecutingTasks = false;
+
+            // Wait until all workers are done, because they might still execute a (stolen) task.
+            std::exception_ptr thrownException;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                roundFinished.wait(lock, [this] { return busyWorkers == 0; });
+                currentTask = nullptr;
+                std::swap(thrownException, exception);
+            }
+            if (thrownException) {
+                std::rethrow_exception(thrownException);
+            }
+        }
+
+        void ThreadPool::workerLoop(uint64_t index) {
+            isExecutingTasks = true;
+            uint64_t lastRound = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    roundStarted.wait(lock, [this, &lastRound] { return stop || round != lastRound; });
+                    if (stop) {
+                        return;
+                    }
+                    lastRound = round;
+                }
+
+                work(index);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --busyWorkers;
+                    if (busyWorkers == 0) {
+                        roundFinished.notify_one();
+                    }
+                }
+            }
+        }
+
+        void ThreadPool::work(uint64_t index) {
+            uint64_t task;
+            while (takeOwnTask(index, task) || stealTask(index, task)) {
+                try {
+                    (*currentTask)(task);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        bool ThreadPool::takeOwnTask(uint64_t index, uint64_t& task) {
+            TaskRange& range = *taskRanges[index];
+            std::lock_guard<std::mutex> lock(range.mutex);
+            if (range.begin < range.end) {
+                task = range.begin;
+                ++range.begin;
+                return true;
+            }
+            return false;
+        }
+
+        bool ThreadPool::stealTask(uint64_t index, uint64_t& task) {
+            uint64_t numberOfThreads = getNumberOfThreads();
+            for (uint64_t offset = 1; offset < numberOfThreads; ++offset) {
+                uint64_t stolenBegin;
+                uint64_t stolenEnd;
+                {
+                    TaskRange& victim = *taskRanges[(index + offset) % numberOfThreads];
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if (victim.begin == victim.end) {
+                        continue;
+                    }
+                    // Take the upper half of the remaining tasks (but at least one).
+                    stolenBegin = victim.begin + (victim.end - victim.begin) / 2;
+                    stolenEnd = victim.end;
+                    victim.end = stolenBegin;
+                }
+
+                // Our own range is empty, so we can keep the rest of the stolen tasks there.
+                task = stolenBegin;
+                TaskRange& range = *taskRanges[index];
+                std::lock_guard<std::mutex> lock(range.mutex);
+                range.begin = stolenBegin + 1;
+                range.end = stolenEnd;
+                return true;
+            }
+            return false;
+        }
+
+        bool ThreadPool::isExecutingTask() {
+            return isExecutingTasks;
+        }
+
+        ThreadPool& ThreadPool::getGlobalInstance(uint64_t numberOfThreads) {
+            static std::mutex instanceMutex;
+            // A pool is never destroyed before the program ends, because other threads might still use it.
+            static std::map<uint64_t, std::unique_ptr<ThreadPool>> instances;
+            std::lock_guard<std::mutex> lock(instanceMutex);
+            std::unique_ptr<ThreadPool>& instance = instances[numberOfThreads];
+            if (!instance) {
+                instance = std::make_unique<ThreadPool>(numberOfThreads);
+            }
+            return *instance;
+        }
+
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A pool of worker threads that executes a number of independent tasks in parallel. The tasks of one call to
+         * execute are initially split into contiguous ranges, one per thread. Threads that run out of work steal
+         * half of the remaining range of another thread, which balances the load if the tasks differ in cost.
+         */
+        class ThreadPool {
+        public:
+            /*!
+             * Creates a pool that executes tasks with the given number of threads. The thread calling execute counts
+             * as one of them, so numberOfThreads - 1 workers are started.
+             *
+             * @param numberOfThreads The number of threads to use. Must be at least one.
+             */
+            explicit ThreadPool(uint64_t numberOfThreads);
+
+            ~ThreadPool();
+
+            ThreadPool(ThreadPool const& other) = delete;
+            ThreadPool& operator=(ThreadPool const& other) = delete;
+
+            /*!
+             * Retrieves the number of threads (including the calling thread) that execute the tasks.
+             */
+            uint64_t getNumberOfThreads() const;
+
+            /*!
+             * Executes task(i) for all i in 0, ..., numberOfTasks - 1 and returns when all tasks are finished. If one
+             * of the tasks throws, the (first) exception is rethrown after all tasks were processed.
+             * If this is called from within a task, the tasks are executed sequentially by the calling thread.
+             *
+             * @param numberOfTasks The number of tasks.
+             * @param task The function that executes a single task.
+             */
+            void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task);
+
+            /*!
+             * Retrieves whether the calling thread currently executes a task of some pool. Calls to execute from such
+             * a thread are processed sequentially.
+             */
+            static bool isExecutingTask();
+
+            /*!
+             * Retrieves a pool with the given number of threads that is shared across the program. There is one pool
+             * per number of threads, which lives until the program terminates, so the returned reference stays valid
+             * even if pools of other sizes are requested later (possibly from within a task).
+             *
+             * @param numberOfThreads The number of threads of the pool.
+             * @return The shared pool.
+             */
+            static ThreadPool& getGlobalInstance(uint64_t numberOfThreads);
+
+        private:
+            // A range of tasks that is owned by one thread but may be stolen from by the others.
+            struct TaskRange {
+                std::mutex mutex;
+                uint64_t begin = 0;
+                uint64_t end = 0;
+            };
+
+            void workerLoop(uint64_t index);
+
+            /*!
+             * Processes tasks (first the own ones, then stolen ones) until no task is left.
+             */
+            void work(uint64_t index);
+
+            bool takeOwnTask(uint64_t index, uint64_t& task);
+            bool stealTask(uint64_t index, uint64_t& task);
+
+            // The worker threads. The thread calling execute uses the task range with index 0.
+            std::vector<std::thread> workers;
+            std::vector<std::unique_ptr<TaskRange>> taskRanges;
+
+            // The function to execute in the current round.
+            std::function<void(uint64_t)> const* currentTask;
+
+            // Synchronizes the rounds between the calling thread and the workers.
+            std::mutex mutex;
+            std::condition_variable roundStarted;
+            std::condition_variable roundFinished;
+            uint64_t round;
+            uint64_t busyWorkers;
+            bool stop;
+
+            // The first exception thrown by a task of the current round.
+            std::exception_ptr exception;
+
+            // Makes sure that concurrent calls to execute are processed one after another.
+            std::mutex executeMutex;
+        };
+
+        /*!
+         * Splits the items 0, ..., numberOfItems - 1 into at most the given number of contiguous blocks of roughly
+         * equal weight. The weight of an item is given by the difference of consecutive offsets plus one (to account
+         * for the fixed cost per item), e.g. the number of entries of a row if the offsets are the row indications of
+         * a matrix.
+         *
+         * @param numberOfItems The number of items.
+         * @param numberOfBlocks The maximal number of blocks.
+         * @param offset A function that maps i to the accumulated weight of the items 0, ..., i - 1. It must be
+         * defined for 0, ..., numberOfItems and be monotonically increasing.
+         * @return The boundaries of the blocks. The i-th block consists of the items result[i], ..., result[i + 1] - 1.
+         */
+        template<typename OffsetFunction>
+        std::vector<uint64_t> computeBalancedBlocks(uint64_t numberOfItems, uint64_t numberOfBlocks, OffsetFunction const& offset) {
+            std::vector<uint64_t> result = {0};
+            if (numberOfItems == 0) {
+                return result;
+            }
+            uint64_t firstOffset = offset(0);
+            uint64_t totalWeight = offset(numberOfItems) - firstOffset + numberOfItems;
+            for (uint64_t block = 1; block < numberOfBlocks; ++block) {
+                uint64_t targetWeight = totalWeight / numberOfBlocks * block + totalWeight % numberOfBlocks * block / numberOfBlocks;
+
+                // Find the first item whose accumulated weight reaches the target weight.
+                uint64_t low = result.back();
+                uint64_t high = numberOfItems;
+                while (low < high) {
+                    uint64_t middle = low + (high - low) / 2;
+                    if (offset(middle) - firstOffset + middle < targetWeight) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                if (low > result.back() && low < numberOfItems) {
+                    result.push_back(low);
+                }
+            }
+            result.push_back(numberOfItems);
+            return result;
+        }
+
+        /*!
+         * Splits the items 0, ..., numberOfItems - 1 into contiguous blocks (at most four per thread of the pool) and
+         * executes the given function for each of them on the pool.
+         *
+         * @param pool The pool to use.
+         * @param numberOfItems The number of items.
+         * @param function A function that is called with the first item of a block and the item after the last one.
+         * @param minimalBlockSize The minimal number of items per block (unless there are fewer items in total).
+         */
+        template<typename Function>
+        void executeInBlocks(ThreadPool& pool, uint64_t numberOfItems, Function const& function, uint64_t minimalBlockSize = 1024) {
+            uint64_t numberOfBlocks = std::max<uint64_t>(1, std::min(pool.getNumberOfThreads() * 4, numberOfItems / minimalBlockSize));
+            pool.execute(numberOfBlocks, [&] (uint64_t block) {
+                function(numberOfItems * block / numberOfBlocks, numberOfItems * (block + 1) / numberOfBlocks);
+            });
+        }
+
+        /*!
+         * Performs one step of a (level-synchronous) parallel search: The given function is called for all items of
+         * the frontier and the items it adds to the vector it is given form the new frontier.
+         *
+         * @param pool The pool to use.
+         * @param frontier The current frontier.
+         * @param expand A function that is called with an item of the frontier and the vector collecting the new frontier.
+         * @param minimalBlockSize The minimal number of frontier items that are processed by one task.
+         * @return The new frontier.
+         */
+        template<typename Function>
+        std::vector<uint64_t> expandFrontier(ThreadPool& pool, std::vector<uint64_t> const& frontier, Function const& expand, uint64_t minimalBlockSize = 1024) {
+            uint64_t numberOfBlocks = std::max<uint64_t>(1, std::min(pool.getNumberOfThreads() * 4, frontier.size() / minimalBlockSize));
+            if (numberOfBlocks == 1) {
+                std::vector<uint64_t> result;
+                for (auto const& item : frontier) {
+                    expand(item, result);
+                }
+                return result;
+            }
+            std::vector<std::vector<uint64_t>> newFrontiers(numberOfBlocks);
+            pool.execute(numberOfBlocks, [&] (uint64_t block) {
+                for (uint64_t index = frontier.size() * block / numberOfBlocks, end = frontier.size() * (block + 1) / numberOfBlocks; index < end; ++index) {
+                    expand(frontier[index], newFrontiers[block]);
+                }
+            });
+            std::vector<uint64_t> result;
+            for (auto const& newFrontier : newFrontiers) {
+                result.insert(result.end(), newFrontier.begin(), newFrontier.end());
+            }
+            return result;
+        }
+
+    }
+}
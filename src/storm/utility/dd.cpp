@@ -82,6 +82,43 @@ namespace storm {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
             }
             
+            /*!
+             * Combines the given (non-empty) operands pairwise until a single DD is left.
+             */
+            template <storm::dd::DdType Type, typename ValueType, typename Operation>
+            storm::dd::Add<Type, ValueType> reduce(storm::dd::DdManager<Type> const& ddManager, std::vector<storm::dd::Add<Type, ValueType>>&& operands, Operation const& operation) {
+                while (operands.size() > 1) {
+                    uint64_t numberOfPairs = operands.size() / 2;
+                    std::vector<storm::dd::Add<Type, ValueType>> combined(numberOfPairs + operands.size() % 2);
+                    ddManager.execute(numberOfPairs, [&] (uint64_t pair) {
+                        combined[pair] = operation(operands[2 * pair], operands[2 * pair + 1]);
+                    });
+                    
+                    // Keep the last operand if there is an odd number of them.
+                    if (operands.size() % 2 == 1) {
+                        combined.back() = std::move(operands.back());
+                    }
+                    operands = std::move(combined);
+                }
+                return std::move(operands.front());
+            }
+            
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> sum(storm::dd::DdManager<Type> const& ddManager, std::vector<storm::dd::Add<Type, ValueType>> summands) {
+                if (summands.empty()) {
+                    return ddManager.template getAddZero<ValueType>();
+                }
+                return reduce(ddManager, std::move(summands), [] (storm::dd::Add<Type, ValueType> const& first, storm::dd::Add<Type, ValueType> const& second) { return first + second; });
+            }
+            
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> multiply(storm::dd::DdManager<Type> const& ddManager, std::vector<storm::dd::Add<Type, ValueType>> factors) {
+                if (factors.empty()) {
+                    return ddManager.template getAddOne<ValueType>();
+                }
+                return reduce(ddManager, std::move(factors), [] (storm::dd::Add<Type, ValueType> const& first, storm::dd::Add<Type, ValueType> const& second) { return first * second; });
+            }
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
@@ -90,6 +127,16 @@ namespace storm {
             
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            
+            template storm::dd::Add<storm::dd::DdType::CUDD, double> sum(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::CUDD, double>> summands);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, double> sum(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, double>> summands);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> sum(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber>> summands);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction> sum(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction>> summands);
+            
+            template storm::dd::Add<storm::dd::DdType::CUDD, double> multiply(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::CUDD, double>> factors);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, double> multiply(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, double>> factors);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> multiply(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber>> factors);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction> multiply(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction>> factors);
 
         }
     }
@@ -34,6 +34,28 @@ namespace storm {
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            
+            /*!
+             * Computes the sum of the given ADDs as a balanced tree. The additions of one level of the tree are executed
+             * in parallel if the library supports it (see DdManager::execute).
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param summands The ADDs to add.
+             * @return The sum of the ADDs (zero if there are none).
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> sum(storm::dd::DdManager<Type> const& ddManager, std::vector<storm::dd::Add<Type, ValueType>> summands);
+            
+            /*!
+             * Computes the product of the given ADDs as a balanced tree. The multiplications of one level of the tree
+             * are executed in parallel if the library supports it (see DdManager::execute).
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param factors The ADDs to multiply.
+             * @return The product of the ADDs (one if there are none).
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> multiply(storm::dd::DdManager<Type> const& ddManager, std::vector<storm::dd::Add<Type, ValueType>> factors);
                         
         }
     }
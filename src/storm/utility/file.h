@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 
 #include "storm/utility/macros.h"
@@ -9,7 +11,8 @@ namespace storm {
     namespace utility {
 
         /*!
-         * Open the given file for writing.
+         * Open the given file for writing. The file is opened in binary mode, so that line endings are not translated
+         * and compressed data can be written to it.
          *
          * @param filepath Path and name of the file to be written to.
          * @param filestream Contains the file handler afterwards.
@@ -17,9 +20,9 @@ namespace storm {
          */
         inline void openFile(std::string const& filepath, std::ofstream& filestream, bool append = false, bool silent = false) {
             if (append) {
-                filestream.open(filepath, std::ios::app);
+                filestream.open(filepath, std::ios::out | std::ios::app | std::ios::binary);
             } else {
-                filestream.open(filepath);
+                filestream.open(filepath, std::ios::out | std::ios::binary);
             }
             STORM_LOG_THROW(filestream, storm::exceptions::FileIoException , "Could not open file " << filepath << ".");
             filestream.precision(std::cout.precision());
@@ -29,16 +32,27 @@ namespace storm {
         }
 
         /*!
-         * Open the given file for reading.
+         * Open the given file for reading. The file is opened in binary mode, so that compressed data can be read from
+         * it. Use getline to read lines regardless of their line endings.
          *
          * @param filepath Path and name of the file to be tested.
          * @param filestream Contains the file handler afterwards.
          */
         inline void openFile(std::string const& filepath, std::ifstream& filestream) {
-            filestream.open(filepath);
+            filestream.open(filepath, std::ios::in | std::ios::binary);
             STORM_LOG_THROW(filestream, storm::exceptions::FileIoException , "Could not open file " << filepath << ".");
         }
 
+        /*!
+         * Checks whether the given file is to be gzip compressed, i.e., whether its name ends with '.gz'.
+         *
+         * @param filepath Path and name of the file.
+         */
+        inline bool isGzipFile(std::string const& filepath) {
+            std::string gzipFileExtension = ".gz";
+            return filepath.size() > gzipFileExtension.size() && std::equal(gzipFileExtension.rbegin(), gzipFileExtension.rend(), filepath.rbegin());
+        }
+
         /*!
          * Close the given file after writing.
          *
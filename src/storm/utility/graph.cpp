@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/sparse/StateType.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
@@ -20,10 +21,16 @@
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <atomic>
+#include <limits>
 #include <queue>
 
 namespace storm {
@@ -293,8 +300,66 @@ namespace storm {
                 return distances;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+            namespace {
+                // The number of threads for the parallel backward searches (zero means that the core settings are used)
+                // and the minimal number of states for which they are used.
+                std::atomic<uint64_t> parallelSearchThreads(0);
+                std::atomic<uint64_t> parallelSearchThreshold(100000);
+            }
+            
+            void setParallelSearchParameters(uint64_t numberOfThreads, uint64_t minimalNumberOfStates) {
+                parallelSearchThreads = numberOfThreads;
+                parallelSearchThreshold = minimalNumberOfStates;
+            }
+            
+            /*!
+             * Retrieves the number of threads to use for a backward search in a system with the given number of states.
+             */
+            uint64_t getNumberOfParallelSearchThreads(uint64_t numberOfStates) {
+                if (numberOfStates < parallelSearchThreshold) {
+                    return 1;
+                }
+                uint64_t numberOfThreads = parallelSearchThreads;
+                if (numberOfThreads == 0) {
+                    numberOfThreads = storm::settings::hasModule<storm::settings::modules::CoreSettings>() ? storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads() : 1;
+                }
+                return numberOfThreads;
+            }
+            
+            /*!
+             * Performs a backward search level by level, where the predecessors of each level are processed in parallel.
+             * A predecessor is added if it is a phi state and satisfies the given condition. The condition may only
+             * depend on the states that were reached in previous levels, so the result does not depend on the number
+             * of threads.
+             *
+             * @param backwardTransitions The reversed transition relation.
+             * @param phiStates The states that may be added.
+             * @param reachedStates The states to start the search from. As a side effect, all reached states are added.
+             * @param useStepBound If set, the search stops after the given number of levels.
+             * @param maximalSteps The maximal number of levels (if the step bound is used).
+             * @param numberOfThreads The number of threads to use.
+             * @param canBeAdded The condition that a predecessor has to satisfy.
+             */
+            template <typename MatrixType, typename Condition>
+            void performParallelBackwardSearch(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector& reachedStates, bool useStepBound, uint_fast64_t maximalSteps, uint64_t numberOfThreads, Condition const& canBeAdded) {
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalInstance(numberOfThreads);
+                storm::storage::BitVector newStates(reachedStates.size());
+                std::vector<uint64_t> frontier(reachedStates.begin(), reachedStates.end());
+                for (uint_fast64_t step = 0; !frontier.empty() && (!useStepBound || step < maximalSteps); ++step) {
+                    frontier = storm::utility::expandFrontier(pool, frontier, [&] (uint64_t state, std::vector<uint64_t>& newFrontier) {
+                        for (auto entryIt = backwardTransitions.begin(state), entryIte = backwardTransitions.end(state); entryIt != entryIte; ++entryIt) {
+                            uint64_t predecessor = entryIt->getColumn();
+                            if (phiStates.get(predecessor) && !reachedStates.get(predecessor) && canBeAdded(predecessor) && newStates.setAtomically(predecessor)) {
+                                newFrontier.push_back(predecessor);
+                            }
+                        }
+                    });
+                    reachedStates.set(frontier.begin(), frontier.end());
+                }
+            }
+            
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProbGreater0(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
                 // Prepare the resulting bit vector.
                 uint_fast64_t numberOfStates = phiStates.size();
                 storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -302,6 +367,13 @@ namespace storm {
                 // Add all psi states as they already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                // Large systems are searched in parallel.
+                uint64_t numberOfThreads = getNumberOfParallelSearchThreads(numberOfStates);
+                if (numberOfThreads > 1) {
+                    performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, useStepBound, maximalSteps, numberOfThreads, [] (uint64_t) { return true; });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states.
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -332,7 +404,7 @@ namespace storm {
                         
                     }
                     
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
+                    for (auto entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
                         if (phiStates[entryIt->getColumn()] && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
                             statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
 
@@ -351,15 +423,15 @@ namespace storm {
                 return statesWithProbabilityGreater0;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const&, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb1(MatrixType const& backwardTransitions, storm::storage::BitVector const&, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
                 storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
                 statesWithProbability1.complement();
                 return statesWithProbability1;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb1(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 storm::storage::BitVector statesWithProbabilityGreater0 = performProbGreater0(backwardTransitions, phiStates, psiStates);
                 storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~(statesWithProbabilityGreater0));
                 statesWithProbability1.complement();
@@ -376,8 +448,8 @@ namespace storm {
                 return result;
             }
             
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
                 result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -603,8 +675,8 @@ namespace storm {
                 }
             }
             
-            template <typename T>
-            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProbGreater0E(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -613,6 +685,13 @@ namespace storm {
                 // Add all psi states as the already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                // Large systems are searched in parallel.
+                uint64_t numberOfThreads = getNumberOfParallelSearchThreads(numberOfStates);
+                if (numberOfThreads > 1) {
+                    performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, useStepBound, maximalSteps, numberOfThreads, [] (uint64_t) { return true; });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -642,7 +721,7 @@ namespace storm {
                         }
                     }
                     
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
+                    for (auto entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
                         if (phiStates.get(entryIt->getColumn()) && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
                             // If we don't have a bound on the number of steps to take, just add the state to the stack.
                             if (useStepBound) {
@@ -659,15 +738,15 @@ namespace storm {
                 return statesWithProbabilityGreater0;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb0A(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 storm::storage::BitVector statesWithProbability0 = performProbGreater0E(backwardTransitions, phiStates, psiStates);
                 statesWithProbability0.complement();
                 return statesWithProbability0;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb1E(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
                 size_t numberOfStates = phiStates.size();
                 
                 // Initialize the environment for the iterative algorithm.
@@ -678,16 +757,42 @@ namespace storm {
                 // Perform the loop as long as the set of states gets larger.
                 bool done = false;
                 uint_fast64_t currentState;
+                uint64_t numberOfThreads = getNumberOfParallelSearchThreads(numberOfStates);
                 while (!done) {
                     stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    if (numberOfThreads > 1) {
+                        // Search in parallel for states that have a choice that stays within the current states and
+                        // has a successor reached in a previous level.
+                        performParallelBackwardSearch(backwardTransitions, phiStates, nextStates, false, 0, numberOfThreads, [&] (uint64_t state) {
+                            for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                                if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                                    bool allSuccessorsInCurrentStates = true;
+                                    bool hasNextStateSuccessor = false;
+                                    for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                        if (!currentStates.get(successorEntryIt->getColumn())) {
+                                            allSuccessorsInCurrentStates = false;
+                                            break;
+                                        } else if (nextStates.get(successorEntryIt->getColumn())) {
+                                            hasNextStateSuccessor = true;
+                                        }
+                                    }
+                                    if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                                        return true;
+                                    }
+                                }
+                            }
+                            return false;
+                        });
+                    } else {
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    }
                     
                     while (!stack.empty()) {
                         currentState = stack.back();
                         stack.pop_back();
                         
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
+                        for (auto predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                             if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
                                 // Check whether the predecessor has only successors in the current state set for one of the
                                 // nondeterminstic choices.
@@ -695,7 +800,7 @@ namespace storm {
                                     if (!choiceConstraint || choiceConstraint.get().get(row)) {
                                         bool allSuccessorsInCurrentStates = true;
                                         bool hasNextStateSuccessor = false;
-                                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                        for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
                                             if (!currentStates.get(successorEntryIt->getColumn())) {
                                                 allSuccessorsInCurrentStates = false;
                                                 break;
@@ -734,8 +839,8 @@ namespace storm {
                 return performProb1E(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
             }
             
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 
                 result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -749,8 +854,8 @@ namespace storm {
                 return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates);
             }
             
-            template <typename T>
-            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProbGreater0A(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -759,6 +864,35 @@ namespace storm {
                 // Add all psi states as the already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                // Large systems are searched in parallel. A state is added once every enabled choice has a successor
+                // that was reached in a previous level.
+                uint64_t numberOfThreads = getNumberOfParallelSearchThreads(numberOfStates);
+                if (numberOfThreads > 1) {
+                    performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, useStepBound, maximalSteps, numberOfThreads, [&] (uint64_t state) {
+                        uint_fast64_t row = nondeterministicChoiceIndices[state];
+                        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[state + 1];
+                        if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+                            return false;
+                        }
+                        for (; row < endOfGroup; ++row) {
+                            if (!choiceConstraint || choiceConstraint->get(row)) {
+                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                                for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                    if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
+                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                                        break;
+                                    }
+                                }
+                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                                    return false;
+                                }
+                            }
+                        }
+                        return true;
+                    });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -788,7 +922,7 @@ namespace storm {
                         }
                     }
                     
-                    for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
+                    for(auto predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                         if (phiStates.get(predecessorEntryIt->getColumn())) {
                             if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
                                 
@@ -804,7 +938,7 @@ namespace storm {
                                     for (; row < endOfGroup; ++row) {
                                         if (!choiceConstraint || choiceConstraint->get(row)) {
                                             bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                            for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
                                                 if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
                                                     hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
                                                     break;
@@ -868,8 +1002,8 @@ namespace storm {
                 return statesWithProbability0;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb0E(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 storm::storage::BitVector statesWithProbability0 = performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
                 statesWithProbability0.complement();
                 return statesWithProbability0;
@@ -880,8 +1014,8 @@ namespace storm {
                 return performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb1A( storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            storm::storage::BitVector performProb1A(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 size_t numberOfStates = phiStates.size();
                 
                 // Initialize the environment for the iterative algorithm.
@@ -892,16 +1026,39 @@ namespace storm {
                 // Perform the loop as long as the set of states gets smaller.
                 bool done = false;
                 uint_fast64_t currentState;
+                uint64_t numberOfThreads = getNumberOfParallelSearchThreads(numberOfStates);
                 while (!done) {
                     stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    if (numberOfThreads > 1) {
+                        // Search in parallel for states whose choices all stay within the current states and have a
+                        // successor reached in a previous level.
+                        performParallelBackwardSearch(backwardTransitions, phiStates, nextStates, false, 0, numberOfThreads, [&] (uint64_t state) {
+                            for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                                bool hasAtLeastOneSuccessorWithProbability1 = false;
+                                for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                    if (!currentStates.get(successorEntryIt->getColumn())) {
+                                        return false;
+                                    }
+                                    if (nextStates.get(successorEntryIt->getColumn())) {
+                                        hasAtLeastOneSuccessorWithProbability1 = true;
+                                    }
+                                }
+                                if (!hasAtLeastOneSuccessorWithProbability1) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+                    } else {
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    }
                     
                     while (!stack.empty()) {
                         currentState = stack.back();
                         stack.pop_back();
                         
-                        for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
+                        for(auto predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                             if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
                                 // Check whether the predecessor has only successors in the current state set for all of the
                                 // nondeterminstic choices and that for each choice there exists a successor that is already
@@ -909,7 +1066,7 @@ namespace storm {
                                 bool addToStatesWithProbability1 = true;
                                 for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
                                     bool hasAtLeastOneSuccessorWithProbability1 = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                    for (auto successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
                                         if (!currentStates.get(successorEntryIt->getColumn())) {
                                             addToStatesWithProbability1 = false;
                                             goto afterCheckLoop;
@@ -947,8 +1104,8 @@ namespace storm {
                 return currentStates;
             }
             
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            template <typename MatrixType, typename>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
                 // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
@@ -1694,6 +1851,63 @@ namespace storm {
                 return topologicalSort;
             }
 
+            template <typename T>
+            std::vector<uint64_t> getGreedyColoring(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint64_t> const& rowGroupIndices) {
+                uint64_t numberOfStates = rowGroupIndices.size() - 1;
+                STORM_LOG_THROW(transitionMatrix.getColumnCount() == numberOfStates, storm::exceptions::InvalidArgumentException, "The number of columns of the matrix does not match the number of row groups.");
+                
+                // Gather the predecessors of each state (without self-loops).
+                std::vector<uint64_t> predecessorIndications(numberOfStates + 1, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    for (auto const& entry : transitionMatrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                        if (entry.getColumn() != state) {
+                            ++predecessorIndications[entry.getColumn() + 1];
+                        }
+                    }
+                }
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    predecessorIndications[state + 1] += predecessorIndications[state];
+                }
+                std::vector<uint64_t> predecessors(predecessorIndications.back());
+                std::vector<uint64_t> insertPositions(predecessorIndications.begin(), predecessorIndications.end() - 1);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    for (auto const& entry : transitionMatrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                        if (entry.getColumn() != state) {
+                            predecessors[insertPositions[entry.getColumn()]++] = state;
+                        }
+                    }
+                }
+                
+                // For each color, we store the last state for which the color was found to be used by a neighbor.
+                uint64_t const noState = std::numeric_limits<uint64_t>::max();
+                std::vector<uint64_t> colors(numberOfStates, noState);
+                std::vector<uint64_t> colorUsedByNeighborOf;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    for (auto const& entry : transitionMatrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                        uint64_t neighborColor = colors[entry.getColumn()];
+                        if (neighborColor != noState) {
+                            colorUsedByNeighborOf[neighborColor] = state;
+                        }
+                    }
+                    for (uint64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                        uint64_t neighborColor = colors[predecessors[index]];
+                        if (neighborColor != noState) {
+                            colorUsedByNeighborOf[neighborColor] = state;
+                        }
+                    }
+                    
+                    uint64_t color = 0;
+                    while (color < colorUsedByNeighborOf.size() && colorUsedByNeighborOf[color] == state) {
+                        ++color;
+                    }
+                    if (color == colorUsedByNeighborOf.size()) {
+                        colorUsedByNeighborOf.push_back(noState);
+                    }
+                    colors[state] = color;
+                }
+                return colors;
+            }
+
 
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
             
@@ -1773,6 +1987,32 @@ namespace storm {
             
             template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<double> const& matrix,  std::vector<uint64_t> const& firstStates) ;
             
+            template std::vector<uint64_t> getGreedyColoring(storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<uint64_t> const& rowGroupIndices);
+            
+            template storm::storage::BitVector performProbGreater0(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+            
+            template storm::storage::BitVector performProb1(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+            
+            template storm::storage::BitVector performProb1(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProbGreater0E(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+            
+            template storm::storage::BitVector performProb0A(storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProb1E(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProbGreater0A(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint);
+            
+            template storm::storage::BitVector performProb0E(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProb1A(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::CompactSparseMatrix<double> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
             // Instantiations for storm::RationalNumber.
 #ifdef STORM_HAVE_CARL
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
@@ -1832,6 +2072,32 @@ namespace storm {
             template ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint64_t> const& player1RowGrouping, storm::storage::SparseMatrix<storm::RationalNumber> const& player1BackwardTransitions, std::vector<uint64_t> const& player2BackwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::ExplicitGameStrategyPair* strategyPair, boost::optional<storm::storage::BitVector> const& player1Candidates);
             
             template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,  std::vector<uint64_t> const& firstStates);
+            
+            template std::vector<uint64_t> getGreedyColoring(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint64_t> const& rowGroupIndices);
+            
+            template storm::storage::BitVector performProbGreater0(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+            
+            template storm::storage::BitVector performProb1(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+            
+            template storm::storage::BitVector performProb1(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProbGreater0E(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+            
+            template storm::storage::BitVector performProb0A(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProb1E(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProbGreater0A(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint);
+            
+            template storm::storage::BitVector performProb0E(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template storm::storage::BitVector performProb1A(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::CompactSparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::CompactSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             // End of instantiations for storm::RationalNumber.
             
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
@@ -1887,6 +2153,8 @@ namespace storm {
             
             template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix,  std::vector<uint64_t> const& firstStates);
             
+            template std::vector<uint64_t> getGreedyColoring(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint64_t> const& rowGroupIndices);
+            
 #endif
             
             // Instantiations for CUDD.
@@ -3,6 +3,7 @@
 
 #include <set>
 #include <limits>
+#include <type_traits>
 
 #include "storm/utility/OsDetection.h"
 
@@ -20,6 +21,7 @@ namespace storm {
     namespace storage {
         class BitVector;
         template<typename VT> class SparseMatrix;
+        template<typename VT> class CompactSparseMatrix;
     }
     
     namespace models {
@@ -56,6 +58,23 @@ namespace storm {
     namespace utility {
         namespace graph {
             
+            /*
+             * The qualitative analyses (performProb0/1 and friends) that only need to iterate over the rows of a matrix
+             * work on both the SparseMatrix and the CompactSparseMatrix. This trait restricts their matrix type to
+             * these classes, so they do not compete with the overloads taking models.
+             */
+            template<typename MatrixType>
+            struct IsExplicitMatrix : std::false_type {};
+            
+            template<typename ValueType>
+            struct IsExplicitMatrix<storm::storage::SparseMatrix<ValueType>> : std::true_type {};
+            
+            template<typename ValueType>
+            struct IsExplicitMatrix<storm::storage::CompactSparseMatrix<ValueType>> : std::true_type {};
+            
+            template<typename MatrixType>
+            using EnableIfExplicitMatrix = typename std::enable_if<IsExplicitMatrix<MatrixType>::value>::type;
+            
             /*!
              * Performs a forward depth-first search through the underlying graph structure to identify the states that
              * are reachable from the given set only passing through a constrained set of states until some target
@@ -116,6 +135,17 @@ namespace storm {
             template<typename T>
             std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, boost::optional<storm::storage::BitVector> const& subsystem = boost::none);
             
+            /*!
+             * Sets the number of threads used by the backward searches of the qualitative analyses on sparse matrices
+             * (performProbGreater0, performProb1, performProb0A, performProb1E, ...) and the minimal number of states
+             * for which they are parallelized. By default, the number of threads of the core settings and a threshold
+             * of 100000 states are used.
+             *
+             * @param numberOfThreads The number of threads. Zero means that the number of threads of the core settings is used.
+             * @param minimalNumberOfStates Smaller systems are always searched sequentially.
+             */
+            void setParallelSearchParameters(uint64_t numberOfThreads, uint64_t minimalNumberOfStates);
+            
             /*!
              * Performs a backward depth-first search trough the underlying graph structure
              * of the given model to determine which states of the model have a positive probability
@@ -128,8 +158,8 @@ namespace storm {
              * @param maximalSteps The maximal number of steps to reach the psi states.
              * @return A bit vector with all indices of states that have a probability greater than 0.
              */
-            template <typename T>
-            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProbGreater0(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             /*!
              * Computes the set of states of the given model for which all paths lead to
@@ -145,8 +175,8 @@ namespace storm {
              * probability mass of satisfying phi until psi.
              * @return A bit vector with all indices of states that have a probability greater than 1.
              */
-            template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb1(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
             
             /*!
              * Computes the set of states of the given model for which all paths lead to
@@ -160,8 +190,8 @@ namespace storm {
              * @param psiStates A bit vector of all states satisfying psi.
              * @return A bit vector with all indices of states that have a probability greater than 1.
              */
-            template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb1(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
@@ -186,8 +216,8 @@ namespace storm {
              * @return A pair of bit vectors such that the first bit vector stores the indices of all states
              * with probability 0 and the second stores all indices of states with probability 1.
              */
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             /*!
              * Computes the set of states that has a positive probability of reaching psi states after only passing
@@ -341,11 +371,11 @@ namespace storm {
              * @param maximalSteps The maximal number of steps to reach the psi states.
              * @return A bit vector that represents all states with probability 0.
              */
-            template <typename T>
-            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProbGreater0E(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
             
-            template <typename T>
-            storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb0A(MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -360,8 +390,8 @@ namespace storm {
              * @param choiceConstraint If given, only the selected choices are considered.
              * @return A bit vector that represents all states with probability 1.
              */
-            template <typename T>
-            storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb1E(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -378,8 +408,8 @@ namespace storm {
             template <typename T, typename RM>
             storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
 
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -408,8 +438,8 @@ namespace storm {
              * @param maximalSteps The maximal number of steps to reach the psi states.
              * @return A bit vector that represents all states with probability 0.
              */
-            template <typename T>
-            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProbGreater0A(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
             
             /*!
              * Computes the sets of states that have probability 0 of satisfying phi until psi under at least
@@ -425,8 +455,8 @@ namespace storm {
              */
             template <typename T, typename RM>
             storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
-            template <typename T>
-            storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb0E(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under all
@@ -443,11 +473,11 @@ namespace storm {
             template <typename T, typename RM>
             storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
-            template <typename T>
-            storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            storm::storage::BitVector performProb1A(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
-            template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            template <typename MatrixType, typename = EnableIfExplicitMatrix<MatrixType>>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(MatrixType const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, MatrixType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
 
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -704,6 +734,18 @@ namespace storm {
              */
             template <typename T>
             std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<T> const& matrix, std::vector<uint64_t> const& firstStates = {}) ;
+            
+            /*!
+             * Computes a coloring of the states such that no two distinct states of the same color are connected by a
+             * transition (in either direction). The states are colored greedily in the order of their indices, i.e.,
+             * each state gets the smallest color that is not used by one of its already colored neighbors.
+             *
+             * @param transitionMatrix The transition relation of the system.
+             * @param rowGroupIndices The row groups of the transition matrix. Row group i contains the choices of state i.
+             * @return The color of each state. The colors are 0, ..., k - 1 for some k.
+             */
+            template <typename T>
+            std::vector<uint64_t> getGreedyColoring(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint64_t> const& rowGroupIndices);
 
         } // namespace graph
     } // namespace utility
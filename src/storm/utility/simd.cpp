@@ -0,0 +1,167 @@
+#include "storm/utility/simd.h"
+
+#include <cstring>
+#include <limits>
+
+#include "storm/utility/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            namespace {
+                inline double dotScalar(uint64_t entry, uint64_t const end, uint32_t const* columns, double const* values, double const* x) {
+                    double result = 0.0;
+                    for (; entry < end; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                void multiplyRowsScalar(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards) {
+                    if (backwards) {
+                        for (uint64_t row = endRow; row > firstRow;) {
+                            --row;
+                            double value = dotScalar(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    } else {
+                        for (uint64_t row = firstRow; row < endRow; ++row) {
+                            double value = dotScalar(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    }
+                }
+
+#ifdef STORM_SIMD_X86
+                __attribute__((target("avx2,fma")))
+                inline double dotAvx2(uint64_t entry, uint64_t const end, uint32_t const* columns, double const* values, double const* x) {
+                    __m256d accumulator = _mm256_setzero_pd();
+                    for (; entry + 4 <= end; entry += 4) {
+                        __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                        __m256d gathered = _mm256_i32gather_pd(x, indices, 8);
+                        accumulator = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), gathered, accumulator);
+                    }
+                    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(accumulator), _mm256_extractf128_pd(accumulator, 1));
+                    double result = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+                    for (; entry < end; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                __attribute__((target("avx2,fma")))
+                void multiplyRowsAvx2(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards) {
+                    if (backwards) {
+                        for (uint64_t row = endRow; row > firstRow;) {
+                            --row;
+                            double value = dotAvx2(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    } else {
+                        for (uint64_t row = firstRow; row < endRow; ++row) {
+                            double value = dotAvx2(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    }
+                }
+
+                __attribute__((target("avx512f")))
+                inline double dotAvx512(uint64_t entry, uint64_t const end, uint32_t const* columns, double const* values, double const* x) {
+                    __m512d accumulator = _mm512_setzero_pd();
+                    for (; entry + 8 <= end; entry += 8) {
+                        __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                        __m512d gathered = _mm512_i32gather_pd(indices, x, 8);
+                        accumulator = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), gathered, accumulator);
+                    }
+                    if (entry < end) {
+                        // Handle the remaining (less than eight) entries with masked operations.
+                        __mmask8 mask = static_cast<__mmask8>((1u << (end - entry)) - 1);
+                        __m256i indices = _mm256_setzero_si256();
+                        std::memcpy(&indices, columns + entry, (end - entry) * sizeof(uint32_t));
+                        __m512d gathered = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, x, 8);
+                        accumulator = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + entry), gathered, accumulator);
+                    }
+                    return _mm512_reduce_add_pd(accumulator);
+                }
+
+                __attribute__((target("avx512f")))
+                void multiplyRowsAvx512(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards) {
+                    if (backwards) {
+                        for (uint64_t row = endRow; row > firstRow;) {
+                            --row;
+                            double value = dotAvx512(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    } else {
+                        for (uint64_t row = firstRow; row < endRow; ++row) {
+                            double value = dotAvx512(rowIndications[row], rowIndications[row + 1], columns, values, x);
+                            result[row - firstRow] = b ? b[row] + value : value;
+                        }
+                    }
+                }
+#endif
+
+                InstructionSet detectInstructionSet() {
+#ifdef STORM_SIMD_X86
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512f")) {
+                        return InstructionSet::Avx512;
+                    }
+                    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                        return InstructionSet::Avx2;
+                    }
+#endif
+                    return InstructionSet::Scalar;
+                }
+            }
+
+            InstructionSet getSupportedInstructionSet() {
+                static const InstructionSet instructionSet = detectInstructionSet();
+                return instructionSet;
+            }
+
+            bool isSupported(InstructionSet const& instructionSet) {
+                return static_cast<int>(instructionSet) <= static_cast<int>(getSupportedInstructionSet());
+            }
+
+            std::string toString(InstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::Scalar:
+                        return "scalar";
+                    case InstructionSet::Avx2:
+                        return "AVX2";
+                    case InstructionSet::Avx512:
+                        return "AVX-512";
+                }
+                return "invalid";
+            }
+
+            bool isColumnCountSupported(uint64_t columnCount) {
+                return columnCount <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 1;
+            }
+
+            void multiplyRows(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards) {
+                STORM_LOG_ASSERT(isSupported(instructionSet), "The instruction set " << toString(instructionSet) << " is not supported by the processor.");
+                switch (instructionSet) {
+#ifdef STORM_SIMD_X86
+                    case InstructionSet::Avx512:
+                        multiplyRowsAvx512(rowIndications, columns, values, x, b, result, firstRow, endRow, backwards);
+                        return;
+                    case InstructionSet::Avx2:
+                        multiplyRowsAvx2(rowIndications, columns, values, x, b, result, firstRow, endRow, backwards);
+                        return;
+#endif
+                    default:
+                        multiplyRowsScalar(rowIndications, columns, values, x, b, result, firstRow, endRow, backwards);
+                }
+            }
+
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            /*!
+             * The instruction sets for which vectorized kernels are available.
+             */
+            enum class InstructionSet { Scalar, Avx2, Avx512 };
+
+            /*!
+             * Retrieves the most capable instruction set that is supported by both the current processor and the
+             * compiler that was used to build storm. The result is determined once and cached afterwards.
+             *
+             * @return The best supported instruction set.
+             */
+            InstructionSet getSupportedInstructionSet();
+
+            /*!
+             * Retrieves whether the given instruction set can be used on the current processor.
+             */
+            bool isSupported(InstructionSet const& instructionSet);
+
+            std::string toString(InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves whether the gather-based kernels can be used for a matrix with the given number of columns.
+             * The gather instructions interpret the column indices as signed 32-bit integers.
+             */
+            bool isColumnCountSupported(uint64_t columnCount);
+
+            /*!
+             * Multiplies the rows firstRow, ..., endRow - 1 of a matrix in compressed row storage (with 32-bit column
+             * indices kept apart from the values) with the vector x and adds the summand b (if given).
+             *
+             * Each row is processed completely before its result is written. Hence, if firstRow is zero, x and result
+             * may point to the same vector, which yields a Gauss-Seidel style update.
+             *
+             * @param instructionSet The instruction set to use. Must be supported by the processor.
+             * @param rowIndications The indices at which the rows start in the column and value arrays.
+             * @param columns The column indices of the entries.
+             * @param values The values of the entries.
+             * @param x The vector to multiply with.
+             * @param b If not null, the summand (indexed by rows).
+             * @param result The vector to which the results are written. The result for row i is written to
+             * position i - firstRow.
+             * @param firstRow The first row to multiply.
+             * @param endRow The row after the last row to multiply.
+             * @param backwards If set, the rows are processed from last to first.
+             */
+            void multiplyRows(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result, uint64_t firstRow, uint64_t endRow, bool backwards = false);
+
+        }
+    }
+}
@@ -231,6 +231,53 @@ namespace storm {
                 }
             }
             
+            /*!
+             * Stores the given vectors (which must have the same length) interleaved in a single vector, i.e., the
+             * j-th entry of the i-th vector is written to position j * vectors.size() + i.
+             *
+             * @param vectors The vectors to interleave.
+             * @return The interleaved vector.
+             */
+            template<class T>
+            std::vector<T> interleave(std::vector<std::vector<T>> const& vectors) {
+                std::vector<T> result;
+                if (vectors.empty()) {
+                    return result;
+                }
+                uint_fast64_t numberOfVectors = vectors.size();
+                uint_fast64_t length = vectors.front().size();
+                result.reserve(numberOfVectors * length);
+                for (uint_fast64_t index = 0; index < length; ++index) {
+                    for (auto const& vector : vectors) {
+                        result.push_back(vector[index]);
+                    }
+                }
+                return result;
+            }
+
+            /*!
+             * Reverts the interleaving of vectors (see interleave).
+             *
+             * @param interleaved The interleaved vector.
+             * @param vectors The vectors into which the entries are written. The number of vectors determines how the
+             * entries are distributed. The vectors are resized appropriately.
+             */
+            template<class T>
+            void deinterleave(std::vector<T> const& interleaved, std::vector<std::vector<T>>& vectors) {
+                uint_fast64_t numberOfVectors = vectors.size();
+                if (numberOfVectors == 0) {
+                    return;
+                }
+                uint_fast64_t length = interleaved.size() / numberOfVectors;
+                for (uint_fast64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                    std::vector<T>& vector = vectors[vectorIndex];
+                    vector.resize(length);
+                    for (uint_fast64_t index = 0; index < length; ++index) {
+                        vector[index] = interleaved[index * numberOfVectors + vectorIndex];
+                    }
+                }
+            }
+
             /*!
              * Subtracts the given vector from the constant one-vector and writes the result to the input vector.
              *
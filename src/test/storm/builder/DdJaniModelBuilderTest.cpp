@@ -1,5 +1,8 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+
+#include <cstdio>
+
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -12,9 +15,18 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SylvanSettings.h"
+
+#include "storm/api/verification.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-conv/api/storm-conv.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -663,3 +675,85 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+TEST(DdJaniModelBuilderTest_Sylvan, VariableOrder) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(mdp
+module m
+    a : [0..1] init 0;
+    b : [0..1] init 0;
+    c : [0..1] init 0;
+    d : [0..1] init 0;
+    [] a=0 -> 0.5 : (a'=1) & (c'=1) + 0.5 : (c'=0);
+    [] b=0 -> 1 : (b'=1) & (d'=1);
+endmodule
+)", "variable_order.nm");
+    storm::jani::Model janiModel = program.toJani(false);
+    ASSERT_EQ(1ul, janiModel.getNumberOfAutomata());
+    std::string locationVariableName = janiModel.getAutomaton(0).getLocationExpressionVariable().getName();
+    
+    // The location variable comes first, followed by the other variables in the order of their declaration.
+    std::string orderFilename = testing::TempDir() + "storm-dd-variable-order-test.txt";
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options declarationOptions;
+    declarationOptions.variableOrder.heuristic = storm::builder::DdVariableOrderHeuristic::Declaration;
+    declarationOptions.variableOrder.outputFilename = orderFilename;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>().build(janiModel, declarationOptions);
+    EXPECT_EQ(std::vector<std::string>({locationVariableName, "a", "b", "c", "d"}), storm::builder::parseDdVariableOrder(orderFilename));
+    
+    // Every edge refers to the location variable, while a is related to c and b to d. Hence, FORCE places the location
+    // variable between the two pairs.
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options forceOptions;
+    forceOptions.variableOrder.heuristic = storm::builder::DdVariableOrderHeuristic::Force;
+    forceOptions.variableOrder.outputFilename = orderFilename;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>().build(janiModel, forceOptions);
+    std::vector<std::string> expectedOrder = {"a", "c", locationVariableName, "b", "d"};
+    EXPECT_EQ(expectedOrder, storm::builder::parseDdVariableOrder(orderFilename));
+    std::vector<std::string> order;
+    for (auto const& variable : storm::builder::computeDdVariableOrder(janiModel, forceOptions.variableOrder)) {
+        order.push_back(variable.getName());
+    }
+    std::remove(orderFilename.c_str());
+    EXPECT_EQ(expectedOrder, order);
+    
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->getNumberOfChoices(), model->getNumberOfChoices());
+}
+
+namespace {
+    template<storm::dd::DdType Type>
+    std::shared_ptr<storm::models::symbolic::Model<Type>> buildAndCheck(storm::jani::Model const& janiModel, std::shared_ptr<storm::logic::Formula const> const& formula, double& result) {
+        std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdJaniModelBuilder<Type, double>().build(janiModel, typename storm::builder::DdJaniModelBuilder<Type, double>::Options(*formula));
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = storm::api::verifyWithDdEngine<Type, double>(model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+        checkResult->filter(storm::modelchecker::SymbolicQualitativeCheckResult<Type>(model->getReachableStates(), model->getInitialStates()));
+        result = checkResult->template asQuantitativeCheckResult<double>().getMin();
+        return model;
+    }
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ParallelBuildMatchesCudd) {
+    // A DTMC whose automata synchronize on most actions.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    auto janiData = storm::api::convertPrismToJani(program, storm::api::parsePropertiesForPrismProgram("P=? [F<=20 \"elected\"]", program));
+    janiData.first.substituteFunctions();
+    storm::jani::Model const& janiModel = janiData.first;
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::extractFormulasFromProperties(janiData.second).front();
+    
+    // The number of workers is fixed when Sylvan is initialized, i.e., when the first manager is created.
+    storm::settings::mutableSylvanSettings().setNumberOfThreads(2);
+    double sylvanResult;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> sylvanModel = buildAndCheck<storm::dd::DdType::Sylvan>(janiModel, formula, sylvanResult);
+    EXPECT_GE(sylvanModel->getManager().getNumberOfThreads(), 2ul);
+    
+    double cuddResult;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> cuddModel = buildAndCheck<storm::dd::DdType::CUDD>(janiModel, formula, cuddResult);
+    
+    EXPECT_TRUE(sylvanModel->isOfType(storm::models::ModelType::Dtmc));
+    EXPECT_EQ(cuddModel->getNumberOfStates(), sylvanModel->getNumberOfStates());
+    EXPECT_EQ(cuddModel->getNumberOfTransitions(), sylvanModel->getNumberOfTransitions());
+    EXPECT_EQ(cuddModel->getNumberOfChoices(), sylvanModel->getNumberOfChoices());
+    EXPECT_NEAR(cuddResult, sylvanResult, 1e-6);
+    
+    sylvanModel.reset();
+    storm::settings::mutableSylvanSettings().setNumberOfThreads(0);
+}
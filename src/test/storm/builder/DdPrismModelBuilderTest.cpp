@@ -1,8 +1,12 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+
+#include <cstdio>
+
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/SylvanSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Ctmc.h"
@@ -10,6 +14,48 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/api/verification.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+
+namespace {
+    template<storm::dd::DdType Type>
+    std::shared_ptr<storm::models::symbolic::Model<Type>> buildAndCheck(storm::prism::Program const& program, std::shared_ptr<storm::logic::Formula const> const& formula, double& result) {
+        std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdPrismModelBuilder<Type>().build(program, typename storm::builder::DdPrismModelBuilder<Type>::Options(*formula));
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = storm::api::verifyWithDdEngine<Type, double>(model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+        checkResult->filter(storm::modelchecker::SymbolicQualitativeCheckResult<Type>(model->getReachableStates(), model->getInitialStates()));
+        result = checkResult->template asQuantitativeCheckResult<double>().getMin();
+        return model;
+    }
+    
+    /*!
+     * Builds the given program with Sylvan using two Lace workers as well as with (sequential) CUDD and checks that
+     * the models and the value of the given formula in their initial states coincide.
+     */
+    void expectParallelSylvanBuildMatchesCudd(storm::prism::Program const& program, std::string const& formulaString) {
+        std::shared_ptr<storm::logic::Formula const> formula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaString, program)).front();
+        
+        // The number of workers is fixed when Sylvan is initialized, i.e., when the first manager is created.
+        storm::settings::mutableSylvanSettings().setNumberOfThreads(2);
+        double sylvanResult;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> sylvanModel = buildAndCheck<storm::dd::DdType::Sylvan>(program, formula, sylvanResult);
+        EXPECT_GE(sylvanModel->getManager().getNumberOfThreads(), 2ul);
+        
+        double cuddResult;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> cuddModel = buildAndCheck<storm::dd::DdType::CUDD>(program, formula, cuddResult);
+        
+        EXPECT_EQ(cuddModel->getType(), sylvanModel->getType());
+        EXPECT_EQ(cuddModel->getNumberOfStates(), sylvanModel->getNumberOfStates());
+        EXPECT_EQ(cuddModel->getNumberOfTransitions(), sylvanModel->getNumberOfTransitions());
+        EXPECT_EQ(cuddModel->getNumberOfChoices(), sylvanModel->getNumberOfChoices());
+        EXPECT_NEAR(cuddResult, sylvanResult, 1e-6);
+        
+        sylvanModel.reset();
+        storm::settings::mutableSylvanSettings().setNumberOfThreads(0);
+    }
+}
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -319,3 +365,83 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+
+TEST(DdPrismModelBuilderTest_Sylvan, VariableOrder) {
+    // Variables 0 and 2 as well as 1 and 3 belong together, so FORCE moves them next to each other.
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(4, {{0, 2}, {1, 3}});
+    std::vector<uint64_t> position(4);
+    for (uint64_t index = 0; index < order.size(); ++index) {
+        position[order[index]] = index;
+    }
+    EXPECT_EQ(1ul, std::max(position[0], position[2]) - std::min(position[0], position[2]));
+    EXPECT_EQ(1ul, std::max(position[1], position[3]) - std::min(position[1], position[3]));
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    std::string orderFilename = testing::TempDir() + "storm-dd-variable-order-test.txt";
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.variableOrder.heuristic = storm::builder::DdVariableOrderHeuristic::Force;
+    options.variableOrder.outputFilename = orderFilename;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+    EXPECT_EQ(573ul, model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+    
+    // The exported file contains the order used by the builder.
+    storm::builder::DdVariableOrderOptions forceOptions;
+    forceOptions.heuristic = storm::builder::DdVariableOrderHeuristic::Force;
+    std::vector<std::string> forceOrder;
+    for (auto const& variable : storm::builder::computeDdVariableOrder(program, forceOptions)) {
+        forceOrder.push_back(variable.getName());
+    }
+    EXPECT_EQ(forceOrder, storm::builder::parseDdVariableOrder(orderFilename));
+    
+    // Reload the exported order.
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options reloadOptions;
+    reloadOptions.variableOrder.inputFilename = orderFilename;
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, reloadOptions);
+    std::remove(orderFilename.c_str());
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+    EXPECT_EQ(573ul, model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+    
+    // The commands relate a with c and b with d, so FORCE moves c in front of b.
+    program = storm::parser::PrismParser::parseFromString(R"(mdp
+module m
+    a : [0..1] init 0;
+    b : [0..1] init 0;
+    c : [0..1] init 0;
+    d : [0..1] init 0;
+    [] a=0 -> 0.5 : (a'=1) & (c'=1) + 0.5 : (c'=0);
+    [] b=0 -> 1 : (b'=1) & (d'=1);
+endmodule
+)", "variable_order.nm");
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options declarationOptions;
+    declarationOptions.variableOrder.heuristic = storm::builder::DdVariableOrderHeuristic::Declaration;
+    declarationOptions.variableOrder.outputFilename = orderFilename;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, declarationOptions);
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c", "d"}), storm::builder::parseDdVariableOrder(orderFilename));
+    
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(std::vector<std::string>({"a", "c", "b", "d"}), storm::builder::parseDdVariableOrder(orderFilename));
+    std::remove(orderFilename.c_str());
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->getNumberOfChoices(), model->getNumberOfChoices());
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ParallelBuildMatchesCudd) {
+    // A DTMC whose modules synchronize on most actions.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm").preprocess().asPrismProgram();
+    expectParallelSylvanBuildMatchesCudd(program, "P=? [F<=20 \"elected\"]");
+    
+    // The interleaving composition of two independent modules.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm").preprocess().asPrismProgram();
+    expectParallelSylvanBuildMatchesCudd(program, "Pmin=? [F \"two\"]");
+    
+    // A model with both synchronizing and interleaving actions.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm").preprocess().asPrismProgram();
+    expectParallelSylvanBuildMatchesCudd(program, "Pmax=? [F<=25 \"elected\"]");
+}
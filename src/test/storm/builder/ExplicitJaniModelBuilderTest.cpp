@@ -9,6 +9,12 @@
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
 #include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-conv/api/storm-conv.h"
+#include "storm/api/verification.h"
+#include "storm/api/properties.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
 
 
 TEST(ExplicitJaniModelBuilderTest, Dtmc) {
@@ -143,6 +149,72 @@ TEST(ExplicitJaniModelBuilderTest, Ma) {
     EXPECT_EQ(7ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitJaniModelBuilderTest, ExpressionCompilation) {
+    storm::generator::NextStateGeneratorOptions compiledOptions;
+    storm::generator::NextStateGeneratorOptions evaluatorOptions;
+    evaluatorOptions.setCompileExpressions(false);
+    
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+        std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(janiModel, compiledOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> evaluatorModel = storm::builder::ExplicitModelBuilder<double>(janiModel, evaluatorOptions).build();
+        
+        // Evaluating the compiled guards has to yield the same model.
+        EXPECT_EQ(evaluatorModel->getTransitionMatrix(), compiledModel->getTransitionMatrix());
+    }
+}
+
+namespace {
+    /*!
+     * Builds the model with and without partial-order reduction and checks that both models yield the same results
+     * for the given properties.
+     */
+    std::pair<std::shared_ptr<storm::models::sparse::Model<double>>, std::shared_ptr<storm::models::sparse::Model<double>>> buildAndCompareWithPartialOrderReduction(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& properties) {
+        auto formulas = storm::api::extractFormulasFromProperties(properties);
+        storm::generator::NextStateGeneratorOptions generatorOptions(formulas);
+        storm::builder::ExplicitModelBuilder<double>::Options reductionOptions;
+        reductionOptions.partialOrderReduction = true;
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, reductionOptions).build();
+        for (auto const& formula : formulas) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, task);
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            std::unique_ptr<storm::modelchecker::CheckResult> fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, task);
+            fullResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(fullModel->getInitialStates()));
+            EXPECT_NEAR(fullResult->asQuantitativeCheckResult<double>().getMin(), result->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formula;
+        }
+        return std::make_pair(fullModel, model);
+    }
+}
+
+TEST(ExplicitJaniModelBuilderTest, PartialOrderReduction) {
+    // The workers are independent and invisible, so they move one after the other before the observer.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/independent_workers.nm");
+    auto janiData = storm::api::convertPrismToJani(program, storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"done\"]; Pmax=? [F \"done\"]", program));
+    janiData.first.substituteFunctions();
+    auto models = buildAndCompareWithPartialOrderReduction(janiData.first, janiData.second);
+    EXPECT_EQ(48ul, models.first->getNumberOfStates());
+    EXPECT_EQ(9ul, models.second->getNumberOfStates());
+    EXPECT_EQ(10ul, models.second->getNumberOfChoices());
+    
+    // If a property observes the second worker, only the first one moves ahead.
+    janiData = storm::api::convertPrismToJani(program, storm::api::parsePropertiesForPrismProgram("Pmin=? [F b=2 & \"done\"]; Pmax=? [F b=2 & \"done\"]", program));
+    janiData.first.substituteFunctions();
+    models = buildAndCompareWithPartialOrderReduction(janiData.first, janiData.second);
+    EXPECT_EQ(15ul, models.second->getNumberOfStates());
+    
+    // The location of an automaton is accessed like a variable: the worker edges depend on each other, but only one of
+    // them is enabled at a time, so the worker moves to its last location before the observer.
+    storm::jani::Model janiModel = storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/mdp/independent_locations.jani").first;
+    models = buildAndCompareWithPartialOrderReduction(janiModel, storm::api::parsePropertiesForJaniModel("Pmin=? [F \"done\"]; Pmax=? [F \"done\"]", janiModel));
+    EXPECT_EQ(9ul, models.first->getNumberOfStates());
+    EXPECT_EQ(5ul, models.second->getNumberOfStates());
+    EXPECT_EQ(6ul, models.second->getNumberOfChoices());
+}
+
 TEST(ExplicitJaniModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
     storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
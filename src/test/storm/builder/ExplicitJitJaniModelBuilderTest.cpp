@@ -1,10 +1,15 @@
 #include "test/storm_gtest.h"
+
+#include <numeric>
+
 #include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/JaniNextStateGenerator.h"
 #include "storm/storage/jani/Model.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -148,3 +153,42 @@ TEST(ExplicitJitJaniModelBuilderTest, FailComposition) {
     
     STORM_SILENT_ASSERT_THROW(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel).build();, storm::exceptions::WrongFormatException);
 }
+
+namespace {
+    void checkParityWithExplicitModelBuilder(std::string const& filename, bool prismCompatibility = false) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(filename, prismCompatibility);
+        storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+        storm::builder::BuilderOptions options(true, true);
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> jitModel = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel, options).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+        
+        EXPECT_EQ(model->getType(), jitModel->getType()) << filename;
+        EXPECT_EQ(model->getNumberOfStates(), jitModel->getNumberOfStates()) << filename;
+        EXPECT_EQ(model->getNumberOfTransitions(), jitModel->getNumberOfTransitions()) << filename;
+        EXPECT_EQ(model->getNumberOfChoices(), jitModel->getNumberOfChoices()) << filename;
+        
+        // The states may be ordered differently, so we only compare quantities that are independent of the order.
+        for (auto const& label : model->getStateLabeling().getLabels()) {
+            ASSERT_TRUE(jitModel->hasLabel(label)) << filename << ": " << label;
+            EXPECT_EQ(model->getStates(label).getNumberOfSetBits(), jitModel->getStates(label).getNumberOfSetBits()) << filename << ": " << label;
+        }
+        ASSERT_EQ(model->getNumberOfRewardModels(), jitModel->getNumberOfRewardModels()) << filename;
+        for (auto const& rewardModel : model->getRewardModels()) {
+            ASSERT_TRUE(jitModel->hasRewardModel(rewardModel.first)) << filename << ": " << rewardModel.first;
+            std::vector<double> totalRewards = rewardModel.second.getTotalRewardVector(model->getTransitionMatrix());
+            std::vector<double> jitTotalRewards = jitModel->getRewardModel(rewardModel.first).getTotalRewardVector(jitModel->getTransitionMatrix());
+            EXPECT_NEAR(std::accumulate(totalRewards.begin(), totalRewards.end(), 0.0), std::accumulate(jitTotalRewards.begin(), jitTotalRewards.end(), 0.0), 1e-6) << filename << ": " << rewardModel.first;
+        }
+    }
+}
+
+TEST(ExplicitJitJaniModelBuilderTest, ParityWithExplicitModelBuilder) {
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", true);
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    checkParityWithExplicitModelBuilder(STORM_TEST_RESOURCES_DIR "/ma/stream2.ma");
+}
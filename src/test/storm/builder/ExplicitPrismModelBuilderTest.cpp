@@ -1,9 +1,21 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+
+#include <algorithm>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/CompositionalModelBuilder.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/vector.h"
+#include "storm/api/verification.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -120,6 +132,275 @@ TEST(ExplicitPrismModelBuilderTest, Ma) {
     EXPECT_EQ(7ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels();
+    
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        
+        // The parallel exploration has to yield the very same state numbering.
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix());
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates());
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling());
+        EXPECT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, OutOfCore) {
+    storm::builder::ExplicitModelBuilder<double>::Options outOfCoreOptions;
+    outOfCoreOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    outOfCoreOptions.buildOutOfCore = true;
+    // Use a small buffer such that all of the models below have transitions that are written to disk.
+    outOfCoreOptions.outOfCoreBufferSize = 64;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildAllLabels();
+    
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> outOfCoreModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, outOfCoreOptions).build();
+        
+        EXPECT_EQ(model->getTransitionMatrix(), outOfCoreModel->getTransitionMatrix());
+        EXPECT_EQ(model->getInitialStates(), outOfCoreModel->getInitialStates());
+        EXPECT_EQ(model->getStateLabeling(), outOfCoreModel->getStateLabeling());
+        EXPECT_EQ(model->getNumberOfRewardModels(), outOfCoreModel->getNumberOfRewardModels());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    storm::builder::ExplicitModelBuilder<double>::Options symmetryOptions;
+    symmetryOptions.symmetryReduction = true;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildAllLabels();
+    
+    // The two processes are renamed copies and the labels and rewards treat them alike, so only one of the states
+    // that differ by swapping the processes is explored.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(272ul, model->getNumberOfStates());
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, symmetryOptions).build();
+    EXPECT_EQ(154ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+    
+    // The properties that treat the processes alike have the same values in both models.
+    std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"finished\" & \"all_coins_equal_1\"]; Pmax=? [F \"finished\" & !\"agree\"]; Rmin=? [F \"finished\"]; Rmax=? [F \"finished\"]", program));
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, task);
+        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+        std::unique_ptr<storm::modelchecker::CheckResult> fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, task);
+        fullResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(fullModel->getInitialStates()));
+        EXPECT_NEAR(fullResult->asQuantitativeCheckResult<double>().getMin(), result->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formula;
+    }
+    
+    // The stations synchronize with the server on renamed actions, so they are not symmetric.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/polling2.sm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, symmetryOptions).build();
+    EXPECT_EQ(model->getTransitionMatrix(), reducedModel->getTransitionMatrix());
+}
+
+namespace {
+    /*!
+     * Builds the program with and without partial-order reduction and checks that both models yield the same results
+     * for the given properties.
+     */
+    std::pair<std::shared_ptr<storm::models::sparse::Model<double>>, std::shared_ptr<storm::models::sparse::Model<double>>> buildAndCompareWithPartialOrderReduction(storm::prism::Program const& program, std::string const& propertyString) {
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(propertyString, program));
+        storm::generator::NextStateGeneratorOptions generatorOptions(formulas);
+        storm::builder::ExplicitModelBuilder<double>::Options reductionOptions;
+        reductionOptions.partialOrderReduction = true;
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, reductionOptions).build();
+        for (auto const& formula : formulas) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, task);
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            std::unique_ptr<storm::modelchecker::CheckResult> fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, task);
+            fullResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(fullModel->getInitialStates()));
+            EXPECT_NEAR(fullResult->asQuantitativeCheckResult<double>().getMin(), result->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formula;
+        }
+        return std::make_pair(fullModel, model);
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    // The workers are independent and invisible, so they move one after the other before the observer.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/independent_workers.nm");
+    auto models = buildAndCompareWithPartialOrderReduction(program, "Pmin=? [F \"done\"]; Pmax=? [F \"done\"]");
+    EXPECT_EQ(48ul, models.first->getNumberOfStates());
+    EXPECT_EQ(9ul, models.second->getNumberOfStates());
+    EXPECT_EQ(10ul, models.second->getNumberOfChoices());
+    EXPECT_EQ(1ul, models.second->getStates("done").getNumberOfSetBits());
+    
+    // If a property observes the second worker, only the first one moves ahead.
+    models = buildAndCompareWithPartialOrderReduction(program, "Pmin=? [F b=2 & \"done\"]; Pmax=? [F b=2 & \"done\"]; Pmax=? [F \"done\"]");
+    EXPECT_EQ(48ul, models.first->getNumberOfStates());
+    EXPECT_EQ(15ul, models.second->getNumberOfStates());
+    
+    // The dependencies are determined per command: the first command of the worker is independent of the observer
+    // and may be taken alone as long as the second one, which writes a variable read by the observer, is disabled.
+    program = storm::parser::PrismParser::parseFromString(R"(mdp
+global g : [0..1] init 0;
+module worker
+    a : [0..3] init 0;
+    [] a<3 -> (a'=a+1);
+    [] a=3 & g=0 -> (g'=1);
+endmodule
+module observer
+    c : [0..2] init 0;
+    [] c=0 & g=1 -> 0.5 : (c'=1) + 0.5 : (c'=2);
+    [] c=0 -> (c'=2);
+endmodule
+label "done" = c=1;
+)", "shared_worker.nm");
+    models = buildAndCompareWithPartialOrderReduction(program, "Pmin=? [F \"done\"]; Pmax=? [F \"done\"]; Pmax=? [F g=1 & c=2]");
+    EXPECT_EQ(11ul, models.first->getNumberOfStates());
+    EXPECT_EQ(8ul, models.second->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, Compositional) {
+    storm::builder::BuilderOptions options;
+    options.addLabel("down1");
+    
+    // The machines are independent and the label only refers to the first one, so the two other machines may be
+    // permuted in the quotient.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/machines3.sm");
+    storm::builder::CompositionalModelBuilder<double> builder(program, options);
+    ASSERT_TRUE(builder.isSupported());
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+    EXPECT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    EXPECT_EQ(18ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+    EXPECT_TRUE(model->hasLabel("down1"));
+    EXPECT_TRUE(model->getStates("deadlock").empty());
+    
+    // Building the model at once and minimizing it yields a quotient of the same size.
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Ctmc<double>>();
+    EXPECT_EQ(27ul, fullModel->getNumberOfStates());
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<double>> decomposition(*fullModel);
+    decomposition.computeBisimulationDecomposition();
+    auto quotient = decomposition.getQuotient();
+    EXPECT_EQ(quotient->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(quotient->getNumberOfTransitions(), model->getNumberOfTransitions());
+    
+    // The modules of this program synchronize.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/polling2.sm");
+    EXPECT_FALSE(storm::builder::CompositionalModelBuilder<double>(program, options).isSupported());
+}
+
+TEST(ExplicitPrismModelBuilderTest, CompositionalDeadlocks) {
+    storm::builder::BuilderOptions options;
+    options.addLabel("finished1");
+    
+    // Each job is in a deadlock once it is finished, but the program only is when both jobs are finished.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/jobs2.sm");
+    storm::builder::CompositionalModelBuilder<double> builder(program, options);
+    ASSERT_TRUE(builder.isSupported());
+    auto model = builder.build()->as<storm::models::sparse::Ctmc<double>>();
+    EXPECT_EQ(1ul, model->getStates("deadlock").getNumberOfSetBits());
+    
+    // The quotient of the model that is built at once coincides with the one built compositionally, in particular
+    // there are no additional self-loops in states where only one of the jobs is finished.
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Ctmc<double>>();
+    EXPECT_EQ(1ul, fullModel->getStates("deadlock").getNumberOfSetBits());
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<double>> decomposition(*fullModel);
+    decomposition.computeBisimulationDecomposition();
+    auto quotient = decomposition.getQuotient()->as<storm::models::sparse::Ctmc<double>>();
+    EXPECT_EQ(quotient->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(quotient->getNumberOfTransitions(), model->getNumberOfTransitions());
+    std::vector<double> exitRates = model->getExitRateVector();
+    std::vector<double> quotientExitRates = quotient->getExitRateVector();
+    std::sort(exitRates.begin(), exitRates.end());
+    std::sort(quotientExitRates.begin(), quotientExitRates.end());
+    EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(quotientExitRates, exitRates, 1e-12, false));
+    
+    // Both models yield the same results.
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F<=1 \"deadlock\"]; P=? [F<=2 \"finished1\"]", program));
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, task);
+        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+        std::unique_ptr<storm::modelchecker::CheckResult> fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, task);
+        fullResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(fullModel->getInitialStates()));
+        EXPECT_NEAR(fullResult->asQuantitativeCheckResult<double>().getMin(), result->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formula;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ExpressionCompilation) {
+    storm::generator::NextStateGeneratorOptions compiledOptions;
+    compiledOptions.setBuildAllRewardModels();
+    compiledOptions.setBuildAllLabels();
+    storm::generator::NextStateGeneratorOptions evaluatorOptions = compiledOptions;
+    evaluatorOptions.setCompileExpressions(false);
+    
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm", STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/mdp/firewire.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(program, compiledOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> evaluatorModel = storm::builder::ExplicitModelBuilder<double>(program, evaluatorOptions).build();
+        
+        // Evaluating the compiled expressions has to yield the same model (up to rounding errors, because the evaluator
+        // may reorder some arithmetic operations).
+        auto const& evaluatorMatrix = evaluatorModel->getTransitionMatrix();
+        auto const& compiledMatrix = compiledModel->getTransitionMatrix();
+        ASSERT_EQ(evaluatorMatrix.getEntryCount(), compiledMatrix.getEntryCount());
+        EXPECT_EQ(evaluatorMatrix.getRowGroupIndices(), compiledMatrix.getRowGroupIndices());
+        for (auto evaluatorIt = evaluatorMatrix.begin(), compiledIt = compiledMatrix.begin(); evaluatorIt != evaluatorMatrix.end(); ++evaluatorIt, ++compiledIt) {
+            EXPECT_EQ(evaluatorIt->getColumn(), compiledIt->getColumn());
+            EXPECT_NEAR(evaluatorIt->getValue(), compiledIt->getValue(), 1e-12);
+        }
+        EXPECT_EQ(evaluatorModel->getStateLabeling(), compiledModel->getStateLabeling());
+        for (auto const& rewardModel : evaluatorModel->getRewardModels()) {
+            auto const& compiledRewardModel = compiledModel->getRewardModel(rewardModel.first);
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(rewardModel.second.getStateRewardVector(), compiledRewardModel.getStateRewardVector(), 1e-12, false));
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(rewardModel.second.getStateActionRewardVector(), compiledRewardModel.getStateActionRewardVector(), 1e-12, false));
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardIndex) {
+    storm::generator::NextStateGeneratorOptions indexedOptions;
+    indexedOptions.setBuildAllRewardModels();
+    indexedOptions.setBuildAllLabels();
+    indexedOptions.setBuildChoiceLabels();
+    storm::generator::NextStateGeneratorOptions unindexedOptions = indexedOptions;
+    unindexedOptions.setIndexGuards(false);
+    
+    // All programs consist of several modules whose commands are guarded by program counters or flags. Some of them
+    // mix synchronizing and unlabeled commands.
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", STORM_TEST_RESOURCES_DIR "/ctmc/polling2.sm", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/mdp/firewire.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        ASSERT_GT(program.getNumberOfModules(), 1ul);
+        std::shared_ptr<storm::models::sparse::Model<double>> indexedModel = storm::builder::ExplicitModelBuilder<double>(program, indexedOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> unindexedModel = storm::builder::ExplicitModelBuilder<double>(program, unindexedOptions).build();
+        
+        // The index only skips commands that are disabled, so the same choices are generated in the same order.
+        ASSERT_EQ(unindexedModel->getType(), indexedModel->getType());
+        EXPECT_EQ(unindexedModel->getTransitionMatrix(), indexedModel->getTransitionMatrix());
+        EXPECT_EQ(unindexedModel->getStateLabeling(), indexedModel->getStateLabeling());
+        EXPECT_EQ(unindexedModel->getChoiceLabeling(), indexedModel->getChoiceLabeling());
+        for (auto const& rewardModel : unindexedModel->getRewardModels()) {
+            auto const& indexedRewardModel = indexedModel->getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), indexedRewardModel.getOptionalStateRewardVector());
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), indexedRewardModel.getOptionalStateActionRewardVector());
+        }
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
@@ -0,0 +1,194 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/utility/BinaryModelExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::expressions::ExpressionManager> const& manager = nullptr) {
+        std::string filename = testing::TempDir() + "storm-binary-model-test.bin";
+        storm::exporter::exportSparseModelAsBinary(filename, model);
+        auto result = storm::parser::BinaryModelParser::parseModel(filename, manager);
+        std::remove(filename.c_str());
+        return result;
+    }
+
+    /*!
+     * Exports the given model, lets the given function modify the bytes of the file and parses the result.
+     */
+    template<typename Modification>
+    std::shared_ptr<storm::models::sparse::Model<double>> exportModifyAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, Modification const& modification) {
+        std::string filename = testing::TempDir() + "storm-binary-model-test.bin";
+        storm::exporter::exportSparseModelAsBinary(filename, model);
+        std::string bytes;
+        {
+            std::ifstream in(filename, std::ios::in | std::ios::binary);
+            std::stringstream buffer;
+            buffer << in.rdbuf();
+            bytes = buffer.str();
+        }
+        modification(bytes);
+        {
+            std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), bytes.size());
+        }
+        try {
+            auto result = storm::parser::BinaryModelParser::parseModel(filename);
+            std::remove(filename.c_str());
+            return result;
+        } catch (...) {
+            std::remove(filename.c_str());
+            throw;
+        }
+    }
+
+    void setNumber(std::string& bytes, uint64_t offset, uint64_t value) {
+        ASSERT_LE(offset + 8, bytes.size());
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+    }
+
+    uint64_t getNumber(std::string const& bytes, uint64_t offset) {
+        uint64_t result;
+        std::memcpy(&result, &bytes[offset], sizeof(result));
+        return result;
+    }
+
+    // The size of the header and the offsets of the parts of the first section, which holds the row indications of DTMCs.
+    uint64_t const headerSize = 56;
+    uint64_t const numberOfChoicesOffset = 40;
+    uint64_t const firstPayloadSizeOffset = headerSize + 8;
+    uint64_t const firstPayloadOffset = headerSize + 16;
+
+    void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+        EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+        ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& rewardModel : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+            auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), actualRewardModel.getOptionalStateRewardVector());
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), actualRewardModel.getOptionalStateActionRewardVector());
+        }
+    }
+}
+
+TEST(BinaryModelParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(254ul, parsedModel->getNumberOfChoices());
+}
+
+TEST(BinaryModelParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), parsedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryModelParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    auto markovAutomaton = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMarkovAutomaton = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(markovAutomaton->getMarkovianStates(), parsedMarkovAutomaton->getMarkovianStates());
+    EXPECT_EQ(markovAutomaton->getExitRates(), parsedMarkovAutomaton->getExitRates());
+}
+
+TEST(BinaryModelParserTest, StateValuationsAndChoiceLabels) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildStateValuations().setBuildChoiceLabels();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    // Without a manager, the state valuations are skipped.
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_FALSE(parsedModel->hasStateValuations());
+    ASSERT_TRUE(parsedModel->hasChoiceLabeling());
+    EXPECT_EQ(model->getChoiceLabeling(), parsedModel->getChoiceLabeling());
+
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    parsedModel = exportAndParse(model, manager);
+    ASSERT_TRUE(parsedModel->hasStateValuations());
+    for (auto const& variable : model->getStateValuations().getVariables()) {
+        ASSERT_TRUE(manager->hasVariable(variable.getName()));
+        storm::expressions::Variable parsedVariable = manager->getVariable(variable.getName());
+        for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+            if (variable.hasBooleanType()) {
+                EXPECT_EQ(model->getStateValuations().getBooleanValue(state, variable), parsedModel->getStateValuations().getBooleanValue(state, parsedVariable));
+            } else {
+                EXPECT_EQ(model->getStateValuations().getIntegerValue(state, variable), parsedModel->getStateValuations().getIntegerValue(state, parsedVariable));
+            }
+        }
+    }
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    STORM_SILENT_ASSERT_THROW(storm::parser::BinaryModelParser::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryModelParserTest, MalformedSections) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    uint64_t numberOfStates = model->getNumberOfStates();
+    uint64_t entriesOffset = firstPayloadOffset + (numberOfStates + 1) * 8;
+
+    // The unmodified file is accepted.
+    auto parsedModel = exportModifyAndParse(model, [] (std::string&) {});
+    expectEqualModels(*model, *parsedModel);
+
+    // A payload size that does not match the contents of a section.
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, firstPayloadSizeOffset, getNumber(bytes, firstPayloadSizeOffset) + 8);
+    }), storm::exceptions::WrongFormatException);
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, entriesOffset + 8, getNumber(bytes, entriesOffset + 8) - 8);
+    }), storm::exceptions::WrongFormatException);
+
+    // Row indications that are not monotonic or exceed the number of entries.
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, firstPayloadOffset + 8, model->getNumberOfTransitions());
+    }), storm::exceptions::WrongFormatException);
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, firstPayloadOffset + numberOfStates * 8, model->getNumberOfTransitions() + 1);
+    }), storm::exceptions::WrongFormatException);
+
+    // A column that is out of bounds.
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, entriesOffset + 16, numberOfStates);
+    }), storm::exceptions::WrongFormatException);
+
+    // A deterministic model whose number of choices differs from the number of states.
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, numberOfChoicesOffset, numberOfStates + 1);
+    }), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryModelParserTest, MalformedRowGroups) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    uint64_t numberOfStates = model->getNumberOfStates();
+
+    // The first section holds the row group indices of nondeterministic models.
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, firstPayloadOffset + 8, model->getNumberOfChoices());
+    }), storm::exceptions::WrongFormatException);
+    STORM_SILENT_ASSERT_THROW(exportModifyAndParse(model, [&] (std::string& bytes) {
+        setNumber(bytes, firstPayloadOffset + numberOfStates * 8, model->getNumberOfChoices() + 1);
+    }), storm::exceptions::WrongFormatException);
+}
@@ -84,3 +84,32 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
 
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    storm::parser::DirectEncodingParserOptions parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    // Use small chunks such that even the small test files are split.
+    parallelOptions.minimalChunkSize = 128;
+    storm::parser::DirectEncodingParserOptions sequentialOptions;
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.drn", "/ctmc/cluster2.drn", "/mdp/two_dice.drn", "/ma/jobscheduler.drn"}) {
+        auto sequentialModel = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file, sequentialOptions);
+        auto parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file, parallelOptions);
+
+        ASSERT_EQ(sequentialModel->getType(), parallelModel->getType()) << file;
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling()) << file;
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first)) << file;
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), parallelModel->getRewardModel(rewardModel.first).getOptionalStateRewardVector()) << file;
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), parallelModel->getRewardModel(rewardModel.first).getOptionalStateActionRewardVector()) << file;
+        }
+        if (sequentialModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto sequentialMa = sequentialModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+            auto parallelMa = parallelModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+            EXPECT_EQ(sequentialMa->getMarkovianStates(), parallelMa->getMarkovianStates());
+            EXPECT_EQ(sequentialMa->getExitRates(), parallelMa->getExitRates());
+        }
+    }
+}
@@ -7,6 +7,10 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseSubmatrixView.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -95,6 +99,19 @@ namespace {
         }
     };
     
+    class NativeDoubleMulticolorGaussSeidelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::MulticolorGaussSeidel);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleSorEnvironment {
     public:
         typedef double ValueType;
@@ -294,6 +311,22 @@ namespace {
         }
     };
     
+    class TopologicalParallelNativeDoubleGaussSeidelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setParallelSccScheduling(true);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     template<typename TestType>
     class LinearEquationSolverTest : public ::testing::Test {
     public:
@@ -313,6 +346,7 @@ namespace {
             NativeDoubleIntervalIterationEnvironment,
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
+            NativeDoubleMulticolorGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
             NativeRationalRationalSearchEnvironment,
@@ -327,7 +361,8 @@ namespace {
             EigenBicgstabNoneEnvironment,
             EigenDoubleLUEnvironment,
             EigenRationalLUEnvironment,
-            TopologicalEigenRationalLUEnvironment
+            TopologicalEigenRationalLUEnvironment,
+            TopologicalParallelNativeDoubleGaussSeidelEnvironment
     > TestingTypes;
     
     TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes,);
@@ -369,4 +404,130 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
-}
\ No newline at end of file
+    
+    TYPED_TEST(LinearEquationSolverTest, solveEquationSystemBatch) {
+        typedef typename TestFixture::ValueType ValueType;
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(3));
+        std::vector<std::vector<ValueType>> b = {{this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")}, {this->parseNumber("1"), this->parseNumber("0"), this->parseNumber("0")}};
+        
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            A.convertToEquationSystem();
+        }
+        
+        auto solver = factory.create(this->env(), A);
+        solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+        ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("481/9"), this->precision());
+        EXPECT_NEAR(x[0][1], this->parseNumber("457/9"), this->precision());
+        EXPECT_NEAR(x[0][2], this->parseNumber("875/18"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("85/18"), this->precision());
+        EXPECT_NEAR(x[1][1], this->parseNumber("35/9"), this->precision());
+        EXPECT_NEAR(x[1][2], this->parseNumber("55/18"), this->precision());
+    }
+    
+    TYPED_TEST(LinearEquationSolverTest, solveEquationSystemWithSubmatrixView) {
+        typedef typename TestFixture::ValueType ValueType;
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            GTEST_SKIP() << "Submatrix views are only used for the fixed point format.";
+        }
+        
+        // The system of the tests above, embedded into the states 1, 2 and 3 of a larger matrix. The entries in the
+        // columns of the states 0 and 4 are not part of the submatrix.
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/2")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("1/5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("48/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 3, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 4, this->parseNumber("3/10")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("4/10")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("3/10")));
+        ASSERT_NO_THROW(builder.addNextValue(4, 4, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> matrix;
+        ASSERT_NO_THROW(matrix = builder.build());
+        storm::storage::BitVector states(5, {1, 2, 3});
+        storm::storage::SparseSubmatrixView<ValueType> view(matrix, true, states, states);
+        
+        std::vector<ValueType> x(3);
+        std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+        
+        auto solver = factory.create(this->env(), view);
+        solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("481/9"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
+    }
+    
+    TEST(LinearEquationSolverTest, TopologicalParallelWithDifferentNumberOfThreads) {
+        // The SCCs are solved by four threads while the solvers for the SCCs would use two threads on their own.
+        storm::settings::mutableCoreSettings().setNumberOfThreads(2);
+        
+        // Eight independent copies of the system of the tests above, each of which forms an SCC.
+        uint64_t const numberOfCopies = 8;
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+            uint64_t offset = 3 * copy;
+            builder.addNextValue(offset, offset, 0.2);
+            builder.addNextValue(offset, offset + 1, 0.4);
+            builder.addNextValue(offset, offset + 2, 0.4);
+            builder.addNextValue(offset + 1, offset, 0.02);
+            builder.addNextValue(offset + 1, offset + 1, 0.96);
+            builder.addNextValue(offset + 1, offset + 2, 0.02);
+            builder.addNextValue(offset + 2, offset, 0.4);
+            builder.addNextValue(offset + 2, offset + 1, 0.3);
+        }
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+        std::vector<double> b;
+        for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+            b.insert(b.end(), {3.0, -0.01, 12.0});
+        }
+        
+        for (auto const& method : {storm::solver::NativeLinearEquationSolverMethod::Jacobi, storm::solver::NativeLinearEquationSolverMethod::Power}) {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setParallelSccScheduling(true);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().native().setMethod(method);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            
+            storm::storage::SparseMatrix<double> A = matrix;
+            auto factory = storm::solver::GeneralLinearEquationSolverFactory<double>();
+            if (factory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+                A.convertToEquationSystem();
+            }
+            auto solver = factory.create(env, A);
+            solver->setBounds(-100.0, 100.0);
+            std::vector<double> x(A.getRowCount());
+            ASSERT_NO_THROW(solver->solveEquations(env, x, b));
+            for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+                EXPECT_NEAR(x[3 * copy], 481.0 / 9.0, 1e-6);
+                EXPECT_NEAR(x[3 * copy + 1], 457.0 / 9.0, 1e-6);
+                EXPECT_NEAR(x[3 * copy + 2], 875.0 / 18.0, 1e-6);
+            }
+        }
+        
+        storm::settings::mutableCoreSettings().setNumberOfThreads(1);
+    }
+}
@@ -5,10 +5,13 @@
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseSubmatrixView.h"
+#include "storm/storage/BitVector.h"
 
 namespace {
     
@@ -37,6 +40,18 @@ namespace {
         }
     };
     
+    class DoubleMulticolorGaussSeidelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::MulticolorGaussSeidel);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
     class DoubleIntervalIterationEnvironment {
     public:
         typedef double ValueType;
@@ -50,6 +65,21 @@ namespace {
         }
     };
 
+    class DoubleMulticolorIntervalIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setMulticolorGaussSeidel(true);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
+    
     class DoubleOptimisticViEnvironment {
     public:
         typedef double ValueType;
@@ -76,6 +106,22 @@ namespace {
         }
     };
     
+    class DoubleTopologicalParallelViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setParallelSccScheduling(true);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().topological().setTrivialSccBatchSize(2);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
     class DoubleTopologicalCudaViEnvironment {
     public:
         typedef double ValueType;
@@ -136,10 +182,13 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoubleMulticolorGaussSeidelEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
+            DoubleMulticolorIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
+            DoubleTopologicalParallelViEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
             RationalPIEnvironment,
@@ -175,7 +224,118 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsWithSubmatrixView) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // The system of the test above is given by the second row group of a larger matrix. The entries in the
+        // column of the first row group are not part of the submatrix.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(1));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("0.05")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.5")));
+        
+        storm::storage::SparseMatrix<ValueType> matrix;
+        ASSERT_NO_THROW(matrix = builder.build());
+        storm::storage::BitVector states(2, {1});
+        storm::storage::SparseSubmatrixView<ValueType> view(matrix, true, states, states);
+        
+        std::vector<ValueType> x(1);
+        std::vector<ValueType> b = {this->parseNumber("0.099"), this->parseNumber("0.5")};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), view);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+        
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
+    }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsWithMatrixAndSubmatrixView) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // The system is given by the last two row groups of the matrix. Solving it once with the explicit submatrix
+        // and once with a view on it has to yield the same solution, even if the method needs an explicit matrix.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(1));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("0.1")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.2")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0.6")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("0.3")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("0.3")));
+        ASSERT_NO_THROW(builder.addNextValue(4, 0, this->parseNumber("0.5")));
+        
+        storm::storage::SparseMatrix<ValueType> matrix;
+        ASSERT_NO_THROW(matrix = builder.build(5, 3, 3));
+        storm::storage::BitVector states(3, {1, 2});
+        storm::storage::SparseMatrix<ValueType> submatrix = matrix.getSubmatrix(true, states, states);
+        storm::storage::SparseSubmatrixView<ValueType> view(matrix, true, states, states);
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0.2"), this->parseNumber("0.3"), this->parseNumber("0.4")};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), submatrix);
+        auto viewSolver = factory.create(this->env(), view);
+        for (auto* currentSolver : {solver.get(), viewSolver.get()}) {
+            currentSolver->setHasUniqueSolution(true);
+            currentSolver->setHasNoEndComponents(true);
+            currentSolver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+            storm::solver::MinMaxLinearEquationSolverRequirements req = currentSolver->getRequirements(this->env());
+            req.clearBounds();
+            ASSERT_FALSE(req.hasEnabledRequirement());
+        }
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<ValueType> x(2);
+            std::vector<ValueType> viewX(2);
+            ASSERT_NO_THROW(solver->solveEquations(this->env(), dir, x, b));
+            ASSERT_NO_THROW(viewSolver->solveEquations(this->env(), dir, viewX, b));
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                EXPECT_NEAR(x[state], viewX[state], this->precision() + this->precision());
+            }
+        }
+    }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsBatch) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(2));
+        
+        std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(1));
+        std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.099"), this->parseNumber("0.5")}, {this->parseNumber("0.05"), this->parseNumber("0.8")}};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("0.5"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("0.5"), this->precision());
+        
+        ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("0.99"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("0.8"), this->precision());
+    }
 }
-
-
-
@@ -3,6 +3,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseSubmatrixView.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 
@@ -20,6 +21,18 @@ namespace {
         }
     };
     
+    class NativeCompactEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setCompactStorage(true);
+            return env;
+        }
+    };
+    
     class GmmxxEnvironment {
     public:
         typedef double ValueType;
@@ -31,6 +44,17 @@ namespace {
         }
     };
     
+    class SimdEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+            return env;
+        }
+    };
+    
     template<typename TestType>
     class MultiplierTest : public ::testing::Test {
     public:
@@ -45,7 +69,9 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
-            GmmxxEnvironment
+            NativeCompactEnvironment,
+            GmmxxEnvironment,
+            SimdEnvironment
     > TestingTypes;
     
     TYPED_TEST_SUITE(MultiplierTest, TestingTypes,);
@@ -120,4 +146,147 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, submatrixViewTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 3, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("0.3")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 3, this->parseNumber("0.7")));
+        ASSERT_NO_THROW(builder.newRowGroup(4));
+        ASSERT_NO_THROW(builder.addNextValue(4, 3, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        // Drop the second state.
+        storm::storage::BitVector states(4, {0, 2, 3});
+        storm::storage::SparseSubmatrixView<ValueType> view(A, true, states, states);
+        storm::storage::SparseMatrix<ValueType> submatrix = A.getSubmatrix(true, states, states);
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0.2"), this->parseNumber("0.3"), this->parseNumber("0")};
+        std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("1")};
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto viewMultiplier = factory.create(this->env(), view);
+        auto multiplier = factory.create(this->env(), submatrix);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<ValueType> x = initialX;
+            std::vector<ValueType> expectedX = initialX;
+            ASSERT_NO_THROW(viewMultiplier->repeatedMultiplyAndReduce(this->env(), dir, x, &b, 10));
+            ASSERT_NO_THROW(multiplier->repeatedMultiplyAndReduce(this->env(), dir, expectedX, &b, 10));
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                EXPECT_NEAR(expectedX[state], x[state], this->precision());
+            }
+            
+            x = initialX;
+            expectedX = initialX;
+            ASSERT_NO_THROW(viewMultiplier->multiplyAndReduceGaussSeidel(this->env(), dir, x, &b));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, expectedX, &b));
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                EXPECT_NEAR(expectedX[state], x[state], this->precision());
+            }
+        }
+    }
+    
+    TYPED_TEST(MultiplierTest, batchTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<std::vector<ValueType>> x = {{this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")}, {this->parseNumber("0.2"), this->parseNumber("0.4"), this->parseNumber("0.8")}};
+        std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0.2"), this->parseNumber("0")}, {this->parseNumber("0"), this->parseNumber("0.3"), this->parseNumber("0"), this->parseNumber("0.1")}};
+        std::vector<ValueType> batchX = storm::utility::vector::interleave(x);
+        std::vector<ValueType> batchB = storm::utility::vector::interleave(b);
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        std::vector<ValueType> batchResult;
+        ASSERT_NO_THROW(multiplier->multiplyBatch(this->env(), 2, batchX, &batchB, batchResult));
+        ASSERT_EQ(2 * A.getRowCount(), batchResult.size());
+        for (uint64_t i = 0; i < 2; ++i) {
+            std::vector<ValueType> expected(A.getRowCount());
+            ASSERT_NO_THROW(multiplier->multiply(this->env(), x[i], &b[i], expected));
+            for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+                EXPECT_NEAR(expected[row], batchResult[row * 2 + i], this->precision());
+            }
+        }
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            // Reduce repeatedly with the input vector as result vector.
+            std::vector<ValueType> batchValues = batchX;
+            for (uint64_t step = 0; step < 5; ++step) {
+                ASSERT_NO_THROW(multiplier->multiplyAndReduceBatch(this->env(), dir, 2, batchValues, &batchB, batchValues));
+            }
+            for (uint64_t i = 0; i < 2; ++i) {
+                std::vector<ValueType> expected = x[i];
+                for (uint64_t step = 0; step < 5; ++step) {
+                    ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, expected, &b[i], expected));
+                }
+                for (uint64_t state = 0; state < expected.size(); ++state) {
+                    EXPECT_NEAR(expected[state], batchValues[state * 2 + i], this->precision());
+                }
+            }
+        }
+    }
+    
+    TEST(NativeMultiplierTest, multicolorRowGroupsTest) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, 1));
+        ASSERT_NO_THROW(builder.addNextValue(3, 0, 0.3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, 0.7));
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(4, 3));
+        
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setMulticolorGaussSeidel(true);
+        
+        // Two different groupings of the rows into the same number of row groups.
+        std::vector<uint64_t> firstRowGroupIndices = {0, 2, 3, 4};
+        std::vector<uint64_t> secondRowGroupIndices = {0, 1, 3, 4};
+        std::vector<double> b = {0.1, 0.2, 0.3, 0.4};
+        std::vector<double> initialX = {0.2, 0.5, 0.9};
+        
+        auto factory = storm::solver::MultiplierFactory<double>();
+        auto multiplier = factory.create(env, A);
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> x = initialX;
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(env, dir, firstRowGroupIndices, x, &b));
+            
+            // The ordering computed for the first grouping must not be used for the second one.
+            x = initialX;
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(env, dir, secondRowGroupIndices, x, &b));
+            std::vector<double> expectedX = initialX;
+            auto freshMultiplier = factory.create(env, A);
+            ASSERT_NO_THROW(freshMultiplier->multiplyAndReduceGaussSeidel(env, dir, secondRowGroupIndices, expectedX, &b));
+            EXPECT_EQ(expectedX, x);
+        }
+    }
+    
+}
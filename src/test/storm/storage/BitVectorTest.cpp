@@ -1,8 +1,11 @@
 #include "test/storm_gtest.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
+#include <thread>
+
 TEST(BitVectorTest, InitToZero) {
 	storm::storage::BitVector vector(32);
     
@@ -66,6 +69,30 @@ TEST(BitVectorTest, GetSet) {
 	}
 }
 
+TEST(BitVectorTest, SetAtomically) {
+    storm::storage::BitVector vector(1000);
+    
+    // Each bit is set by two threads, but only one of them may see it unset.
+    std::vector<uint64_t> newlySetBits(4, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&vector, &newlySetBits, thread] () {
+            for (uint64_t i = thread % 2; i < 1000; i += 2) {
+                if (vector.setAtomically(i)) {
+                    ++newlySetBits[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    EXPECT_EQ(1000ul, vector.getNumberOfSetBits());
+    EXPECT_EQ(1000ul, newlySetBits[0] + newlySetBits[1] + newlySetBits[2] + newlySetBits[3]);
+    EXPECT_FALSE(vector.setAtomically(42));
+}
+
 TEST(BitVectorTest, GetAsInt) {
     storm::storage::BitVector vector(77);
     
@@ -425,6 +452,33 @@ TEST(BitVectorTest, Implies) {
     ASSERT_TRUE(impliesResult.get(31));
 }
 
+TEST(BitVectorTest, AndNot) {
+    storm::storage::BitVector vector1(100, true);
+    storm::storage::BitVector vector2(100);
+
+    for (uint_fast64_t i = 0; i < 100; ++i) {
+        vector2.set(i, i % 3 == 0);
+    }
+
+    storm::storage::BitVector expected = vector1 & ~vector2;
+    vector1.andNot(vector2);
+
+    ASSERT_EQ(expected, vector1);
+    ASSERT_EQ(66ul, vector1.getNumberOfSetBits());
+}
+
+TEST(BitVectorTest, OrNot) {
+    storm::storage::BitVector vector1(100);
+    storm::storage::BitVector vector2(100, true);
+
+    vector1.set(3);
+    vector2.set(50, false);
+    vector2.set(99, false);
+    vector1.orNot(vector2);
+
+    ASSERT_EQ(storm::storage::BitVector(100, {3, 50, 99}), vector1);
+}
+
 TEST(BitVectorTest, Subset) {
     storm::storage::BitVector vector1(32);
 	storm::storage::BitVector vector2(32, true);
@@ -484,6 +538,14 @@ TEST(BitVectorTest, Full) {
     vector.set(18, true);
     
     ASSERT_TRUE(vector.full());
+
+    storm::storage::BitVector largeVector(1024, true);
+
+    ASSERT_TRUE(largeVector.full());
+
+    largeVector.set(700, false);
+
+    ASSERT_FALSE(largeVector.full());
 }
 
 TEST(BitVectorTest, NumberOfSetBits) {
@@ -506,6 +568,40 @@ TEST(BitVectorTest, NumberOfSetBitsBeforeIndex) {
     ASSERT_EQ(7ul, vector.getNumberOfSetBitsBeforeIndex(14));
 }
 
+TEST(BitVectorTest, NumberOfSetBitsBeforeIndices) {
+    storm::storage::BitVector vector(200);
+
+    for (uint_fast64_t i = 0; i < 200; ++i) {
+        vector.set(i, i % 7 == 0);
+    }
+
+    std::vector<uint_fast64_t> numberOfSetBitsBeforeIndices = vector.getNumberOfSetBitsBeforeIndices();
+    ASSERT_EQ(200ul, numberOfSetBitsBeforeIndices.size());
+    for (uint_fast64_t i = 0; i < 200; ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), numberOfSetBitsBeforeIndices[i]);
+    }
+}
+
+TEST(BitVectorTest, RankIndex) {
+    storm::storage::BitVector vector(5000);
+
+    for (uint_fast64_t i = 0; i < 5000; ++i) {
+        vector.set(i, i % 5 == 0 || (i > 1000 && i < 1700) || i == 4999);
+    }
+
+    storm::storage::BitVectorRankIndex rankIndex(vector);
+    ASSERT_EQ(vector.getNumberOfSetBits(), rankIndex.getNumberOfSetBits());
+    for (uint_fast64_t i = 0; i <= 5000; ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), rankIndex.getNumberOfSetBitsBeforeIndex(i));
+    }
+
+    uint_fast64_t numberOfSetBitsBefore = 0;
+    for (auto index : vector) {
+        ASSERT_EQ(index, rankIndex.getIndexOfSetBit(numberOfSetBitsBefore));
+        ++numberOfSetBitsBefore;
+    }
+}
+
 TEST(BitVectorTest, BeginEnd) {
     storm::storage::BitVector vector(32);
     
@@ -0,0 +1,208 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/graph.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> createNondeterministicMatrix() {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 0, 0.5);
+        matrixBuilder.addNextValue(0, 1, 0.5);
+        matrixBuilder.addNextValue(1, 2, 1.0);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.addNextValue(2, 0, 0.3);
+        matrixBuilder.addNextValue(2, 3, 0.7);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 2, 1.0);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.addNextValue(4, 3, 1.0);
+        matrixBuilder.addNextValue(5, 1, 0.2);
+        matrixBuilder.addNextValue(5, 2, 0.8);
+        return matrixBuilder.build();
+    }
+}
+
+TEST(CompactSparseMatrix, Conversion) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    ASSERT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    ASSERT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    ASSERT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    ASSERT_EQ(matrix.getRowGroupCount(), compactMatrix.getRowGroupCount());
+    EXPECT_EQ(matrix.getRowGroupIndices(), compactMatrix.getRowGroupIndices());
+    EXPECT_FALSE(compactMatrix.hasTrivialRowGrouping());
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        ASSERT_EQ(matrix.getRow(row).getNumberOfEntries(), compactMatrix.getRow(row).getNumberOfEntries());
+        auto compactIt = compactMatrix.begin(row);
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), compactIt->getColumn());
+            EXPECT_EQ(entry.getValue(), compactIt->getValue());
+            ++compactIt;
+        }
+        EXPECT_TRUE(compactIt == compactMatrix.end(row));
+    }
+
+    EXPECT_TRUE(matrix == compactMatrix.toSparseMatrix());
+
+    storm::storage::SparseMatrix<double> copy = matrix;
+    storm::storage::CompactSparseMatrix<double> movedMatrix(std::move(copy));
+    EXPECT_EQ(0ul, copy.getEntryCount());
+    EXPECT_TRUE(matrix == movedMatrix.toSparseMatrix());
+}
+
+TEST(CompactSparseMatrix, BuildCompact) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 3, 0.2));
+
+    storm::storage::CompactSparseMatrix<double> matrix = matrixBuilder.buildCompact();
+    ASSERT_EQ(3ul, matrix.getRowCount());
+    ASSERT_EQ(4ul, matrix.getColumnCount());
+    ASSERT_EQ(5ul, matrix.getEntryCount());
+    ASSERT_EQ(3ul, matrix.getRowGroupCount());
+    EXPECT_TRUE(matrix.hasTrivialRowGrouping());
+    EXPECT_EQ(0ul, matrix.getRow(2).getNumberOfEntries());
+
+    std::vector<storm::storage::CompactSparseMatrix<double>::column_type> expectedColumns = {1, 2, 0, 1, 3};
+    EXPECT_EQ(expectedColumns, matrix.getColumns());
+}
+
+TEST(CompactSparseMatrix, BuildCompactOutOfCore) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    matrixBuilder.enableOutOfCoreStorage("", 2);
+    for (uint64_t state = 0; state < 10; ++state) {
+        matrixBuilder.newRowGroup(2 * state);
+        matrixBuilder.addNextValue(2 * state, state, 0.5);
+        matrixBuilder.addNextValue(2 * state, (state + 1) % 10, 0.5);
+        matrixBuilder.addNextValue(2 * state + 1, (state + 3) % 10, 1.0);
+    }
+    EXPECT_LT(0ul, matrixBuilder.getNumberOfEntriesStoredOutOfCore());
+
+    storm::storage::CompactSparseMatrix<double> matrix = matrixBuilder.buildCompact();
+    ASSERT_EQ(20ul, matrix.getRowCount());
+    ASSERT_EQ(10ul, matrix.getColumnCount());
+    ASSERT_EQ(30ul, matrix.getEntryCount());
+    ASSERT_EQ(10ul, matrix.getRowGroupCount());
+    for (uint64_t state = 0; state < 10; ++state) {
+        auto it = matrix.begin(2 * state);
+        EXPECT_EQ(std::min(state, (state + 1) % 10), it->getColumn());
+        EXPECT_EQ(0.5, it->getValue());
+        it = matrix.begin(2 * state + 1);
+        EXPECT_EQ((state + 3) % 10, it->getColumn());
+        EXPECT_EQ(1.0, it->getValue());
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyRange) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    std::vector<double> x = {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVectorRange(0, 2, x, result, &b);
+    compactMatrix.multiplyWithVectorRange(2, matrix.getRowCount(), x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount());
+        std::vector<double> reduced(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expectedReduced, &expectedChoices);
+        compactMatrix.multiplyAndReduceRange(dir, rowGroupIndices, 0, 1, x, &b, reduced, &choices);
+        compactMatrix.multiplyAndReduceRange(dir, rowGroupIndices, 1, matrix.getRowGroupCount(), x, &b, reduced, &choices);
+        EXPECT_EQ(expectedReduced, reduced);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x = {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_EQ(matrix.multiplyRowWithVector(row, x), compactMatrix.multiplyRowWithVector(row, x));
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    std::vector<double> x = {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expected, &expectedChoices);
+        compactMatrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, result, &choices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, choices);
+
+        // Gauss-Seidel style updates in both directions.
+        std::vector<double> expectedInPlace = x;
+        std::vector<double> inPlace = x;
+        matrix.multiplyAndReduceBackward(dir, rowGroupIndices, expectedInPlace, &b, expectedInPlace, &expectedChoices);
+        compactMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, inPlace, &b, inPlace, &choices);
+        EXPECT_EQ(expectedInPlace, inPlace);
+        EXPECT_EQ(expectedChoices, choices);
+
+        matrix.multiplyAndReduceForward(dir, rowGroupIndices, expectedInPlace, &b, expectedInPlace, &expectedChoices);
+        compactMatrix.multiplyAndReduceForward(dir, rowGroupIndices, inPlace, &b, inPlace, &choices);
+        EXPECT_EQ(expectedInPlace, inPlace);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(CompactSparseMatrix, GraphAnalysis) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    storm::storage::CompactSparseMatrix<double> compactBackwardTransitions(backwardTransitions);
+
+    storm::storage::BitVector phiStates(4, true);
+    storm::storage::BitVector psiStates(4);
+    psiStates.set(3);
+
+    auto expectedMax = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto resultMax = storm::utility::graph::performProb01Max(compactMatrix, compactMatrix.getRowGroupIndices(), compactBackwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(expectedMax.first, resultMax.first);
+    EXPECT_EQ(expectedMax.second, resultMax.second);
+
+    auto expectedMin = storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto resultMin = storm::utility::graph::performProb01Min(compactMatrix, compactMatrix.getRowGroupIndices(), compactBackwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(expectedMin.first, resultMin.first);
+    EXPECT_EQ(expectedMin.second, resultMin.second);
+
+    EXPECT_EQ(storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, 1), storm::utility::graph::performProbGreater0E(compactBackwardTransitions, phiStates, psiStates, true, 1));
+    EXPECT_EQ(storm::utility::graph::performProbGreater0A(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates), storm::utility::graph::performProbGreater0A(compactMatrix, compactMatrix.getRowGroupIndices(), compactBackwardTransitions, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb1A(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates), storm::utility::graph::performProb1A(compactMatrix, compactMatrix.getRowGroupIndices(), compactBackwardTransitions, phiStates, psiStates));
+}
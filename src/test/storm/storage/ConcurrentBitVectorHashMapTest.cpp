@@ -0,0 +1,94 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t bucketSize, uint64_t index) {
+        storm::storage::BitVector key(bucketSize);
+        key.setFromInt(0, 64, index * 0x9e3779b97f4a7c15ull);
+        if (bucketSize > 64) {
+            key.setFromInt(64, 64, index);
+        }
+        return key;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    // Start with a tiny map, so that it is resized a couple of times.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3);
+
+    uint64_t const numberOfKeys = 10000;
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        EXPECT_EQ(i, map.findOrAdd(createKey(128, i), i));
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_LE(numberOfKeys, map.capacity());
+
+    // The tables that were replaced while growing are kept until they are released explicitly.
+    EXPECT_LT(0ul, map.getNumberOfRetiredTables());
+    map.releaseRetiredTables();
+    EXPECT_EQ(0ul, map.getNumberOfRetiredTables());
+
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        EXPECT_EQ(i, map.findOrAdd(createKey(128, i), numberOfKeys));
+        std::pair<bool, uint64_t> flagValuePair = map.find(createKey(128, i));
+        EXPECT_TRUE(flagValuePair.first);
+        EXPECT_EQ(i, flagValuePair.second);
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_FALSE(map.contains(createKey(128, numberOfKeys)));
+
+    std::pair<uint64_t, bool> valueFlagPair = map.findOrGenerate(createKey(128, numberOfKeys), [&] () { return numberOfKeys; });
+    EXPECT_EQ(numberOfKeys, valueFlagPair.first);
+    EXPECT_TRUE(valueFlagPair.second);
+    valueFlagPair = map.findOrGenerate(createKey(128, numberOfKeys), [&] () { return numberOfKeys + 1; });
+    EXPECT_EQ(numberOfKeys, valueFlagPair.first);
+    EXPECT_FALSE(valueFlagPair.second);
+
+    storm::storage::BitVector found(numberOfKeys + 1);
+    map.forEach([&] (storm::storage::BitVector const& key, uint64_t const& value) {
+        EXPECT_EQ(createKey(128, value), key);
+        found.set(value);
+    });
+    EXPECT_TRUE(found.full());
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(64, 16);
+    std::atomic<uint32_t> nextIndex(0);
+
+    // All threads insert the same keys in different orders.
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 50021;
+    std::vector<std::vector<uint32_t>> indices(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t key = (i * (2 * thread + 1) + thread * 997) % numberOfKeys;
+                indices[thread][key] = map.findOrGenerate(createKey(64, key), [&] () { return nextIndex++; }).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key was inserted exactly once and all threads obtained the same index.
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextIndex.load());
+    storm::storage::BitVector usedIndices(numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(indices[0][key], indices[thread][key]);
+        }
+        EXPECT_EQ(indices[0][key], map.find(createKey(64, key)).second);
+        usedIndices.set(indices[0][key]);
+    }
+    EXPECT_TRUE(usedIndices.full());
+}
@@ -95,6 +95,37 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(SparseMatrixBuilder, OutOfCoreStorage) {
+    // Spill the entries in runs of single rows as well as in runs of several rows.
+    for (uint64_t bufferSize : {1ull, 3ull}) {
+        storm::storage::SparseMatrixBuilder<double> inMemoryBuilder(0, 0, 0, false, true);
+        storm::storage::SparseMatrixBuilder<double> outOfCoreBuilder(0, 0, 0, false, true);
+        outOfCoreBuilder.enableOutOfCoreStorage("", bufferSize);
+        for (auto builder : {&inMemoryBuilder, &outOfCoreBuilder}) {
+            uint64_t row = 0;
+            for (uint64_t group = 0; group < 20; ++group) {
+                builder->newRowGroup(row);
+                for (uint64_t choice = 0; choice < group % 3 + 1; ++choice, ++row) {
+                    // Insert the entries of some rows in the wrong order to check that they are still sorted correctly.
+                    if (group % 4 == 0) {
+                        builder->addNextValue(row, (group + 2) % 20, 0.25);
+                        builder->addNextValue(row, group, 0.75);
+                    } else {
+                        builder->addNextValue(row, group, 0.5);
+                        builder->addNextValue(row, (group + choice + 1) % 20, 0.5);
+                    }
+                }
+            }
+        }
+        EXPECT_GT(outOfCoreBuilder.getNumberOfEntriesStoredOutOfCore(), 0ull);
+        
+        storm::storage::SparseMatrix<double> inMemoryMatrix = inMemoryBuilder.build();
+        storm::storage::SparseMatrix<double> outOfCoreMatrix = outOfCoreBuilder.build();
+        EXPECT_EQ(inMemoryMatrix, outOfCoreMatrix);
+        EXPECT_EQ(0ull, outOfCoreBuilder.getNumberOfEntriesStoredOutOfCore());
+    }
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -600,6 +631,12 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     for (std::size_t index = 0; index < correctResult.size(); ++index) {
         ASSERT_NEAR(result[index], correctResult[index], 1e-12);
     }
+    
+    // Multiplying disjoint ranges of rows has to yield the same result.
+    std::vector<double> rangeResult(matrix.getRowCount());
+    ASSERT_NO_THROW(matrix.multiplyWithVectorRange(3, 5, x, rangeResult));
+    ASSERT_NO_THROW(matrix.multiplyWithVectorRange(0, 3, x, rangeResult));
+    EXPECT_EQ(result, rangeResult);
 }
 
 TEST(SparseMatrix, Iteration) {
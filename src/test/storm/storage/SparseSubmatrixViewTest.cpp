@@ -0,0 +1,138 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseSubmatrixView.h"
+#include "storm/storage/BitVector.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> createNondeterministicMatrix() {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 0, 0.5);
+        matrixBuilder.addNextValue(0, 1, 0.5);
+        matrixBuilder.addNextValue(1, 2, 1.0);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.addNextValue(2, 0, 0.3);
+        matrixBuilder.addNextValue(2, 3, 0.7);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 2, 1.0);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.addNextValue(4, 3, 1.0);
+        matrixBuilder.addNextValue(5, 1, 0.2);
+        matrixBuilder.addNextValue(5, 2, 0.8);
+        return matrixBuilder.build();
+    }
+}
+
+TEST(SparseSubmatrixView, Dimensions) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::BitVector states(4, {0, 1, 3});
+
+    storm::storage::SparseSubmatrixView<double> view(matrix, true, states, states);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, states, states);
+    EXPECT_EQ(submatrix.getRowCount(), view.getRowCount());
+    EXPECT_EQ(submatrix.getColumnCount(), view.getColumnCount());
+    EXPECT_EQ(submatrix.getRowGroupCount(), view.getRowGroupCount());
+    EXPECT_EQ(submatrix.getRowGroupIndices(), view.getRowGroupIndices());
+    EXPECT_EQ(4ul, view.getOriginalRow(3));
+    EXPECT_EQ(submatrix, view.toSparseMatrix());
+
+    storm::storage::BitVector rows(6, {1, 2, 5});
+    storm::storage::SparseSubmatrixView<double> rowView(matrix, false, rows, states);
+    storm::storage::SparseMatrix<double> rowSubmatrix = matrix.getSubmatrix(false, rows, states);
+    EXPECT_EQ(rowSubmatrix.getRowCount(), rowView.getRowCount());
+    EXPECT_EQ(rowSubmatrix.getRowGroupIndices(), rowView.getRowGroupIndices());
+    EXPECT_EQ(rowSubmatrix, rowView.toSparseMatrix());
+}
+
+TEST(SparseSubmatrixView, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::BitVector states(4, {0, 1, 3});
+    storm::storage::SparseSubmatrixView<double> view(matrix, true, states, states);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, states, states);
+
+    std::vector<double> x = {0.25, 0.5, 1.0};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> expected(submatrix.getRowCount());
+    std::vector<double> result(view.getRowCount());
+    submatrix.multiplyWithVector(x, expected, &b);
+    view.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    // Gauss-Seidel style multiplications on the DTMC that consists of the first row of each group.
+    storm::storage::BitVector firstRows(6, {0, 2, 3, 4});
+    storm::storage::SparseSubmatrixView<double> dtmcView(matrix, false, firstRows, storm::storage::BitVector(4, true));
+    storm::storage::SparseMatrix<double> dtmcMatrix = matrix.getSubmatrix(false, firstRows, storm::storage::BitVector(4, true));
+    std::vector<double> expectedX = {0.1, 0.2, 0.3, 0.4};
+    std::vector<double> viewX = expectedX;
+    dtmcMatrix.multiplyWithVectorForward(expectedX, expectedX);
+    dtmcView.multiplyWithVectorForward(viewX, viewX);
+    EXPECT_EQ(expectedX, viewX);
+    dtmcMatrix.multiplyWithVectorBackward(expectedX, expectedX);
+    dtmcView.multiplyWithVectorBackward(viewX, viewX);
+    EXPECT_EQ(expectedX, viewX);
+}
+
+TEST(SparseSubmatrixView, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::BitVector states(4, {0, 1, 3});
+    storm::storage::SparseSubmatrixView<double> view(matrix, true, states, states);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, states, states);
+
+    std::vector<double> x = {0.25, 0.5, 1.0};
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(submatrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(submatrix.getRowGroupCount(), 0);
+        submatrix.multiplyAndReduce(dir, submatrix.getRowGroupIndices(), x, nullptr, expected, &expectedChoices);
+
+        std::vector<double> result(view.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(view.getRowGroupCount(), 0);
+        view.multiplyAndReduce(dir, view.getRowGroupIndices(), x, nullptr, result, &choices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, choices);
+
+        // The input vector may also be the result vector.
+        std::vector<double> y = x;
+        view.multiplyAndReduce(dir, view.getRowGroupIndices(), y, nullptr, y, nullptr);
+        EXPECT_EQ(expected, y);
+
+        std::vector<double> expectedX = x;
+        std::vector<double> viewX = x;
+        submatrix.multiplyAndReduceBackward(dir, submatrix.getRowGroupIndices(), expectedX, nullptr, expectedX, nullptr);
+        view.multiplyAndReduceBackward(dir, view.getRowGroupIndices(), viewX, nullptr, viewX, nullptr);
+        EXPECT_EQ(expectedX, viewX);
+    }
+}
+
+TEST(SparseSubmatrixView, ManyColumns) {
+    // The selected columns span several blocks of 64 columns, which are renumbered via the rank directory.
+    uint64_t const size = 200;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    for (uint64_t row = 0; row < size; ++row) {
+        matrixBuilder.addNextValue(row, row, 0.5);
+        matrixBuilder.addNextValue(row, (row * 7 + 3) % size, 0.25);
+        matrixBuilder.addNextValue(row, (row * 13 + 64) % size, 0.25);
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::BitVector states(size);
+    for (uint64_t state = 0; state < size; ++state) {
+        if (state % 3 != 0 || state == 63 || state == 64 || state == 127) {
+            states.set(state);
+        }
+    }
+    storm::storage::SparseSubmatrixView<double> view(matrix, true, states, states);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, states, states);
+    EXPECT_EQ(submatrix, view.toSparseMatrix());
+
+    std::vector<double> x(view.getColumnCount());
+    for (uint64_t column = 0; column < x.size(); ++column) {
+        x[column] = static_cast<double>(column + 1);
+    }
+    std::vector<double> expected(submatrix.getRowCount());
+    std::vector<double> result(view.getRowCount());
+    submatrix.multiplyWithVector(x, expected);
+    view.multiplyWithVector(x, result);
+    EXPECT_EQ(expected, result);
+}
@@ -0,0 +1,103 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(StateValuationsTest, StoreAndRetrieve) {
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, 0, 7);
+    builder.addVariable(y);
+
+    // The values of x stay within the hinted range, the ones of y require re-encoding the column several times.
+    std::vector<int64_t> yValues = {0, 1, -1, 100, -70000, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(), 3};
+    for (uint64_t state = 0; state < yValues.size(); ++state) {
+        builder.addState(state, {state % 2 == 0}, {static_cast<int64_t>(state), yValues[state]});
+    }
+    // The value of x is outside of the hinted range.
+    builder.addState(yValues.size() + 1, {true}, {-5, 42});
+    storm::storage::sparse::StateValuations valuations = builder.build(yValues.size() + 3);
+
+    ASSERT_EQ(yValues.size() + 3, valuations.getNumberOfStates());
+    for (uint64_t state = 0; state < yValues.size(); ++state) {
+        EXPECT_FALSE(valuations.isEmpty(state));
+        EXPECT_EQ(state % 2 == 0, valuations.getBooleanValue(state, b));
+        EXPECT_EQ(static_cast<int64_t>(state), valuations.getIntegerValue(state, x));
+        EXPECT_EQ(yValues[state], valuations.getIntegerValue(state, y));
+    }
+    EXPECT_TRUE(valuations.isEmpty(yValues.size()));
+    EXPECT_FALSE(valuations.isEmpty(yValues.size() + 1));
+    EXPECT_TRUE(valuations.isEmpty(yValues.size() + 2));
+    EXPECT_TRUE(valuations.getBooleanValue(yValues.size() + 1, b));
+    EXPECT_EQ(-5, valuations.getIntegerValue(yValues.size() + 1, x));
+    EXPECT_EQ(42, valuations.getIntegerValue(yValues.size() + 1, y));
+    EXPECT_EQ("[b\t& x=2\t& y=-1]", valuations.toString(2));
+    EXPECT_EQ("[false\t1\t1]", valuations.toString(1, false));
+}
+
+TEST(StateValuationsTest, ReencodeAtBucketBoundary) {
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+
+    // The values of the first 64 states need two bits each, so they fill exactly two buckets of the bit vector.
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(x, 0, 3);
+    for (uint64_t state = 0; state < 64; ++state) {
+        builder.addState(state, {}, {static_cast<int64_t>(state % 4)});
+    }
+    // The value of the next state requires a wider code.
+    builder.addState(64, {}, {5});
+    // Leave a gap before the next state that requires an even wider code.
+    builder.addState(130, {}, {-1000});
+    storm::storage::sparse::StateValuations valuations = builder.build(131);
+
+    for (uint64_t state = 0; state < 64; ++state) {
+        EXPECT_EQ(static_cast<int64_t>(state % 4), valuations.getIntegerValue(state, x));
+    }
+    EXPECT_EQ(5, valuations.getIntegerValue(64, x));
+    EXPECT_TRUE(valuations.isEmpty(65));
+    EXPECT_TRUE(valuations.isEmpty(129));
+    EXPECT_EQ(-1000, valuations.getIntegerValue(130, x));
+}
+
+TEST(StateValuationsTest, SelectStates) {
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, -10, 10);
+    for (uint64_t state = 0; state < 20; ++state) {
+        builder.addState(state, {state % 3 == 0}, {static_cast<int64_t>(state) - 10});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build(20);
+
+    storm::storage::BitVector selectedStates(20);
+    selectedStates.set(3);
+    selectedStates.set(7);
+    selectedStates.set(19);
+    storm::storage::sparse::StateValuations selection = valuations.selectStates(selectedStates);
+    ASSERT_EQ(3ull, selection.getNumberOfStates());
+    EXPECT_TRUE(selection.getBooleanValue(0, b));
+    EXPECT_EQ(-7, selection.getIntegerValue(0, x));
+    EXPECT_FALSE(selection.getBooleanValue(1, b));
+    EXPECT_EQ(-3, selection.getIntegerValue(1, x));
+    EXPECT_EQ(9, selection.getIntegerValue(2, x));
+
+    storm::storage::sparse::StateValuations reordered = valuations.selectStates(std::vector<uint64_t>({12, 20, 0}));
+    ASSERT_EQ(3ull, reordered.getNumberOfStates());
+    EXPECT_EQ(2, reordered.getIntegerValue(0, x));
+    EXPECT_TRUE(reordered.isEmpty(1));
+    EXPECT_EQ(-10, reordered.getIntegerValue(2, x));
+    EXPECT_TRUE(reordered.getBooleanValue(2, b));
+}
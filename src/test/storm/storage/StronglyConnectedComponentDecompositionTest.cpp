@@ -6,6 +6,10 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include <map>
+#include <random>
+#include <set>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
 	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -86,3 +90,80 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelMatchesSequential) {
+    // A random MDP with mostly local transitions such that there are SCCs of various sizes.
+    uint64_t numberOfStates = 5000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0, numberOfChoices = 1 + generator() % 2; choice < numberOfChoices; ++choice, ++row) {
+            std::set<uint64_t> successors;
+            for (uint64_t successor = 0, numberOfSuccessors = generator() % 3; successor < numberOfSuccessors; ++successor) {
+                successors.insert(generator() % 4 == 0 ? generator() % numberOfStates : (state + numberOfStates + generator() % 7 - 3) % numberOfStates);
+            }
+            for (auto const& successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 0.5);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::BitVector subsystem(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        subsystem.set(state, generator() % 10 != 0);
+    }
+    storm::storage::BitVector choices(matrix.getRowCount());
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        choices.set(row, generator() % 3 != 0);
+    }
+    
+    for (uint64_t variant = 0; variant < 4; ++variant) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (variant % 2 == 1) {
+            options.subsystem(&subsystem).choices(&choices);
+        }
+        if (variant >= 2) {
+            options.dropNaiveSccs();
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, storm::storage::StronglyConnectedComponentDecompositionOptions(options).numberOfThreads(1));
+        std::map<std::vector<uint64_t>, std::pair<bool, uint64_t>> expectedSccs;
+        for (uint64_t sccIndex = 0; sccIndex < sequentialDecomposition.size(); ++sccIndex) {
+            auto const& scc = sequentialDecomposition[sccIndex];
+            expectedSccs[std::vector<uint64_t>(scc.begin(), scc.end())] = std::make_pair(scc.isTrivial(), sequentialDecomposition.getSccDepth(sccIndex));
+        }
+        
+        // A small threshold makes sure that the parallel algorithm is used for most of the states.
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, storm::storage::StronglyConnectedComponentDecompositionOptions(options).numberOfThreads(4).parallelThreshold(10));
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        std::vector<uint64_t> stateToScc(numberOfStates, parallelDecomposition.size());
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            auto const& scc = parallelDecomposition[sccIndex];
+            auto expectedIt = expectedSccs.find(std::vector<uint64_t>(scc.begin(), scc.end()));
+            ASSERT_TRUE(expectedIt != expectedSccs.end());
+            EXPECT_EQ(expectedIt->second.first, scc.isTrivial());
+            EXPECT_EQ(expectedIt->second.second, parallelDecomposition.getSccDepth(sccIndex));
+            for (auto const& state : scc) {
+                stateToScc[state] = sccIndex;
+            }
+        }
+        
+        // The SCCs are sorted topologically.
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto const& state : parallelDecomposition[sccIndex]) {
+                for (auto row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+                    if (options.choicesPtr && !choices.get(row)) {
+                        continue;
+                    }
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (stateToScc[entry.getColumn()] < parallelDecomposition.size()) {
+                            EXPECT_LE(stateToScc[entry.getColumn()], sccIndex);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -8,9 +8,11 @@
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SylvanSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <atomic>
 #include <memory>
 #include <iostream>
 
@@ -954,3 +956,37 @@ TEST(SylvanDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, ExecuteTest) {
+    // The number of workers is fixed when Sylvan is initialized, i.e., when the first manager is created.
+    storm::settings::mutableSylvanSettings().setNumberOfThreads(2);
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    EXPECT_GE(manager->getNumberOfThreads(), 2ul);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 15);
+    
+    // Every task is executed exactly once and the tasks may build DDs concurrently.
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> encodings(16);
+    ASSERT_NO_THROW(manager->execute(16, [&] (uint64_t task) { encodings[task] = manager->getEncoding(x.first, task); }));
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> all = manager->getBddZero();
+    for (auto const& encoding : encodings) {
+        EXPECT_EQ(1ul, encoding.getNonZeroCount());
+        all |= encoding;
+    }
+    EXPECT_EQ(16ul, all.getNonZeroCount());
+    
+    // An exception thrown by one task is rethrown by execute after all other tasks are done.
+    std::atomic<uint64_t> numberOfExecutedTasks(0);
+    STORM_SILENT_EXPECT_THROW(manager->execute(16, [&] (uint64_t task) {
+        if (task == 3) {
+            throw storm::exceptions::InvalidArgumentException() << "Task " << task << " failed.";
+        }
+        ++numberOfExecutedTasks;
+    }), storm::exceptions::InvalidArgumentException);
+    EXPECT_EQ(15ul, numberOfExecutedTasks.load());
+    
+    // The manager can still be used afterwards.
+    EXPECT_NO_THROW(manager->execute(4, [&] (uint64_t task) { encodings[task] = manager->getEncoding(x.first, task); }));
+    
+    manager.reset();
+    storm::settings::mutableSylvanSettings().setNumberOfThreads(0);
+}
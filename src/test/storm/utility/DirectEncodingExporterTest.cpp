@@ -0,0 +1,205 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/export.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/GzipInputStreamBuffer.h"
+#include "storm/utility/GzipOutputStreamBuffer.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    template<typename ValueType>
+    std::string exportToString(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, uint64_t numberOfThreads, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
+        std::stringstream stream;
+        stream.precision(17);
+        storm::exporter::DirectEncodingOptions options;
+        options.numberOfThreads = numberOfThreads;
+        options.allowPlaceholders = allowPlaceholders;
+        storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+        return stream.str();
+    }
+
+    template<typename ValueType>
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> parseFromString(std::string const& content) {
+        std::string filename = testing::TempDir() + "storm-drn-export-test.drn";
+        {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            stream << content;
+        }
+        auto result = storm::parser::DirectEncodingParser<ValueType>::parseModel(filename);
+        std::remove(filename.c_str());
+        return result;
+    }
+
+    /*!
+     * Checks that the parsed model coincides with the original one, which requires that all values were exported with
+     * full precision.
+     */
+    void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+        EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+        ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& rewardModel : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+            auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), actualRewardModel.getOptionalStateRewardVector());
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), actualRewardModel.getOptionalStateActionRewardVector());
+        }
+        if (expected.isOfType(storm::models::ModelType::Ctmc)) {
+            EXPECT_EQ(expected.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), actual.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+        } else if (expected.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto expectedMarkovAutomaton = expected.as<storm::models::sparse::MarkovAutomaton<double>>();
+            auto actualMarkovAutomaton = actual.as<storm::models::sparse::MarkovAutomaton<double>>();
+            EXPECT_EQ(expectedMarkovAutomaton->getMarkovianStates(), actualMarkovAutomaton->getMarkovianStates());
+            EXPECT_EQ(expectedMarkovAutomaton->getExitRates(), actualMarkovAutomaton->getExitRates());
+        }
+    }
+
+    /*!
+     * Retrieves the definitions of placeholders in the given DRN output.
+     */
+    std::vector<std::string> getPlaceholderDefinitions(std::string const& content) {
+        std::vector<std::string> result;
+        std::stringstream stream(content);
+        std::string line;
+        bool inPlaceholders = false;
+        while (std::getline(stream, line)) {
+            if (!line.empty() && line.front() == '@') {
+                inPlaceholders = line == "@placeholders";
+            } else if (inPlaceholders) {
+                result.push_back(line);
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Evaluates the given function by assigning a fixed value to every parameter of the given model, which identifies
+     * the parameter by its name. Evaluating functions of different models this way allows to compare them even though
+     * their parameters are distinct variables.
+     */
+    storm::RationalFunctionCoefficient evaluate(storm::RationalFunction const& function, std::set<storm::RationalFunctionVariable> const& parameters) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        for (auto const& parameter : parameters) {
+            // Assign a value between 0 and 1 that only depends on the name of the parameter.
+            int characterSum = 0;
+            for (char character : parameter.name()) {
+                characterSum += character;
+            }
+            valuation[parameter] = storm::RationalFunctionCoefficient(storm::RationalFunctionCoefficient(characterSum % 7 + 1) / storm::RationalFunctionCoefficient(9));
+        }
+        return function.evaluate(valuation);
+    }
+}
+
+TEST(DirectEncodingExporterTest, ParallelExport) {
+    for (std::string const& filename : {"/dtmc/crowds-5-5.drn", "/mdp/two_dice.drn", "/ctmc/cluster2.drn", "/ma/jobscheduler.drn"}) {
+        auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + filename);
+        std::string sequentialResult = exportToString(model, 1);
+        EXPECT_EQ(sequentialResult, exportToString(model, 4)) << "for " << filename;
+
+        // Parsing the exported model again yields the same entries, values, labels and rewards.
+        auto parsedModel = parseFromString<double>(sequentialResult);
+        expectEqualModels(*model, *parsedModel);
+
+        // Exporting the parsed model does not change the output any further.
+        EXPECT_EQ(sequentialResult, exportToString(parsedModel, 1)) << "for " << filename;
+    }
+}
+
+TEST(DirectEncodingExporterTest, GzipExport) {
+    if (!storm::utility::GzipOutputStreamBuffer::isSupported()) {
+        GTEST_SKIP() << "Storm was built without zlib.";
+    }
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string filename = testing::TempDir() + "storm-drn-export-test.drn.gz";
+    storm::api::exportSparseModelAsDrn(model, filename, {}, true, 2);
+
+    // The file is gzip compressed and decompresses to the uncompressed export.
+    std::string decompressedContent;
+    {
+        std::ifstream stream(filename, std::ios::in | std::ios::binary);
+        ASSERT_EQ(0x1f, stream.get());
+        ASSERT_EQ(0x8b, stream.get());
+        stream.seekg(0);
+        storm::utility::GzipInputStreamBuffer buffer(stream);
+        std::istream decompressedStream(&buffer);
+        std::stringstream content;
+        content << decompressedStream.rdbuf();
+        decompressedContent = content.str();
+    }
+    std::stringstream uncompressedStream;
+    uncompressedStream.precision(std::cout.precision());
+    storm::exporter::explicitExportSparseModel(uncompressedStream, model, {});
+    EXPECT_EQ(uncompressedStream.str(), decompressedContent);
+
+    // The parser reads the compressed file directly.
+    auto parsedModel = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+    EXPECT_EQ(model->getNumberOfStates(), parsedModel->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfChoices(), parsedModel->getNumberOfChoices());
+    EXPECT_EQ(model->getNumberOfTransitions(), parsedModel->getNumberOfTransitions());
+    EXPECT_EQ(model->getStateLabeling(), parsedModel->getStateLabeling());
+}
+
+TEST(DirectEncodingExporterTest, Placeholders) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+    std::vector<std::string> parameterNames = storm::storage::SymbolicModelDescription(program).getParameterNames();
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program).build();
+
+    std::unordered_map<storm::RationalFunction, uint64_t> occurrences;
+    for (auto const& entry : model->getTransitionMatrix()) {
+        if (!storm::utility::isConstant(entry.getValue())) {
+            ++occurrences[entry.getValue()];
+        }
+    }
+    uint64_t numberOfRepeatedFunctions = 0;
+    for (auto const& functionCountPair : occurrences) {
+        if (functionCountPair.second > 1) {
+            ++numberOfRepeatedFunctions;
+        }
+    }
+    ASSERT_GT(numberOfRepeatedFunctions, 0ul);
+
+    // As the sketch never underestimates how often a function was seen, every function that occurs more than once
+    // gets a placeholder. Functions that occur once may get one, but constants never do.
+    std::string resultWithPlaceholders = exportToString(model, 1, parameterNames);
+    std::vector<std::string> placeholderDefinitions = getPlaceholderDefinitions(resultWithPlaceholders);
+    EXPECT_GE(placeholderDefinitions.size(), numberOfRepeatedFunctions);
+    EXPECT_LE(placeholderDefinitions.size(), occurrences.size());
+    for (auto const& definition : placeholderDefinitions) {
+        EXPECT_EQ('$', definition.front()) << definition;
+    }
+    std::string resultWithoutPlaceholders = exportToString(model, 1, parameterNames, false);
+    EXPECT_TRUE(getPlaceholderDefinitions(resultWithoutPlaceholders).empty());
+
+    // Both exports describe the same model.
+    std::set<storm::RationalFunctionVariable> parameters = storm::models::sparse::getProbabilityParameters(*model);
+    for (std::string const& result : {resultWithPlaceholders, resultWithoutPlaceholders}) {
+        auto parsedModel = parseFromString<storm::RationalFunction>(result);
+        std::set<storm::RationalFunctionVariable> parsedParameters = storm::models::sparse::getProbabilityParameters(*parsedModel);
+        ASSERT_EQ(parameters.size(), parsedParameters.size());
+        auto const& matrix = model->getTransitionMatrix();
+        auto const& parsedMatrix = parsedModel->getTransitionMatrix();
+        ASSERT_EQ(matrix.getEntryCount(), parsedMatrix.getEntryCount());
+        EXPECT_EQ(matrix.getRowGroupIndices(), parsedMatrix.getRowGroupIndices());
+        for (auto it = matrix.begin(), parsedIt = parsedMatrix.begin(); it != matrix.end(); ++it, ++parsedIt) {
+            EXPECT_EQ(it->getColumn(), parsedIt->getColumn());
+            EXPECT_EQ(evaluate(it->getValue(), parameters), evaluate(parsedIt->getValue(), parsedParameters));
+        }
+        EXPECT_EQ(model->getStateLabeling(), parsedModel->getStateLabeling());
+    }
+}
@@ -16,6 +16,9 @@
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
 
+#include <random>
+#include <set>
+
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -668,3 +671,84 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, GreedyColoring) {
+    // A nondeterministic system with four states (the last one with two choices) and a self-loop.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 1, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 3, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 1.0);
+    builder.addNextValue(4, 3, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    
+    std::vector<uint64_t> colors = storm::utility::graph::getGreedyColoring(matrix, matrix.getRowGroupIndices());
+    ASSERT_EQ(4ull, colors.size());
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 1, 2}), colors);
+    for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+        for (auto const& entry : matrix.getRowGroup(state)) {
+            if (entry.getColumn() != state) {
+                EXPECT_NE(colors[state], colors[entry.getColumn()]);
+            }
+        }
+    }
+}
+
+TEST(GraphTest, ParallelBackwardSearch) {
+    // A random MDP with mostly local transitions, such that the searches need many levels.
+    uint64_t numberOfStates = 3000;
+    std::mt19937 generator(7);
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0, numberOfChoices = 1 + generator() % 3; choice < numberOfChoices; ++choice, ++row) {
+            std::set<uint64_t> successors;
+            for (uint64_t successor = 0, numberOfSuccessors = 1 + generator() % 2; successor < numberOfSuccessors; ++successor) {
+                successors.insert(generator() % 50 == 0 ? generator() % numberOfStates : (state + numberOfStates + generator() % 5 - 2) % numberOfStates);
+            }
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    storm::storage::BitVector phiStates(numberOfStates), psiStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        phiStates.set(state, generator() % 20 != 0);
+        psiStates.set(state, generator() % 100 == 0);
+    }
+    
+    auto computeAll = [&] () {
+        std::vector<storm::storage::BitVector> result;
+        result.push_back(storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates));
+        result.push_back(storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 10));
+        result.push_back(storm::utility::graph::performProb1(backwardTransitions, phiStates, psiStates));
+        result.push_back(storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, 10));
+        auto max = storm::utility::graph::performProb01Max(matrix, rowGroupIndices, backwardTransitions, phiStates, psiStates);
+        result.push_back(max.first);
+        result.push_back(max.second);
+        auto min = storm::utility::graph::performProb01Min(matrix, rowGroupIndices, backwardTransitions, phiStates, psiStates);
+        result.push_back(min.first);
+        result.push_back(min.second);
+        return result;
+    };
+    
+    storm::utility::graph::setParallelSearchParameters(1, 0);
+    std::vector<storm::storage::BitVector> sequentialResult = computeAll();
+    storm::utility::graph::setParallelSearchParameters(4, 0);
+    std::vector<storm::storage::BitVector> parallelResult = computeAll();
+    storm::utility::graph::setParallelSearchParameters(0, 100000);
+    
+    ASSERT_EQ(sequentialResult.size(), parallelResult.size());
+    for (uint64_t index = 0; index < sequentialResult.size(); ++index) {
+        EXPECT_EQ(sequentialResult[index], parallelResult[index]) << "Result " << index << " differs.";
+    }
+}
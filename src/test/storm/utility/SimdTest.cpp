@@ -0,0 +1,102 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <random>
+#include <set>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/utility/simd.h"
+
+namespace {
+    storm::storage::CompactSparseMatrix<double> createRandomMatrix(uint64_t size) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<uint64_t> columnDistribution(0, size - 1);
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+
+        // Use all row lengths between 0 and 19 to cover both the vectorized and the remainder part of the kernels.
+        storm::storage::SparseMatrixBuilder<double> builder(size, size);
+        for (uint64_t row = 0; row < size; ++row) {
+            std::set<uint64_t> columns;
+            while (columns.size() < row % 20) {
+                columns.insert(columnDistribution(generator));
+            }
+            for (auto const& column : columns) {
+                builder.addNextValue(row, column, valueDistribution(generator));
+            }
+        }
+        return builder.buildCompact();
+    }
+
+    std::vector<storm::utility::simd::InstructionSet> getSupportedInstructionSets() {
+        std::vector<storm::utility::simd::InstructionSet> result;
+        for (auto const& instructionSet : {storm::utility::simd::InstructionSet::Scalar, storm::utility::simd::InstructionSet::Avx2, storm::utility::simd::InstructionSet::Avx512}) {
+            if (storm::utility::simd::isSupported(instructionSet)) {
+                result.push_back(instructionSet);
+            }
+        }
+        return result;
+    }
+}
+
+TEST(SimdTest, Detection) {
+    EXPECT_TRUE(storm::utility::simd::isSupported(storm::utility::simd::InstructionSet::Scalar));
+    EXPECT_TRUE(storm::utility::simd::isSupported(storm::utility::simd::getSupportedInstructionSet()));
+    EXPECT_TRUE(storm::utility::simd::isColumnCountSupported(1ull << 31));
+    EXPECT_FALSE(storm::utility::simd::isColumnCountSupported((1ull << 31) + 1));
+}
+
+TEST(SimdTest, MultiplyRows) {
+    uint64_t const size = 200;
+    storm::storage::CompactSparseMatrix<double> matrix = createRandomMatrix(size);
+    std::vector<double> x(size);
+    std::vector<double> b(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        x[i] = 1.0 / (i + 1);
+        b[i] = 0.5 * i;
+    }
+
+    std::vector<double> expected(size);
+    matrix.multiplyWithVector(x, expected, &b);
+
+    for (auto const& instructionSet : getSupportedInstructionSets()) {
+        std::vector<double> result(size);
+        storm::utility::simd::multiplyRows(instructionSet, matrix.getRowIndications().data(), matrix.getColumns().data(), matrix.getValues().data(), x.data(), b.data(), result.data(), 0, size);
+        for (uint64_t i = 0; i < size; ++i) {
+            EXPECT_NEAR(expected[i], result[i], 1e-12) << " in row " << i << " with " << storm::utility::simd::toString(instructionSet);
+        }
+
+        // Only multiply a range of the rows (backwards) and without summand.
+        std::vector<double> partialResult(50);
+        storm::utility::simd::multiplyRows(instructionSet, matrix.getRowIndications().data(), matrix.getColumns().data(), matrix.getValues().data(), x.data(), nullptr, partialResult.data(), 100, 150, true);
+        for (uint64_t i = 0; i < 50; ++i) {
+            EXPECT_NEAR(matrix.multiplyRowWithVector(100 + i, x), partialResult[i], 1e-12) << " in row " << 100 + i << " with " << storm::utility::simd::toString(instructionSet);
+        }
+    }
+}
+
+TEST(SimdTest, GaussSeidel) {
+    uint64_t const size = 200;
+    storm::storage::CompactSparseMatrix<double> matrix = createRandomMatrix(size);
+    std::vector<double> initial(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        initial[i] = 1.0 / (i + 1);
+    }
+
+    for (bool backwards : {false, true}) {
+        std::vector<double> expected = initial;
+        if (backwards) {
+            matrix.multiplyWithVectorBackward(expected, expected);
+        } else {
+            matrix.multiplyWithVectorForward(expected, expected);
+        }
+
+        for (auto const& instructionSet : getSupportedInstructionSets()) {
+            std::vector<double> x = initial;
+            storm::utility::simd::multiplyRows(instructionSet, matrix.getRowIndications().data(), matrix.getColumns().data(), matrix.getValues().data(), x.data(), nullptr, x.data(), 0, size, backwards);
+            for (uint64_t i = 0; i < size; ++i) {
+                EXPECT_NEAR(expected[i], x[i], 1e-12) << " in row " << i << " with " << storm::utility::simd::toString(instructionSet);
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <atomic>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+TEST(ThreadPoolTest, ExecuteAllTasks) {
+    storm::utility::ThreadPool pool(4);
+    EXPECT_EQ(4ull, pool.getNumberOfThreads());
+    
+    for (uint64_t numberOfTasks : {0ull, 1ull, 3ull, 1000ull}) {
+        std::vector<std::atomic<uint64_t>> counters(numberOfTasks);
+        for (auto& counter : counters) {
+            counter = 0;
+        }
+        pool.execute(numberOfTasks, [&counters] (uint64_t task) { ++counters[task]; });
+        for (auto const& counter : counters) {
+            EXPECT_EQ(1ull, counter.load());
+        }
+    }
+}
+
+TEST(ThreadPoolTest, NestedExecution) {
+    storm::utility::ThreadPool pool(3);
+    std::atomic<uint64_t> sum(0);
+    pool.execute(10, [&] (uint64_t outer) {
+        pool.execute(10, [&] (uint64_t inner) { sum += outer * 10 + inner; });
+    });
+    EXPECT_EQ(4950ull, sum.load());
+}
+
+TEST(ThreadPoolTest, GlobalInstancesOfDifferentSize) {
+    storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalInstance(4);
+    EXPECT_EQ(4ull, pool.getNumberOfThreads());
+    EXPECT_FALSE(storm::utility::ThreadPool::isExecutingTask());
+    
+    // Requesting pools of other sizes from within a task must not affect the pool that runs the task.
+    std::atomic<uint64_t> sum(0);
+    pool.execute(10, [&] (uint64_t outer) {
+        EXPECT_TRUE(storm::utility::ThreadPool::isExecutingTask());
+        storm::utility::ThreadPool::getGlobalInstance(2 + outer % 2).execute(10, [&] (uint64_t inner) { sum += outer * 10 + inner; });
+    });
+    EXPECT_EQ(4950ull, sum.load());
+    EXPECT_EQ(&pool, &storm::utility::ThreadPool::getGlobalInstance(4));
+    EXPECT_EQ(2ull, storm::utility::ThreadPool::getGlobalInstance(2).getNumberOfThreads());
+}
+
+TEST(ThreadPoolTest, Exception) {
+    storm::utility::ThreadPool pool(4);
+    std::atomic<uint64_t> executed(0);
+    STORM_SILENT_EXPECT_THROW(pool.execute(100, [&] (uint64_t task) {
+        ++executed;
+        STORM_LOG_THROW(task != 42, storm::exceptions::InvalidStateException, "Task failed.");
+    }), storm::exceptions::InvalidStateException);
+    EXPECT_EQ(100ull, executed.load());
+    
+    // The pool has to remain usable.
+    executed = 0;
+    pool.execute(100, [&] (uint64_t) { ++executed; });
+    EXPECT_EQ(100ull, executed.load());
+}
+
+TEST(ThreadPoolTest, BalancedBlocks) {
+    // Ten items where the first item is much heavier than the others.
+    std::vector<uint64_t> offsets = {0, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99};
+    auto offset = [&offsets] (uint64_t item) { return offsets[item]; };
+    
+    std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(10, 2, offset);
+    std::vector<uint64_t> expected = {0, 1, 10};
+    EXPECT_EQ(expected, blocks);
+    
+    blocks = storm::utility::computeBalancedBlocks(10, 1, offset);
+    expected = {0, 10};
+    EXPECT_EQ(expected, blocks);
+    
+    // Equal weights.
+    blocks = storm::utility::computeBalancedBlocks(8, 4, [] (uint64_t) { return 0; });
+    expected = {0, 2, 4, 6, 8};
+    EXPECT_EQ(expected, blocks);
+    
+    // More blocks than items.
+    blocks = storm::utility::computeBalancedBlocks(3, 10, [] (uint64_t) { return 0; });
+    expected = {0, 1, 2, 3};
+    EXPECT_EQ(expected, blocks);
+    
+    blocks = storm::utility::computeBalancedBlocks(0, 4, [] (uint64_t) { return 0; });
+    expected = {0};
+    EXPECT_EQ(expected, blocks);
+}
+
+TEST(ThreadPoolTest, MultiplyAndReduce) {
+    // Build a larger nondeterministic matrix with row groups of different sizes.
+    uint64_t const numberOfGroups = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= group % 3; ++choice, ++row) {
+            for (uint64_t entry = 0; entry < (row % 7) + 1; ++entry) {
+                builder.addNextValue(row, (group + entry * 13 + choice) % numberOfGroups, 1.0 / (entry + choice + 1));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t index = 0; index < numberOfGroups; ++index) {
+        x[index] = static_cast<double>(index % 10);
+    }
+    
+    std::vector<double> expected(numberOfGroups);
+    std::vector<uint64_t> expectedChoices(numberOfGroups, 0);
+    matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, expected, &expectedChoices);
+    
+    storm::utility::ThreadPool pool(4);
+    std::vector<uint64_t> blocks = storm::utility::computeBalancedBlocks(numberOfGroups, 16, [&] (uint64_t group) { return static_cast<uint64_t>(matrix.begin(rowGroupIndices[group]) - matrix.begin()); });
+    std::vector<double> result(numberOfGroups);
+    std::vector<uint64_t> choices(numberOfGroups, 0);
+    pool.execute(blocks.size() - 1, [&] (uint64_t block) {
+        matrix.multiplyAndReduceRange(storm::OptimizationDirection::Maximize, rowGroupIndices, blocks[block], blocks[block + 1], x, nullptr, result, &choices);
+    });
+    EXPECT_EQ(expected, result);
+    EXPECT_EQ(expectedChoices, choices);
+}